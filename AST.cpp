@@ -22,6 +22,7 @@
 #include "HandleType.h"
 #include "Interface.h"
 #include "Location.h"
+#include "Method.h"
 #include "Scope.h"
 #include "TypeDef.h"
 
@@ -462,6 +463,10 @@ void AST::addImportedAST(AST *ast) {
     mImportedASTs.insert(ast);
 }
 
+const std::set<AST*>& AST::getImportedASTs() const {
+    return mImportedASTs;
+}
+
 FQName AST::makeFullName(const char* localName, Scope* scope) const {
     std::vector<std::string> pathComponents{{localName}};
     for (; scope != &mRootScope; scope = scope->parent()) {
@@ -797,6 +802,62 @@ void AST::getAllImportedNamesGranular(std::set<FQName> *allImportNames) const {
     }
 }
 
+// Adds the interfaces whose definitions are needed to use type, i.e. the
+// interface itself or the interface in which a named type is nested.
+static void addCompleteInterfaces(const Type* type, std::set<FQName>* names) {
+    if (!type->isNamedType()) {
+        for (const auto* ref : type->getReferences()) {
+            addCompleteInterfaces(ref->get(), names);
+        }
+        return;
+    }
+
+    for (const Type* t = type; t != nullptr; t = t->parent()) {
+        if (t->isInterface()) {
+            names->insert(static_cast<const Interface*>(t)->fqName());
+            return;
+        }
+    }
+}
+
+static void addCompleteInterfacesOfDefinedTypes(const Type* type, std::set<FQName>* names) {
+    for (const Type* definedType : type->getDefinedTypes()) {
+        for (const auto* ref : definedType->getReferences()) {
+            addCompleteInterfaces(ref->get(), names);
+        }
+        addCompleteInterfacesOfDefinedTypes(definedType, names);
+    }
+}
+
+void AST::getForwardDeclaredNames(std::set<FQName>* forwardDeclaredNames) const {
+    const Interface* iface = getInterface();
+    if (iface == nullptr || !mCoordinator->forwardDeclareInterfaces()) {
+        return;
+    }
+
+    // the super types, including the ones imported for the cast functions
+    std::set<FQName> completeNames;
+    for (const Interface* superType : iface->superTypeChain()) {
+        completeNames.insert(superType->fqName());
+    }
+    for (const Method* method : iface->userDefinedMethods()) {
+        for (const auto* ref : method->getReferences()) {
+            // sp<> arguments and results can be declared with incomplete types
+            if (!ref->get()->isInterface()) {
+                addCompleteInterfaces(ref->get(), &completeNames);
+            }
+        }
+    }
+    // nested types have their toString, operator== etc. defined in the header
+    addCompleteInterfacesOfDefinedTypes(iface, &completeNames);
+
+    for (const FQName& name : mImportedNames) {
+        if (name.name() != "types" && completeNames.find(name) == completeNames.end()) {
+            forwardDeclaredNames->insert(name);
+        }
+    }
+}
+
 bool AST::isJavaCompatible() const {
     return mRootScope.isJavaCompatible();
 }
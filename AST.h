@@ -76,6 +76,7 @@ struct AST {
     Type* lookupType(const FQName& fqName, Scope* scope);
 
     void addImportedAST(AST *ast);
+    const std::set<AST*>& getImportedASTs() const;
 
     // Calls all passes after parsing required before
     // being ready to generate output.
@@ -132,6 +133,7 @@ struct AST {
     void generateCppSource(Formatter& out) const;
 
     void generateInterfaceHeader(Formatter& out) const;
+    void generateInterfaceForwardHeader(Formatter& out) const;
     void generateHwBinderHeader(Formatter& out) const;
     void generateStubHeader(Formatter& out) const;
     void generateProxyHeader(Formatter& out) const;
@@ -143,6 +145,8 @@ struct AST {
     void generateCppAdapterHeader(Formatter& out) const;
     void generateCppAdapterSource(Formatter& out) const;
 
+    void generateCppBenchmarkSource(Formatter& out) const;
+
     void generateJava(Formatter& out, const std::string& limitToType) const;
     void generateJavaTypes(Formatter& out, const std::string& limitToType) const;
 
@@ -175,6 +179,12 @@ struct AST {
     // as all types defined in imported packages.
     void getAllImportedNamesGranular(std::set<FQName> *allImportSet) const;
 
+    // Get the imported interfaces which the interface header only needs
+    // forward declared, because they are not used by value and are only
+    // passed to or returned from its methods. Empty unless the coordinator
+    // is set to forward declare interfaces.
+    void getForwardDeclaredNames(std::set<FQName>* forwardDeclaredNames) const;
+
     void appendToExportedTypesVector(
             std::vector<const Type *> *exportedTypes) const;
 
@@ -278,6 +288,7 @@ struct AST {
     void generateProxyMethodSource(Formatter& out, const std::string& className,
                                    const Method* method, const Interface* superInterface) const;
     void generateAdapterMethod(Formatter& out, const Method* method) const;
+    void generateBenchmarkMethod(Formatter& out, const Method* method) const;
 
     void generateFetchSymbol(Formatter &out, const std::string &ifaceName) const;
 
@@ -285,6 +296,8 @@ struct AST {
 
     void generateStubSource(Formatter& out, const Interface* iface) const;
 
+    void generateStubSwitch(Formatter& out, const Interface* iface) const;
+    void generateStubDispatchTable(Formatter& out, const Interface* iface) const;
     void generateStubSourceForMethod(Formatter& out, const Method* method,
                                      const Interface* superInterface) const;
     void generateStaticStubMethodSource(Formatter& out, const FQName& fqName,
@@ -294,6 +307,17 @@ struct AST {
 
     void generateInterfaceSource(Formatter& out) const;
 
+    // Number of methods with latency histograms (see hidl-gen -H): all user
+    // methods from the root of the interface, or 0 if they are not recorded.
+    size_t getLatencyHistogramCount() const;
+    void generateLatencyHistogramDeclarations(Formatter& out) const;
+    void generateLatencyHistogramSource(Formatter& out) const;
+    // Records the time since generateLatencyStart as a call to the method
+    // at the given index, on the given side of the call.
+    void generateLatencyStart(Formatter& out) const;
+    void generateLatencyRecord(Formatter& out, const std::string& side,
+                               const std::string& index) const;
+
     enum InstrumentationEvent {
         SERVER_API_ENTRY = 0,
         SERVER_API_EXIT,
@@ -321,6 +345,15 @@ struct AST {
     void declareCppReaderLocals(Formatter& out, const std::vector<NamedReference<Type>*>& arg,
                                 bool forResults) const;
 
+    // Declares _hidl_packed_args_t, the struct in which the leading
+    // arguments of method are written if it is @packed.
+    static void declarePackedArgsStruct(Formatter& out, const Method* method);
+
+    // Emits the out-of-line marshalling helpers of the structs passed to or
+    // from the methods of iface, once per type, for the proxy and stub of
+    // iface to share.
+    static void generateParcelHelpers(Formatter& out, const Interface* iface);
+
     void emitCppReaderWriter(Formatter& out, const std::string& parcelObj, bool parcelObjIsPointer,
                              const NamedReference<Type>* arg, bool isReader, Type::ErrorMode mode,
                              bool addPrefixToName) const;
@@ -333,6 +366,8 @@ struct AST {
                               const NamedReference<Type>* arg, bool isReader,
                               bool addPrefixToName) const;
 
+    void emitJavaPackedArgs(Formatter& out, const Method* method, bool isReader) const;
+
     void emitVtsTypeDeclarations(Formatter& out) const;
 
     DISALLOW_COPY_AND_ASSIGN(AST);
@@ -18,6 +18,7 @@
 
 #include <android-base/logging.h>
 #include <hidl-util/Formatter.h>
+#include <functional>
 #include <iostream>
 
 #include "ConstantExpression.h"
@@ -45,6 +46,10 @@ bool ArrayType::deepCanCheckEquality(std::unordered_set<const Type*>* visited) c
     return mElementType->canCheckEquality(visited);
 }
 
+bool ArrayType::hasUniqueObjectRepresentation() const {
+    return mElementType->hasUniqueObjectRepresentation();
+}
+
 const Type* ArrayType::getElementType() const {
     return mElementType.get();
 }
@@ -344,6 +349,74 @@ void ArrayType::emitResolveReferencesEmbedded(
     out << "}\n\n";
 }
 
+void ArrayType::emitHash(
+        Formatter &out,
+        const std::string &hashName,
+        const std::string &name,
+        size_t depth) const {
+    if (hasUniqueObjectRepresentation()) {
+        out << hashName << " = ::android::hardware::details::hidl_hash_combine(" << hashName
+            << ", ::android::hardware::details::hidl_hash_bytes(&" << name << ", sizeof("
+            << name << ")));\n";
+        return;
+    }
+
+    std::string iteratorName = "_hidl_index_" + std::to_string(depth);
+
+    out.sFor("size_t " + iteratorName + " = 0; " + iteratorName + " < " +
+                 std::to_string(dimension()) + "; ++" + iteratorName,
+             [&] {
+                 mElementType->emitHash(out, hashName, name + ".data()[" + iteratorName + "]",
+                                        depth + 1);
+             })
+        .endl();
+}
+
+void ArrayType::emitDump(
+        Formatter &out,
+        const std::string &streamName,
+        const std::string &name,
+        size_t depth) const {
+    if (!dumpsInPlace()) {
+        Type::emitDump(out, streamName, name, depth);
+        return;
+    }
+
+    // Same format as ::android::hardware::toString(const hidl_array<T, SIZES...>&).
+    std::string dimensions;
+    for (const auto* size : mSizes) {
+        dimensions += "[" + std::to_string(size->castSizeT()) + "]";
+    }
+    out << streamName << " += \"" << dimensions << "\";\n";
+
+    std::function<void(size_t, const std::string&)> emitDimension = [&](size_t dim,
+                                                                       const std::string& element) {
+        if (dim == mSizes.size()) {
+            mElementType->emitDump(out, streamName, element, depth + dim);
+            return;
+        }
+
+        std::string iteratorName = "_hidl_index_" + std::to_string(depth + dim);
+
+        out << streamName << " += \"{\";\n";
+        out.sFor("size_t " + iteratorName + " = 0; " + iteratorName + " < " +
+                     std::to_string(mSizes[dim]->castSizeT()) + "; ++" + iteratorName,
+                 [&] {
+                     out.sIf(iteratorName + " > 0", [&] {
+                         out << streamName << " += \", \";\n";
+                     }).endl();
+                     emitDimension(dim + 1, element + "[" + iteratorName + "]");
+                 })
+            .endl();
+        out << streamName << " += \"}\";\n";
+    };
+    emitDimension(0, name);
+}
+
+bool ArrayType::dumpsInPlace() const {
+    return mElementType->dumpsInPlace();
+}
+
 void ArrayType::emitJavaDump(
         Formatter &out,
         const std::string &streamName,
@@ -614,6 +687,13 @@ void ArrayType::getAlignmentAndSize(size_t *align, size_t *size) const {
     }
 }
 
+size_t ArrayType::getEmbeddedObjectCount(const std::string& name,
+                                         std::vector<std::string>* /* runtimeCounts */) const {
+    std::vector<std::string> elementRuntimeCounts;
+    return dimension() *
+           mElementType->getEmbeddedObjectCount(name + "[0]", &elementRuntimeCounts);
+}
+
 size_t ArrayType::dimension() const {
     size_t numArrayElements = 1;
     for (auto size : mSizes) {
@@ -32,6 +32,7 @@ struct ArrayType : public Type {
 
     bool isArray() const override;
     bool deepCanCheckEquality(std::unordered_set<const Type*>* visited) const override;
+    bool hasUniqueObjectRepresentation() const override;
 
     const Type* getElementType() const;
 
@@ -101,6 +102,20 @@ struct ArrayType : public Type {
             const std::string &parentName,
             const std::string &offsetText) const override;
 
+    void emitHash(
+            Formatter &out,
+            const std::string &hashName,
+            const std::string &name,
+            size_t depth) const override;
+
+    void emitDump(
+            Formatter &out,
+            const std::string &streamName,
+            const std::string &name,
+            size_t depth) const override;
+
+    bool dumpsInPlace() const override;
+
     void emitJavaDump(
             Formatter &out,
             const std::string &streamName,
@@ -137,6 +152,8 @@ struct ArrayType : public Type {
     bool deepContainsPointer(std::unordered_set<const Type*>* visited) const override;
 
     void getAlignmentAndSize(size_t *align, size_t *size) const override;
+    size_t getEmbeddedObjectCount(const std::string& name,
+                                  std::vector<std::string>* runtimeCounts) const override;
 
    private:
     Reference<Type> mElementType;
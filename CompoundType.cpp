@@ -16,12 +16,14 @@
 
 #include "CompoundType.h"
 
+#include "Annotation.h"
 #include "ArrayType.h"
 #include "ScalarType.h"
 #include "VectorType.h"
 
 #include <android-base/logging.h>
 #include <hidl-util/Formatter.h>
+#include <algorithm>
 #include <iostream>
 #include <unordered_set>
 
@@ -139,6 +141,29 @@ bool CompoundType::deepCanCheckEquality(std::unordered_set<const Type*>* visited
     return true;
 }
 
+bool CompoundType::hasUniqueObjectRepresentation() const {
+    if (mStyle != STYLE_STRUCT) {
+        return false;
+    }
+
+    size_t fieldsSize = 0;
+    for (const auto* field : *mFields) {
+        if (!field->get()->hasUniqueObjectRepresentation()) {
+            return false;
+        }
+        size_t fieldAlign, fieldSize;
+        field->get()->getAlignmentAndSize(&fieldAlign, &fieldSize);
+        fieldsSize += fieldSize;
+    }
+
+    // no padding
+    return fieldsSize == getCompoundAlignmentAndSize().overall.size;
+}
+
+bool CompoundType::dumpsInPlace() const {
+    return true;
+}
+
 std::string CompoundType::typeName() const {
     switch (mStyle) {
         case STYLE_STRUCT: {
@@ -312,6 +337,15 @@ void CompoundType::emitSafeUnionReaderWriterForInterfaces(
     }).endl();
 }
 
+void CompoundType::emitDump(
+        Formatter &out,
+        const std::string &streamName,
+        const std::string &name,
+        size_t /* depth */) const {
+    out << fqName().cppNamespace() << "::appendToString(" << streamName << ", " << name
+        << ");\n";
+}
+
 void CompoundType::emitReaderWriter(
         Formatter &out,
         const std::string &name,
@@ -398,6 +432,80 @@ void CompoundType::emitReaderWriter(
     }
 }
 
+bool CompoundType::hasParcelHelpers() const {
+    return !containsInterface() && needsEmbeddedReadWrite() && !needsResolveReferences();
+}
+
+void CompoundType::emitParcelHelpers(Formatter& out) const {
+    CHECK(hasParcelHelpers());
+
+    out << "__attribute__((noinline)) static ::android::status_t _hidl_writeToParcel(\n";
+    out.indent(2, [&] {
+        out << "const " << fullName() << "& obj, ::android::hardware::Parcel* parcel) ";
+    });
+    out.block([&] {
+        out << "::android::status_t _hidl_err;\n\n";
+        emitReaderWriter(out, "obj", "parcel", true /* parcelObjIsPointer */,
+                         false /* isReader */, ErrorMode_Return);
+        out << "return _hidl_err;\n";
+    }).endl().endl();
+
+    out << "__attribute__((noinline)) static ::android::status_t _hidl_readFromParcel(\n";
+    out.indent(2, [&] {
+        out << fullName() << "** _hidl_obj, const ::android::hardware::Parcel& parcel) ";
+    });
+    out.block([&] {
+        out << "::android::status_t _hidl_err;\n";
+        out << fullName() << "* obj;\n\n";
+        emitReaderWriter(out, "obj", "parcel", false /* parcelObjIsPointer */,
+                         true /* isReader */, ErrorMode_Return);
+        out << "*_hidl_obj = obj;\n";
+        out << "return _hidl_err;\n";
+    }).endl().endl();
+}
+
+void CompoundType::emitParcelHelperCall(
+        Formatter &out,
+        const std::string &name,
+        const std::string &parcelObj,
+        bool parcelObjIsPointer,
+        bool isReader,
+        ErrorMode mode) const {
+    if (isReader) {
+        out << "_hidl_err = _hidl_readFromParcel(&" << name << ", "
+            << (parcelObjIsPointer ? "*" : "") << parcelObj << ");\n";
+    } else {
+        out << "_hidl_err = _hidl_writeToParcel(" << name << ", "
+            << (parcelObjIsPointer ? "" : "&") << parcelObj << ");\n";
+    }
+    handleError(out, mode);
+}
+
+void CompoundType::emitBenchmarkFill(Formatter& out) const {
+    out << "static void _hidl_fill(" << fullName()
+        << "* o, size_t vectorSize, size_t stringSize) ";
+    out.block([&] {
+        if (mStyle != STYLE_SAFE_UNION) {
+            for (const auto* field : *mFields) {
+                out << "_hidl_fill(&o->" << field->name() << ", vectorSize, stringSize);\n";
+            }
+            return;
+        }
+
+        // a safe union holds one field, preferably one whose size varies
+        const auto* field = mFields->at(0);
+        for (const auto* candidate : *mFields) {
+            if (candidate->type().needsEmbeddedReadWrite()) {
+                field = candidate;
+                break;
+            }
+        }
+        out << field->type().getCppStackType() << " value{};\n";
+        out << "_hidl_fill(&value, vectorSize, stringSize);\n";
+        out << "o->" << field->name() << "(std::move(value));\n";
+    }).endl().endl();
+}
+
 void CompoundType::emitReaderWriterEmbedded(
         Formatter &out,
         size_t /* depth */,
@@ -800,19 +908,85 @@ void CompoundType::emitTypeForwardDeclaration(Formatter& out) const {
     out << " " << localName() << ";\n";
 }
 
-void CompoundType::emitPackageTypeDeclarations(Formatter& out) const {
-    Scope::emitPackageTypeDeclarations(out);
+void CompoundType::emitGlobalTypeDeclarations(Formatter& out) const {
+    Scope::emitGlobalTypeDeclarations(out);
+
+    if (!canCheckEquality()) return;
+
+    out << "namespace std {\n";
+    out << "template<>\n"
+        << "struct hash<" << fullName() << "> ";
+    out.block([&] {
+        out << "size_t operator()(" << getCppArgumentType() << " o) const;\n";
+    }) << ";\n";
+    out << "}  // namespace std\n\n";
+}
+
+void CompoundType::emitGlobalTypeHeaderDefinitions(Formatter& out, bool outOfLine) const {
+    Scope::emitGlobalTypeHeaderDefinitions(out, outOfLine);
+
+    if (!canCheckEquality()) return;
+
+    out << (outOfLine ? "" : "inline ") << "size_t std::hash<" << fullName() << ">::operator()("
+        << getCppArgumentType() << (mFields->empty() ? " /* o */" : " o") << ") const ";
+    out.block([&] {
+        if (hasUniqueObjectRepresentation()) {
+            out << "return ::android::hardware::details::hidl_hash_bytes(&o, sizeof(o));\n";
+            return;
+        }
+
+        if (mStyle == STYLE_SAFE_UNION) {
+            out << "size_t _hidl_hash = ::std::hash<" << fullName()
+                << "::hidl_discriminator>{}(o.getDiscriminator());\n";
+            out << "switch (o.getDiscriminator()) ";
+            out.block([&] {
+                for (const auto& field : *mFields) {
+                    out << "case " << fullName() << "::hidl_discriminator::" << field->name()
+                        << ": ";
+                    out.block([&] {
+                        field->type().emitHash(out, "_hidl_hash", "o." + field->name() + "()",
+                                               0 /* depth */);
+                        out << "break;\n";
+                    }).endl();
+                }
+                out << "default: ";
+                out.block([&] {
+                       emitSafeUnionUnknownDiscriminatorError(out, "o.getDiscriminator()",
+                                                              true /*fatal*/);
+                   })
+                    .endl();
+            }).endl();
+            out << "return _hidl_hash;\n";
+            return;
+        }
+
+        out << "size_t _hidl_hash = 0;\n";
+        for (const auto& field : *mFields) {
+            field->type().emitHash(out, "_hidl_hash", "o." + field->name(), 0 /* depth */);
+        }
+        out << "return _hidl_hash;\n";
+    }).endl().endl();
+}
+
+void CompoundType::emitPackageTypeDeclarations(Formatter& out, bool outOfLine) const {
+    Scope::emitPackageTypeDeclarations(out, outOfLine);
+
+    const std::string linkage = outOfLine ? "" : "static inline ";
 
-    out << "static inline std::string toString("
+    out << linkage << "void appendToString(std::string& os, "
+        << getCppArgumentType()
+        << (mFields->empty() ? "" : " o")
+        << ");\n";
+    out << linkage << "std::string toString("
         << getCppArgumentType()
         << (mFields->empty() ? "" : " o")
         << ");\n";
 
     if (canCheckEquality()) {
-        out << "static inline bool operator==("
+        out << linkage << "bool operator==("
             << getCppArgumentType() << " lhs, " << getCppArgumentType() << " rhs);\n";
 
-        out << "static inline bool operator!=("
+        out << linkage << "bool operator!=("
             << getCppArgumentType() << " lhs, " << getCppArgumentType() << " rhs);\n";
     } else {
         out << "// operator== and operator!= are not generated for " << localName() << "\n";
@@ -821,18 +995,21 @@ void CompoundType::emitPackageTypeDeclarations(Formatter& out) const {
     out.endl();
 }
 
-void CompoundType::emitPackageTypeHeaderDefinitions(Formatter& out) const {
-    Scope::emitPackageTypeHeaderDefinitions(out);
+void CompoundType::emitPackageTypeHeaderDefinitions(Formatter& out, bool outOfLine) const {
+    Scope::emitPackageTypeHeaderDefinitions(out, outOfLine);
+
+    const std::string linkage = outOfLine ? "" : "static inline ";
 
-    out << "static inline std::string toString("
+    // Nested structs, and vectors and arrays of them, are appended to the
+    // same string instead of being built separately and concatenated.
+    out << linkage << "void appendToString(std::string& os, "
         << getCppArgumentType()
         << (mFields->empty() ? "" : " o")
         << ") ";
 
     out.block([&] {
         // include toString for scalar types
-        out << "using ::android::hardware::toString;\n"
-            << "std::string os;\n";
+        out << "using ::android::hardware::toString;\n";
         out << "os += \"{\";\n";
 
         if (mStyle == STYLE_SAFE_UNION) {
@@ -851,11 +1028,14 @@ void CompoundType::emitPackageTypeHeaderDefinitions(Formatter& out) const {
                 out.block([&] {
                     out << "os += \"."
                     << field->name()
-                    << " = \";\n"
-                    << "os += toString(o."
-                    << field->name()
-                    << "());\n"
-                    << "break;\n";
+                    << " = \";\n";
+                    if (field->type().dumpsInPlace()) {
+                        field->type().emitDump(out, "os", "o." + field->name() + "()",
+                                               0 /* depth */);
+                    } else {
+                        out << "os += toString(o." << field->name() << "());\n";
+                    }
+                    out << "break;\n";
                 }).endl();
             } else {
                 out << "os += \"";
@@ -863,7 +1043,7 @@ void CompoundType::emitPackageTypeHeaderDefinitions(Formatter& out) const {
                     out << ", ";
                 }
                 out << "." << field->name() << " = \";\n";
-                field->type().emitDump(out, "os", "o." + field->name());
+                field->type().emitDump(out, "os", "o." + field->name(), 0 /* depth */);
             }
         }
 
@@ -878,11 +1058,19 @@ void CompoundType::emitPackageTypeHeaderDefinitions(Formatter& out) const {
             out.unindent();
             out << "}\n";
         }
-        out << "os += \"}\"; return os;\n";
+        out << "os += \"}\";\n";
+    }).endl().endl();
+
+    out << linkage << "std::string toString(" << getCppArgumentType() << " o) ";
+
+    out.block([&] {
+        out << "std::string os;\n";
+        out << "appendToString(os, o);\n";
+        out << "return os;\n";
     }).endl().endl();
 
     if (canCheckEquality()) {
-        out << "static inline bool operator==("
+        out << linkage << "bool operator==("
             << getCppArgumentType() << " " << (mFields->empty() ? "/* lhs */" : "lhs") << ", "
             << getCppArgumentType() << " " << (mFields->empty() ? "/* rhs */" : "rhs") << ") ";
         out.block([&] {
@@ -895,6 +1083,15 @@ void CompoundType::emitPackageTypeHeaderDefinitions(Formatter& out) const {
                 out.indent();
             }
 
+            if (hasUniqueObjectRepresentation()) {
+                // Equal iff the bytes are equal, since there is no padding.
+                out << "static_assert(sizeof(" << fullName()
+                    << ") == " << getCompoundAlignmentAndSize().overall.size
+                    << ", \"unexpected padding\");\n";
+                out << "return memcmp(&lhs, &rhs, sizeof(lhs)) == 0;\n";
+                return;
+            }
+
             for (const auto& field : *mFields) {
                 if (mStyle == STYLE_SAFE_UNION) {
                     out << "case "
@@ -931,7 +1128,7 @@ void CompoundType::emitPackageTypeHeaderDefinitions(Formatter& out) const {
             out << "return true;\n";
         }).endl().endl();
 
-        out << "static inline bool operator!=("
+        out << linkage << "bool operator!=("
             << getCppArgumentType() << " lhs, " << getCppArgumentType() << " rhs)";
         out.block([&] {
             out << "return !(lhs == rhs);\n";
@@ -1477,6 +1674,13 @@ void CompoundType::emitJavaTypeDeclarations(Formatter& out, bool atTopLevel) con
             field->emitDocComment(out);
 
             out << "public ";
+            const VectorType* primitiveArray = getJavaPrimitiveArrayField(field);
+            if (primitiveArray != nullptr) {
+                const std::string typeName = primitiveArray->getJavaPrimitiveArrayType();
+                out << typeName << " " << field->name() << " = new "
+                    << typeName.substr(0, typeName.size() - 1) << "0];\n";
+                continue;
+            }
             field->type().emitJavaFieldInitializer(out, field->name());
         }
 
@@ -1574,6 +1778,11 @@ void CompoundType::emitJavaTypeDeclarations(Formatter& out, bool atTopLevel) con
                     out << ", ";
                 }
                 out << "." << field->name() << " = \");\n";
+                if (getJavaPrimitiveArrayField(field) != nullptr) {
+                    out << "builder.append(java.util.Arrays.toString(this." << field->name()
+                        << "));\n";
+                    continue;
+                }
                 field->type().emitJavaDump(out, "builder", "this." + field->name());
             }
         }
@@ -1712,9 +1921,16 @@ void CompoundType::emitJavaTypeDeclarations(Formatter& out, bool atTopLevel) con
                 field->type().getAlignmentAndSize(&fieldAlign, &fieldSize);
 
                 offset += Layout::getPad(offset, fieldAlign);
-                field->type().emitJavaFieldReaderWriter(
-                    out, 0 /* depth */, "parcel", "_hidl_blob", field->name(),
-                    "_hidl_offset + " + std::to_string(offset), true /* isReader */);
+                const VectorType* primitiveArray = getJavaPrimitiveArrayField(field);
+                if (primitiveArray != nullptr) {
+                    primitiveArray->emitJavaPrimitiveArrayFieldReaderWriter(
+                        out, "parcel", "_hidl_blob", field->name(),
+                        "_hidl_offset + " + std::to_string(offset), true /* isReader */);
+                } else {
+                    field->type().emitJavaFieldReaderWriter(
+                        out, 0 /* depth */, "parcel", "_hidl_blob", field->name(),
+                        "_hidl_offset + " + std::to_string(offset), true /* isReader */);
+                }
                 offset += fieldSize;
             }
         }
@@ -1843,9 +2059,16 @@ void CompoundType::emitJavaTypeDeclarations(Formatter& out, bool atTopLevel) con
                 field->type().getAlignmentAndSize(&fieldAlign, &fieldSize);
 
                 offset += Layout::getPad(offset, fieldAlign);
-                field->type().emitJavaFieldReaderWriter(
-                    out, 0 /* depth */, "parcel", "_hidl_blob", field->name(),
-                    "_hidl_offset + " + std::to_string(offset), false /* isReader */);
+                const VectorType* primitiveArray = getJavaPrimitiveArrayField(field);
+                if (primitiveArray != nullptr) {
+                    primitiveArray->emitJavaPrimitiveArrayFieldReaderWriter(
+                        out, "parcel", "_hidl_blob", field->name(),
+                        "_hidl_offset + " + std::to_string(offset), false /* isReader */);
+                } else {
+                    field->type().emitJavaFieldReaderWriter(
+                        out, 0 /* depth */, "parcel", "_hidl_blob", field->name(),
+                        "_hidl_offset + " + std::to_string(offset), false /* isReader */);
+                }
                 offset += fieldSize;
             }
         }
@@ -2190,6 +2413,39 @@ void CompoundType::getAlignmentAndSize(size_t *align, size_t *size) const {
     *size = layout.overall.size;
 }
 
+size_t CompoundType::getEmbeddedObjectCount(const std::string& name,
+                                            std::vector<std::string>* runtimeCounts) const {
+    size_t count = 0;
+    for (const auto* field : *mFields) {
+        if (mStyle == STYLE_STRUCT) {
+            count += field->type().getEmbeddedObjectCount(name + "." + field->name(),
+                                                          runtimeCounts);
+        } else {
+            // Only one field is written, but which one is not known here.
+            std::vector<std::string> fieldRuntimeCounts;
+            count = std::max(count, field->type().getEmbeddedObjectCount(
+                                        name + "." + field->name() + "()", &fieldRuntimeCounts));
+        }
+    }
+    return count;
+}
+
+const VectorType* CompoundType::getJavaPrimitiveArrayField(
+    const NamedReference<Type>* field) const {
+    if (mStyle != STYLE_STRUCT || !field->type().isVector()) {
+        return nullptr;
+    }
+    const bool unboxed =
+        std::any_of(annotations().begin(), annotations().end(),
+                    [](const Annotation* annotation) { return annotation->name() == "unboxed"; });
+    if (!unboxed) {
+        return nullptr;
+    }
+
+    const auto* vector = static_cast<const VectorType*>(&field->type());
+    return vector->canBeJavaPrimitiveArray() ? vector : nullptr;
+}
+
 CompoundType::CompoundLayout CompoundType::getCompoundAlignmentAndSize() const {
     CompoundLayout compoundLayout;
 
@@ -25,6 +25,8 @@
 
 namespace android {
 
+struct VectorType;
+
 struct CompoundType : public Scope {
     enum Style {
         STYLE_STRUCT,
@@ -42,6 +44,8 @@ struct CompoundType : public Scope {
     bool isCompoundType() const override;
 
     bool deepCanCheckEquality(std::unordered_set<const Type*>* visited) const override;
+    bool hasUniqueObjectRepresentation() const override;
+    bool dumpsInPlace() const override;
 
     std::string typeName() const override;
 
@@ -66,6 +70,12 @@ struct CompoundType : public Scope {
             bool isReader,
             ErrorMode mode) const override;
 
+    void emitDump(
+            Formatter &out,
+            const std::string &streamName,
+            const std::string &name,
+            size_t depth) const override;
+
     void emitReaderWriterEmbedded(
             Formatter &out,
             size_t depth,
@@ -124,8 +134,10 @@ struct CompoundType : public Scope {
 
     void emitTypeDeclarations(Formatter& out) const override;
     void emitTypeForwardDeclaration(Formatter& out) const override;
-    void emitPackageTypeDeclarations(Formatter& out) const override;
-    void emitPackageTypeHeaderDefinitions(Formatter& out) const override;
+    void emitGlobalTypeDeclarations(Formatter& out) const override;
+    void emitGlobalTypeHeaderDefinitions(Formatter& out, bool outOfLine) const override;
+    void emitPackageTypeDeclarations(Formatter& out, bool outOfLine) const override;
+    void emitPackageTypeHeaderDefinitions(Formatter& out, bool outOfLine) const override;
     void emitPackageHwDeclarations(Formatter& out) const override;
 
     void emitTypeDefinitions(Formatter& out, const std::string& prefix) const override;
@@ -143,8 +155,31 @@ struct CompoundType : public Scope {
     bool deepContainsPointer(std::unordered_set<const Type*>* visited) const override;
 
     void getAlignmentAndSize(size_t *align, size_t *size) const override;
+    size_t getEmbeddedObjectCount(const std::string& name,
+                                  std::vector<std::string>* runtimeCounts) const override;
 
     bool containsInterface() const;
+
+    // Whether values of this type can be marshalled as top-level arguments
+    // through the out-of-line helpers emitted by emitParcelHelpers, which
+    // only pays off for types with embedded objects.
+    bool hasParcelHelpers() const;
+    // Emits _hidl_writeToParcel and _hidl_readFromParcel for this type, as
+    // static functions of the file they are emitted into.
+    void emitParcelHelpers(Formatter& out) const;
+    // Same as emitReaderWriter, through the helpers above.
+    void emitParcelHelperCall(
+            Formatter &out,
+            const std::string &name,
+            const std::string &parcelObj,
+            bool parcelObjIsPointer,
+            bool isReader,
+            ErrorMode mode) const;
+
+    // Emits _hidl_fill for this type, with which -Lbenchmark builds sample
+    // values whose vectors and strings have the given sizes.
+    void emitBenchmarkFill(Formatter& out) const;
+
 private:
 
     struct Layout {
@@ -195,6 +230,10 @@ private:
 
     std::vector<SafeUnionEnumElement> getSafeUnionEnumElements(bool useCppTypeName) const;
 
+    // Non-null for the vector fields @unboxed represents as primitive
+    // arrays in Java.
+    const VectorType* getJavaPrimitiveArrayField(const NamedReference<Type>* field) const;
+
     CompoundLayout getCompoundAlignmentAndSize() const;
     void emitPaddingZero(Formatter& out, size_t offset, size_t size) const;
 
@@ -547,67 +547,70 @@ std::vector<const Reference<Type>*> ConstantExpression::getTypeReferences() cons
     return {};
 }
 
-status_t ConstantExpression::recursivePass(const std::function<status_t(ConstantExpression*)>& func,
-                                           std::unordered_set<const ConstantExpression*>* visited,
-                                           bool processBeforeDependencies) {
-    if (mIsPostParseCompleted) return OK;
-
-    if (visited->find(this) != visited->end()) return OK;
-    visited->insert(this);
-
-    if (processBeforeDependencies) {
-        status_t err = func(this);
-        if (err != OK) return err;
-    }
+const std::vector<ConstantExpression::Dependency>& ConstantExpression::getDependencies() const {
+    if (mDependenciesComputed) return mDependencies;
 
-    for (auto* nextCE : getConstantExpressions()) {
-        status_t err = nextCE->recursivePass(func, visited, processBeforeDependencies);
-        if (err != OK) return err;
+    for (const auto* nextCE : getConstantExpressions()) {
+        mDependencies.push_back({const_cast<ConstantExpression*>(nextCE), nullptr});
     }
 
-    for (auto* nextRef : getReferences()) {
+    for (const auto* nextRef : getReferences()) {
         auto* nextCE = nextRef->shallowGet()->constExpr();
         CHECK(nextCE != nullptr) << "Local identifier is not a constant expression";
-        status_t err = nextCE->recursivePass(func, visited, processBeforeDependencies);
-        if (err != OK) return err;
+        mDependencies.push_back({nextCE, nextRef});
     }
 
-    if (!processBeforeDependencies) {
-        status_t err = func(this);
-        if (err != OK) return err;
-    }
+    mDependenciesComputed = true;
+    return mDependencies;
+}
 
-    return OK;
+status_t ConstantExpression::recursivePass(const std::function<status_t(ConstantExpression*)>& func,
+                                           std::unordered_set<const ConstantExpression*>* visited,
+                                           bool processBeforeDependencies) {
+    return static_cast<const ConstantExpression*>(this)->recursivePass(
+        [&](const ConstantExpression* ce) { return func(const_cast<ConstantExpression*>(ce)); },
+        visited, processBeforeDependencies);
 }
 
 status_t ConstantExpression::recursivePass(
     const std::function<status_t(const ConstantExpression*)>& func,
     std::unordered_set<const ConstantExpression*>* visited, bool processBeforeDependencies) const {
-    if (mIsPostParseCompleted) return OK;
+    // Expressions being visited, with the index of the next dependency to visit.
+    std::vector<std::pair<const ConstantExpression*, size_t>> stack;
 
-    if (visited->find(this) != visited->end()) return OK;
-    visited->insert(this);
+    auto enter = [&](const ConstantExpression* ce) -> status_t {
+        if (ce->mIsPostParseCompleted) return OK;
 
-    if (processBeforeDependencies) {
-        status_t err = func(this);
-        if (err != OK) return err;
-    }
+        if (!visited->insert(ce).second) return OK;
 
-    for (const auto* nextCE : getConstantExpressions()) {
-        status_t err = nextCE->recursivePass(func, visited, processBeforeDependencies);
-        if (err != OK) return err;
-    }
+        if (processBeforeDependencies) {
+            status_t err = func(ce);
+            if (err != OK) return err;
+        }
 
-    for (const auto* nextRef : getReferences()) {
-        const auto* nextCE = nextRef->shallowGet()->constExpr();
-        CHECK(nextCE != nullptr) << "Local identifier is not a constant expression";
-        status_t err = nextCE->recursivePass(func, visited, processBeforeDependencies);
-        if (err != OK) return err;
-    }
+        stack.emplace_back(ce, 0);
+        return OK;
+    };
+
+    status_t err = enter(this);
+    if (err != OK) return err;
 
-    if (!processBeforeDependencies) {
-        status_t err = func(this);
-        if (err != OK) return err;
+    while (!stack.empty()) {
+        const ConstantExpression* ce = stack.back().first;
+        const auto& dependencies = ce->getDependencies();
+
+        if (stack.back().second < dependencies.size()) {
+            err = enter(dependencies[stack.back().second++].constExpr);
+            if (err != OK) return err;
+            continue;
+        }
+
+        stack.pop_back();
+
+        if (!processBeforeDependencies) {
+            err = func(ce);
+            if (err != OK) return err;
+        }
     }
 
     return OK;
@@ -624,53 +627,66 @@ ConstantExpression::CheckAcyclicStatus::CheckAcyclicStatus(
 ConstantExpression::CheckAcyclicStatus ConstantExpression::checkAcyclic(
     std::unordered_set<const ConstantExpression*>* visited,
     std::unordered_set<const ConstantExpression*>* stack) const {
-    if (stack->find(this) != stack->end()) {
-        CHECK(isReferenceConstantExpression())
-            << "Only reference constant expression could be the cycle end";
+    // Current path, with the index of the next dependency to visit.
+    std::vector<std::pair<const ConstantExpression*, size_t>> path;
 
-        std::cerr << "ERROR: Cyclic declaration:\n";
-        return CheckAcyclicStatus(UNKNOWN_ERROR, this,
-                                  static_cast<const ReferenceConstantExpression*>(this));
-    }
+    auto enter = [&](const ConstantExpression* ce) -> CheckAcyclicStatus {
+        if (stack->find(ce) != stack->end()) {
+            CHECK(ce->isReferenceConstantExpression())
+                << "Only reference constant expression could be the cycle end";
 
-    if (visited->find(this) != visited->end()) return CheckAcyclicStatus(OK);
-    visited->insert(this);
-    stack->insert(this);
+            std::cerr << "ERROR: Cyclic declaration:\n";
+            return CheckAcyclicStatus(UNKNOWN_ERROR, ce,
+                                      static_cast<const ReferenceConstantExpression*>(ce));
+        }
 
-    for (const auto* nextCE : getConstantExpressions()) {
-        auto err = nextCE->checkAcyclic(visited, stack);
-        if (err.status != OK) {
-            return err;
+        if (!visited->insert(ce).second) return CheckAcyclicStatus(OK);
+        stack->insert(ce);
+        path.emplace_back(ce, 0);
+        return CheckAcyclicStatus(OK);
+    };
+
+    CheckAcyclicStatus err = enter(this);
+
+    while (err.status == OK && !path.empty()) {
+        const ConstantExpression* ce = path.back().first;
+        const auto& dependencies = ce->getDependencies();
+
+        if (path.back().second < dependencies.size()) {
+            err = enter(dependencies[path.back().second++].constExpr);
+            continue;
         }
+
+        CHECK(stack->find(ce) != stack->end());
+        stack->erase(ce);
+        path.pop_back();
     }
 
-    for (const auto* nextRef : getReferences()) {
-        const auto* nextCE = nextRef->shallowGet()->constExpr();
-        CHECK(nextCE != nullptr) << "Local identifier is not a constant expression";
-        auto err = nextCE->checkAcyclic(visited, stack);
+    // Unwind the path, printing the cycle until its end is reached.
+    while (err.status != OK && !path.empty()) {
+        const ConstantExpression* ce = path.back().first;
+        const Dependency& dependency = ce->getDependencies()[path.back().second - 1];
+        path.pop_back();
 
-        if (err.status != OK) {
-            if (err.cycleEnd == nullptr) return err;
+        if (dependency.reference == nullptr || err.cycleEnd == nullptr) continue;
 
-            // Only ReferenceConstantExpression has references,
-            CHECK(isReferenceConstantExpression())
-                << "Only reference constant expression could have refereneces";
+        // Only ReferenceConstantExpression has references,
+        CHECK(ce->isReferenceConstantExpression())
+            << "Only reference constant expression could have refereneces";
 
-            // mExpr is defined explicitly before evaluation
-            std::cerr << "  '" << err.lastReference->mExpr << "' in '" << mExpr << "' at "
-                      << nextRef->location() << "\n";
+        // mExpr is defined explicitly before evaluation
+        std::cerr << "  '" << err.lastReference->mExpr << "' in '" << ce->mExpr << "' at "
+                  << dependency.reference->location() << "\n";
 
-            if (err.cycleEnd == this) {
-                return CheckAcyclicStatus(err.status);
-            }
-            return CheckAcyclicStatus(err.status, err.cycleEnd,
-                                      static_cast<const ReferenceConstantExpression*>(this));
+        if (err.cycleEnd == ce) {
+            err = CheckAcyclicStatus(err.status);
+        } else {
+            err = CheckAcyclicStatus(err.status, err.cycleEnd,
+                                     static_cast<const ReferenceConstantExpression*>(ce));
         }
     }
 
-    CHECK(stack->find(this) != stack->end());
-    stack->erase(this);
-    return CheckAcyclicStatus(OK);
+    return err;
 }
 
 void ConstantExpression::setPostParseCompleted() {
@@ -53,6 +53,8 @@ struct ConstantExpression {
     // Proceeds recursive pass
     // Makes sure to visit each node only once
     // Used to provide lookup and lazy evaluation
+    // The dependency graph is walked with an explicit stack, so arbitrarily
+    // long chains (e.g. auto-filled enum values) do not grow the call stack.
     status_t recursivePass(const std::function<status_t(ConstantExpression*)>& func,
                            std::unordered_set<const ConstantExpression*>* visited,
                            bool processBeforeDependencies);
@@ -93,7 +95,7 @@ struct ConstantExpression {
     };
 
     // Recursive tree pass that ensures that constant expressions definitions
-    // are acyclic.
+    // are acyclic. Like recursivePass, this is implemented with a worklist.
     CheckAcyclicStatus checkAcyclic(std::unordered_set<const ConstantExpression*>* visited,
                                     std::unordered_set<const ConstantExpression*>* stack) const;
 
@@ -146,6 +148,22 @@ struct ConstantExpression {
 
     bool mIsPostParseCompleted = false;
 
+    // Direct dependency of an expression: either a subexpression or the
+    // expression behind a local identifier.
+    struct Dependency {
+        ConstantExpression* constExpr;
+        // Set iff the dependency is reached through a reference.
+        const Reference<LocalIdentifier>* reference;
+    };
+
+    /*
+     * Memoized list of subexpressions followed by referenced expressions.
+     * Must only be called once all references are resolved.
+     */
+    const std::vector<Dependency>& getDependencies() const;
+    mutable std::vector<Dependency> mDependencies;
+    mutable bool mDependenciesComputed = false;
+
     /*
      * Helper function, gives suffix comment to add to value/cppValue/javaValue
      */
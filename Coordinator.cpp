@@ -77,6 +77,46 @@ void Coordinator::setOwner(const std::string& owner) {
     mOwner = owner;
 }
 
+void Coordinator::setReuseJavaParcels(bool value) {
+    mReuseJavaParcels = value;
+}
+
+bool Coordinator::reuseJavaParcels() const {
+    return mReuseJavaParcels;
+}
+
+void Coordinator::setEmitLatencyHistograms(bool value) {
+    mEmitLatencyHistograms = value;
+}
+
+bool Coordinator::emitLatencyHistograms() const {
+    return mEmitLatencyHistograms;
+}
+
+void Coordinator::setOptimizeSize(bool value) {
+    mOptimizeSize = value;
+}
+
+bool Coordinator::optimizeSize() const {
+    return mOptimizeSize;
+}
+
+void Coordinator::setOutOfLineTypeDefinitions(bool value) {
+    mOutOfLineTypeDefinitions = value;
+}
+
+bool Coordinator::outOfLineTypeDefinitions() const {
+    return mOutOfLineTypeDefinitions;
+}
+
+void Coordinator::setForwardDeclareInterfaces(bool value) {
+    mForwardDeclareInterfaces = value;
+}
+
+bool Coordinator::forwardDeclareInterfaces() const {
+    return mForwardDeclareInterfaces;
+}
+
 status_t Coordinator::addPackagePath(const std::string& root, const std::string& path, std::string* error) {
     FQName package = FQName(root, "0.0", "");
     for (const PackageRoot &packageRoot : mPackageRoots) {
@@ -167,6 +207,8 @@ status_t Coordinator::getFilepath(const FQName& fqName, Location location,
 }
 
 void Coordinator::onFileAccess(const std::string& path, const std::string& mode) const {
+    std::lock_guard<std::recursive_mutex> lock(mMutex);
+
     if (mode == "r") {
         // This is a global list. It's not cleared when a second fqname is processed for
         // two reasons:
@@ -190,6 +232,8 @@ status_t Coordinator::writeDepFile(const std::string& forFile) const {
 
     onFileAccess(mDepFile, "w");
 
+    std::lock_guard<std::recursive_mutex> lock(mMutex);
+
     FILE* file = fopen(mDepFile.c_str(), "w");
     if (file == nullptr) {
         fprintf(stderr, "ERROR: could not open dep file at %s.\n", mDepFile.c_str());
@@ -222,6 +266,10 @@ status_t Coordinator::parseOptional(const FQName& fqName, AST** ast, std::set<AS
                                     Enforce enforcement) const {
     CHECK(fqName.isFullyQualified());
 
+    *ast = nullptr;
+
+    std::lock_guard<std::recursive_mutex> lock(mMutex);
+
     auto it = mCache.find(fqName);
     if (it != mCache.end()) {
         *ast = (*it).second;
@@ -260,7 +308,7 @@ status_t Coordinator::parseOptional(const FQName& fqName, AST** ast, std::set<AS
 
     const std::string path = makeAbsolute(packagePath + fqName.name() + ".hal");
 
-    *ast = new AST(this, &Hash::getHash(path));
+    *ast = new AST(this, &mHashCache.getHash(path));
 
     if (typesAST != nullptr) {
         // If types.hal for this AST's package existed, make it's defined
@@ -268,7 +316,14 @@ status_t Coordinator::parseOptional(const FQName& fqName, AST** ast, std::set<AS
         (*ast)->addImportedAST(typesAST);
     }
 
-    std::unique_ptr<FILE, std::function<void(FILE*)>> file(fopen(path.c_str(), "rb"), fclose);
+    std::unique_ptr<FILE, std::function<void(FILE*)>> file(nullptr, fclose);
+    auto contents = mFileContents.find(path);
+    if (contents != mFileContents.end()) {
+        file.reset(fmemopen(const_cast<char*>(contents->second.data()), contents->second.size(),
+                            "rb"));
+    } else {
+        file.reset(fopen(path.c_str(), "rb"));
+    }
 
     if (file == nullptr) {
         mCache.erase(fqName);  // nullptr in cache is used to find circular imports
@@ -288,43 +343,33 @@ status_t Coordinator::parseOptional(const FQName& fqName, AST** ast, std::set<AS
 
     if ((*ast)->package().package() != fqName.package() ||
         (*ast)->package().version() != fqName.version()) {
-        fprintf(stderr,
-                "ERROR: File at '%s' does not match expected package and/or "
-                "version.\n",
-                path.c_str());
+        std::cerr << "ERROR: File at '" << path << "' does not match expected package and/or "
+                  << "version." << std::endl;
 
         err = UNKNOWN_ERROR;
     } else {
         if ((*ast)->isInterface()) {
             if (fqName.name() == "types") {
-                fprintf(stderr,
-                        "ERROR: File at '%s' declares an interface '%s' "
-                        "instead of the expected types common to the package.\n",
-                        path.c_str(), (*ast)->getInterface()->localName().c_str());
+                std::cerr << "ERROR: File at '" << path << "' declares an interface '"
+                          << (*ast)->getInterface()->localName()
+                          << "' instead of the expected types common to the package."
+                          << std::endl;
 
                 err = UNKNOWN_ERROR;
             } else if ((*ast)->getInterface()->localName() != fqName.name()) {
-                fprintf(stderr,
-                        "ERROR: File at '%s' does not declare interface type "
-                        "'%s'.\n",
-                        path.c_str(),
-                        fqName.name().c_str());
+                std::cerr << "ERROR: File at '" << path << "' does not declare interface type '"
+                          << fqName.name() << "'." << std::endl;
 
                 err = UNKNOWN_ERROR;
             }
         } else if (fqName.name() != "types") {
-            fprintf(stderr,
-                    "ERROR: File at '%s' declares types rather than the "
-                    "expected interface type '%s'.\n",
-                    path.c_str(),
-                    fqName.name().c_str());
+            std::cerr << "ERROR: File at '" << path << "' declares types rather than the "
+                      << "expected interface type '" << fqName.name() << "'." << std::endl;
 
             err = UNKNOWN_ERROR;
         } else if ((*ast)->definesInterfaces()) {
-            fprintf(stderr,
-                    "ERROR: types.hal file at '%s' declares at least one "
-                    "interface type.\n",
-                    path.c_str());
+            std::cerr << "ERROR: types.hal file at '" << path << "' declares at least one "
+                      << "interface type." << std::endl;
 
             err = UNKNOWN_ERROR;
         }
@@ -439,6 +484,94 @@ status_t Coordinator::getPackagePath(const FQName& fqName, bool relative, bool s
     return OK;
 }
 
+status_t Coordinator::getFQNameForPath(const std::string& path, FQName* fqName) const {
+    static const std::string kSuffix = ".hal";
+    if (!StringHelper::EndsWith(path, kSuffix)) return UNKNOWN_ERROR;
+
+    for (const PackageRoot& packageRoot : mPackageRoots) {
+        const std::string rootPath =
+            makeAbsolute(StringHelper::RTrimAll(packageRoot.path, "/")) + "/";
+        if (!StringHelper::StartsWith(path, rootPath)) continue;
+
+        // Given a path of "hardware/interfaces/nfc/1.0/INfc.hal" and a root
+        // path of "hardware/interfaces/", components are ["nfc", "1.0", "INfc"].
+        std::vector<std::string> components;
+        const std::string relativePath =
+            StringHelper::RTrim(StringHelper::LTrim(path, rootPath), kSuffix);
+        StringHelper::SplitString(relativePath, '/', &components);
+        if (components.size() < 2) continue;
+
+        const std::string name = components.back();
+        components.pop_back();
+        const std::string version = components.back();
+        components.pop_back();
+        components.insert(components.begin(), packageRoot.root.package());
+
+        FQName result;
+        if (!result.setTo(StringHelper::JoinStrings(components, ".") + "@" + version + "::" +
+                          name)) {
+            continue;
+        }
+
+        *fqName = result;
+        return OK;
+    }
+
+    return UNKNOWN_ERROR;
+}
+
+void Coordinator::setFileContents(const std::string& path, const std::string& contents) {
+    std::lock_guard<std::recursive_mutex> lock(mMutex);
+    mFileContents[path] = contents;
+}
+
+void Coordinator::clearFileContents(const std::string& path) {
+    std::lock_guard<std::recursive_mutex> lock(mMutex);
+    mFileContents.erase(path);
+}
+
+void Coordinator::invalidate(const FQName& fqName, std::set<FQName>* invalidated) {
+    std::lock_guard<std::recursive_mutex> lock(mMutex);
+
+    std::set<AST*> dropped;
+
+    auto drop = [&](std::map<FQName, AST*>::iterator it) {
+        if (it->second != nullptr) dropped.insert(it->second);
+        mPackagesEnforced.erase(it->first.getPackageAndVersion());
+        if (invalidated != nullptr) invalidated->insert(it->first);
+        return mCache.erase(it);
+    };
+
+    // Failed parses carry no import information, so they are always retried.
+    for (auto it = mCache.begin(); it != mCache.end();) {
+        it = it->second == nullptr ? drop(it) : std::next(it);
+    }
+
+    auto it = mCache.find(fqName);
+    if (it != mCache.end()) drop(it);
+    mPackagesEnforced.erase(fqName.getPackageAndVersion());
+
+    bool changed = !dropped.empty();
+    while (changed) {
+        changed = false;
+        for (auto it = mCache.begin(); it != mCache.end();) {
+            const std::set<AST*>& imported = it->second->getImportedASTs();
+            bool importsDropped = std::any_of(imported.begin(), imported.end(),
+                                              [&](AST* ast) { return dropped.count(ast) > 0; });
+            if (importsDropped) {
+                it = drop(it);
+                changed = true;
+            } else {
+                it++;
+            }
+        }
+    }
+
+    for (AST* ast : dropped) {
+        delete ast;
+    }
+}
+
 status_t Coordinator::getPackageInterfaceFiles(
         const FQName &package,
         std::vector<std::string> *fileNames) const {
@@ -453,8 +586,9 @@ status_t Coordinator::getPackageInterfaceFiles(
     std::unique_ptr<DIR, decltype(&closedir)> dir(opendir(path.c_str()), closedir);
 
     if (dir == nullptr) {
-        fprintf(stderr, "ERROR: Could not open package path %s for package %s:\n%s\n",
-                packagePath.c_str(), package.string().c_str(), path.c_str());
+        std::cerr << "ERROR: Could not open package path " << packagePath << " for package "
+                  << package.string() << ":\n"
+                  << path << std::endl;
         return -errno;
     }
 
@@ -469,7 +603,7 @@ status_t Coordinator::getPackageInterfaceFiles(
             struct stat sb;
             const auto filename = packagePath + std::string(ent->d_name);
             if (stat(filename.c_str(), &sb) == -1) {
-                fprintf(stderr, "ERROR: Could not stat %s\n", filename.c_str());
+                std::cerr << "ERROR: Could not stat " << filename << std::endl;
                 return -errno;
             }
             if ((sb.st_mode & S_IFMT) != S_IFREG) {
@@ -634,6 +768,8 @@ status_t Coordinator::enforceRestrictionsOnPackage(const FQName& fqName,
         return OK;
     }
 
+    std::lock_guard<std::recursive_mutex> lock(mMutex);
+
     FQName package = fqName.getPackageAndVersion();
     // look up cache.
     if (mPackagesEnforced.find(package) != mPackagesEnforced.end()) {
@@ -810,7 +946,7 @@ Coordinator::HashStatus Coordinator::checkHash(const FQName& fqName) const {
     std::string error;
     bool fileExists;
     std::vector<std::string> frozen =
-        Hash::lookupHash(hashPath, fqName.string(), &error, &fileExists);
+        mHashCache.lookupHash(hashPath, fqName.string(), &error, &fileExists);
     if (fileExists) onFileAccess(hashPath, "r");
 
     if (error.size() > 0) {
@@ -821,7 +957,7 @@ Coordinator::HashStatus Coordinator::checkHash(const FQName& fqName) const {
     // hash not defined, interface not frozen
     if (frozen.size() == 0) {
         // This ensures that it can be detected.
-        Hash::clearHash(ast->getFilename());
+        mHashCache.clearHash(ast->getFilename());
 
         return HashStatus::UNFROZEN;
     }
@@ -19,10 +19,12 @@
 #define COORDINATOR_H_
 
 #include <android-base/macros.h>
+#include <hidl-hash/Hash.h>
 #include <hidl-util/FQName.h>
 #include <hidl-util/Formatter.h>
 #include <utils/Errors.h>
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
@@ -32,6 +34,19 @@ namespace android {
 struct AST;
 struct Type;
 
+// Coordinators are independent of each other: all caches (parsed ASTs,
+// enforced packages, file hashes) are per-instance.
+//
+// Once configured (root path, package paths, output options), a Coordinator
+// may be shared between threads. Calls which fill or drop its caches (parse,
+// parseOptional, enforceRestrictionsOnPackage, invalidate, ...) are
+// serialized on an internal lock, so tools which want to parse in parallel
+// should use one Coordinator per thread. The configuration setters are not
+// synchronized and must not be called concurrently with anything else.
+//
+// ASTs returned by parse() are owned by the Coordinator and are not modified
+// after being returned, except through invalidate(), which deletes them and
+// must not race with their users.
 struct Coordinator {
     Coordinator() {};
 
@@ -47,6 +62,29 @@ struct Coordinator {
     const std::string& getOwner() const;
     void setOwner(const std::string& owner);
 
+    // Whether generated Java proxies reuse their reply parcels.
+    void setReuseJavaParcels(bool value);
+    bool reuseJavaParcels() const;
+
+    // Whether generated C++ code records per-method latency histograms.
+    void setEmitLatencyHistograms(bool value);
+    bool emitLatencyHistograms() const;
+
+    // Whether generated C++ proxies and stubs share out-of-line marshalling
+    // code between methods instead of expanding it for every argument.
+    void setOptimizeSize(bool value);
+    bool optimizeSize() const;
+
+    // Whether the definitions of toString, operator== and the like of types
+    // are generated in the C++ sources rather than inline in the headers.
+    void setOutOfLineTypeDefinitions(bool value);
+    bool outOfLineTypeDefinitions() const;
+
+    // Whether interface headers include the forward declaration headers of
+    // imported interfaces which they only pass to or return from methods.
+    void setForwardDeclareInterfaces(bool value);
+    bool forwardDeclareInterfaces() const;
+
     // adds path only if it doesn't exist
     status_t addPackagePath(const std::string& root, const std::string& path, std::string* error);
     // adds path if it hasn't already been added
@@ -110,6 +148,21 @@ struct Coordinator {
     // return "android.hardware".
     status_t getPackageRoot(const FQName& fqName, std::string* root) const;
 
+    // Reverse of getPackagePath: given the path of a .hal file, e.x.
+    // "hardware/interfaces/nfc/1.0/INfc.hal", finds its FQName
+    // "android.hardware.nfc@1.0::INfc".
+    status_t getFQNameForPath(const std::string& path, FQName* fqName) const;
+
+    // Makes parse() read the given contents instead of the file at path (e.x.
+    // an unsaved editor buffer). ASTs already in the cache are not affected.
+    void setFileContents(const std::string& path, const std::string& contents);
+    void clearFileContents(const std::string& path);
+
+    // Drops the cached AST for fqName along with every cached AST which
+    // (transitively) imports it, so that they are parsed again on the next
+    // parse() call. Dropped names are appended to "invalidated" if non-NULL.
+    void invalidate(const FQName& fqName, std::set<FQName>* invalidated = nullptr);
+
     status_t getPackageInterfaceFiles(
             const FQName &package,
             std::vector<std::string> *fileNames) const;
@@ -172,6 +225,14 @@ private:
     // hidl-gen options
     bool mVerbose = false;
     std::string mOwner;
+    bool mReuseJavaParcels = false;
+    bool mEmitLatencyHistograms = false;
+    bool mOptimizeSize = false;
+    bool mOutOfLineTypeDefinitions = false;
+    bool mForwardDeclareInterfaces = false;
+
+    // guards all of the mutable state below
+    mutable std::recursive_mutex mMutex;
 
     // cache to parse().
     mutable std::map<FQName, AST *> mCache;
@@ -181,6 +242,11 @@ private:
 
     mutable std::set<std::string> mReadFiles;
 
+    // absolute path -> contents overriding the file on disk
+    std::map<std::string, std::string> mFileContents;
+
+    mutable HashCache mHashCache;
+
     // Returns the given path if it is absolute, otherwise it returns
     // the path relative to mRootPath
     std::string makeAbsolute(const std::string& string) const;
@@ -17,8 +17,10 @@
 #include "EnumType.h"
 
 #include <hidl-util/Formatter.h>
+#include <hidl-util/StringHelper.h>
 #include <inttypes.h>
 #include <iostream>
+#include <set>
 #include <unordered_map>
 
 #include "Annotation.h"
@@ -163,6 +165,10 @@ bool EnumType::deepCanCheckEquality(std::unordered_set<const Type*>* /* visited
     return true;
 }
 
+bool EnumType::hasUniqueObjectRepresentation() const {
+    return resolveToScalarType()->hasUniqueObjectRepresentation();
+}
+
 std::string EnumType::getCppType(StorageMode,
                                  bool /* specifyNamespaces */) const {
     return fullName();
@@ -386,11 +392,18 @@ void EnumType::emitGlobalTypeDeclarations(Formatter& out) const {
     out << "}  // namespace android\n\n";
 }
 
-void EnumType::emitPackageTypeDeclarations(Formatter& out) const {
+void EnumType::emitPackageTypeDeclarations(Formatter& out, bool outOfLine) const {
+    const std::string linkage = outOfLine ? "" : "static inline ";
+
     out << "template<typename>\n"
-        << "static inline std::string toString(" << resolveToScalarType()->getCppArgumentType()
+        << linkage << "std::string toString(" << resolveToScalarType()->getCppArgumentType()
         << " o);\n";
-    out << "static inline std::string toString(" << getCppArgumentType() << " o);\n\n";
+    if (outOfLine) {
+        out << "template<>\n"
+            << "std::string toString<" << getCppStackType() << ">("
+            << resolveToScalarType()->getCppArgumentType() << " o);\n";
+    }
+    out << linkage << "std::string toString(" << getCppArgumentType() << " o);\n\n";
 
     emitEnumBitwiseOperator(out, true  /* lhsIsEnum */, true  /* rhsIsEnum */, "|");
     emitEnumBitwiseOperator(out, false /* lhsIsEnum */, true  /* rhsIsEnum */, "|");
@@ -405,35 +418,120 @@ void EnumType::emitPackageTypeDeclarations(Formatter& out) const {
     out.endl();
 }
 
-void EnumType::emitPackageTypeHeaderDefinitions(Formatter& out) const {
+// If every non-zero value is a distinct single bit, declared in ascending
+// order after all zero values, returns true and the names of the zero values
+// and of each bit (empty for unused bits).
+static bool getSingleBitNames(const std::vector<EnumValue*>& values, const ScalarType* scalarType,
+                              std::vector<std::string>* zeroNames,
+                              std::vector<std::string>* bitNames) {
+    size_t align, size;
+    scalarType->getAlignmentAndSize(&align, &size);
+    const uint64_t widthMask = size >= sizeof(uint64_t) ? ~0ull : (1ull << (size * 8)) - 1;
+
+    for (const EnumValue* value : values) {
+        const uint64_t bits =
+            strtoull(value->rawValue(scalarType->getKind()).c_str(), nullptr, 10) & widthMask;
+
+        if (bits == 0) {
+            if (!bitNames->empty()) return false;
+            zeroNames->push_back(value->name());
+            continue;
+        }
+        if ((bits & (bits - 1)) != 0) return false;
+
+        const size_t bit = __builtin_ctzll(bits);
+        if (bit < bitNames->size()) return false;
+        bitNames->resize(bit + 1);
+        bitNames->back() = value->name();
+    }
+    return true;
+}
+
+void EnumType::emitPackageTypeHeaderDefinitions(Formatter& out, bool outOfLine) const {
     const ScalarType *scalarType = mStorageType->resolveToScalarType();
     CHECK(scalarType != nullptr);
 
+    const std::string storageType = scalarType->getCppStackType();
+
+    std::vector<EnumValue*> values;
+    forEachValueFromRoot([&](EnumValue* value) { values.push_back(value); });
+
+    std::vector<std::string> zeroNames;
+    std::vector<std::string> bitNames;
+    const bool singleBits = getSingleBitNames(values, scalarType, &zeroNames, &bitNames);
+
     out << "template<>\n"
-        << "inline std::string toString<" << getCppStackType() << ">("
+        << (outOfLine ? "" : "inline ") << "std::string toString<" << getCppStackType() << ">("
         << scalarType->getCppArgumentType() << " o) ";
     out.block([&] {
         // include toHexString for scalar types
-        out << "using ::android::hardware::details::toHexString;\n"
-            << "std::string os;\n"
-            << getBitfieldCppType(StorageMode_Stack) << " flipped = 0;\n"
-            << "bool first = true;\n";
-        forEachValueFromRoot([&](EnumValue* value) {
-            std::string valueName = fullName() + "::" + value->name();
-            out.sIf("(o & " + valueName + ")" +
-                    " == static_cast<" + scalarType->getCppStackType() +
-                    ">(" + valueName + ")", [&] {
-                out << "os += (first ? \"\" : \" | \");\n"
-                    << "os += \"" << value->name() << "\";\n"
-                    << "first = false;\n"
-                    << "flipped |= " << valueName << ";\n";
-            }).endl();
-        });
+        out << "using ::android::hardware::details::toHexString;\n";
+
+        if (singleBits && !bitNames.empty()) {
+            // Only the set bits of o need to be looked at.
+            uint64_t mask = 0;
+            char maskString[32];
+            out << "static constexpr const char* kBitNames[] = ";
+            out.block([&] {
+                for (size_t bit = 0; bit < bitNames.size(); bit++) {
+                    if (bitNames[bit].empty()) {
+                        out << "nullptr,\n";
+                        continue;
+                    }
+                    out << "\"" << bitNames[bit] << "\",\n";
+                    mask |= 1ull << bit;
+                }
+            });
+            out << ";\n";
+
+            snprintf(maskString, sizeof(maskString), "0x%" PRIx64 "ull", mask);
+
+            out << "std::string os = \"" << StringHelper::JoinStrings(zeroNames, " | ") << "\";\n"
+                << "const " << storageType << " flipped = o & static_cast<" << storageType
+                << ">(" << maskString << ");\n";
+            out.sFor("uint64_t bits = static_cast<uint64_t>(o) & " + std::string(maskString) +
+                         "; bits != 0; bits &= bits - 1",
+                     [&] {
+                         out << "os += (os.empty() ? \"\" : \" | \");\n"
+                             << "os += kBitNames[__builtin_ctzll(bits)];\n";
+                     })
+                .endl();
+        } else {
+            if (!values.empty()) {
+                out << "static constexpr struct ";
+                out.block([&] {
+                    out << storageType << " value;\n"
+                        << "const char* name;\n";
+                });
+                out << " kValues[] = ";
+                out.block([&] {
+                    for (const EnumValue* value : values) {
+                        out << "{static_cast<" << storageType << ">(" << fullName()
+                            << "::" << value->name() << "), \"" << value->name() << "\"},\n";
+                    }
+                });
+                out << ";\n";
+            }
+
+            out << "std::string os;\n"
+                << getBitfieldCppType(StorageMode_Stack) << " flipped = 0;\n";
+
+            if (!values.empty()) {
+                out.sFor("const auto& value : kValues", [&] {
+                    out.sIf("(o & value.value) == value.value", [&] {
+                        out << "os += (os.empty() ? \"\" : \" | \");\n"
+                            << "os += value.name;\n"
+                            << "flipped |= value.value;\n";
+                    }).endl();
+                }).endl();
+            }
+        }
+
         // put remaining bits
         out.sIf("o != flipped", [&] {
-            out << "os += (first ? \"\" : \" | \");\n";
+            out << "os += (os.empty() ? \"\" : \" | \");\n";
             scalarType->emitHexDump(out, "os", "o & (~flipped)");
-        });
+        }).endl();
         out << "os += \" (\";\n";
         scalarType->emitHexDump(out, "os", "o");
         out << "os += \")\";\n";
@@ -441,18 +539,28 @@ void EnumType::emitPackageTypeHeaderDefinitions(Formatter& out) const {
         out << "return os;\n";
     }).endl().endl();
 
-    out << "static inline std::string toString(" << getCppArgumentType() << " o) ";
+    out << (outOfLine ? "" : "static inline ") << "std::string toString("
+        << getCppArgumentType() << " o) ";
 
     out.block([&] {
         out << "using ::android::hardware::details::toHexString;\n";
-        forEachValueFromRoot([&](EnumValue* value) {
-            out.sIf("o == " + fullName() + "::" + value->name(), [&] {
-                out << "return \"" << value->name() << "\";\n";
+        if (!values.empty()) {
+            // Aliases share a case label; the first name declared wins.
+            std::set<std::string> seen;
+            out << "switch (o) ";
+            out.block([&] {
+                for (const EnumValue* value : values) {
+                    if (!seen.insert(value->rawValue(scalarType->getKind())).second) continue;
+                    out << "case " << fullName() << "::" << value->name() << ":\n";
+                    out.indent([&] { out << "return \"" << value->name() << "\";\n"; });
+                }
+                out << "default:\n";
+                out.indent([&] { out << "break;\n"; });
             }).endl();
-        });
+        }
         out << "std::string os;\n";
         scalarType->emitHexDump(out, "os",
-            "static_cast<" + scalarType->getCppStackType() + ">(o)");
+            "static_cast<" + storageType + ">(o)");
         out << "return os;\n";
     }).endl().endl();
 }
@@ -613,6 +721,11 @@ void EnumType::getAlignmentAndSize(size_t *align, size_t *size) const {
     mStorageType->getAlignmentAndSize(align, size);
 }
 
+size_t EnumType::getCppParcelSize(const std::string& name,
+                                  std::vector<std::string>* runtimeSizes) const {
+    return mStorageType->getCppParcelSize(name, runtimeSizes);
+}
+
 const Annotation *EnumType::findExportAnnotation() const {
     for (const auto &annotation : annotations()) {
         if (annotation->name() == "export") {
@@ -852,6 +965,10 @@ bool BitFieldType::deepCanCheckEquality(std::unordered_set<const Type*>* visited
     return resolveToScalarType()->canCheckEquality(visited);
 }
 
+bool BitFieldType::hasUniqueObjectRepresentation() const {
+    return resolveToScalarType()->hasUniqueObjectRepresentation();
+}
+
 void BitFieldType::emitVtsAttributeType(Formatter& out) const {
     out << "type: " << getVtsType() << "\n";
     out << "scalar_type: \""
@@ -865,6 +982,11 @@ void BitFieldType::getAlignmentAndSize(size_t *align, size_t *size) const {
     resolveToScalarType()->getAlignmentAndSize(align, size);
 }
 
+size_t BitFieldType::getCppParcelSize(const std::string& name,
+                                      std::vector<std::string>* runtimeSizes) const {
+    return resolveToScalarType()->getCppParcelSize(name, runtimeSizes);
+}
+
 void BitFieldType::emitReaderWriter(
         Formatter &out,
         const std::string &name,
@@ -893,7 +1015,8 @@ const EnumType* BitFieldType::getEnumType() const {
 void BitFieldType::emitDump(
         Formatter &out,
         const std::string &streamName,
-        const std::string &name) const {
+        const std::string &name,
+        size_t /* depth */) const {
     out << streamName << " += "<< getEnumType()->fqName().cppNamespace()
         << "::toString<" << getEnumType()->getCppStackType()
         << ">(" << name << ");\n";
@@ -50,6 +50,7 @@ struct EnumType : public Scope {
     std::string typeName() const override;
     bool isEnum() const override;
     bool deepCanCheckEquality(std::unordered_set<const Type*>* visited) const override;
+    bool hasUniqueObjectRepresentation() const override;
 
     std::string getCppType(StorageMode mode,
                            bool specifyNamespaces) const override;
@@ -95,8 +96,8 @@ struct EnumType : public Scope {
     void emitTypeDeclarations(Formatter& out) const override;
     void emitTypeForwardDeclaration(Formatter& out) const override;
     void emitGlobalTypeDeclarations(Formatter& out) const override;
-    void emitPackageTypeDeclarations(Formatter& out) const override;
-    void emitPackageTypeHeaderDefinitions(Formatter& out) const override;
+    void emitPackageTypeDeclarations(Formatter& out, bool outOfLine) const override;
+    void emitPackageTypeHeaderDefinitions(Formatter& out, bool outOfLine) const override;
 
     void emitJavaTypeDeclarations(Formatter& out, bool atTopLevel) const override;
 
@@ -109,6 +110,8 @@ struct EnumType : public Scope {
             const std::string &name) const override;
 
     void getAlignmentAndSize(size_t *align, size_t *size) const override;
+    size_t getCppParcelSize(const std::string& name,
+                            std::vector<std::string>* runtimeSizes) const override;
 
     void appendToExportedTypesVector(
             std::vector<const Type *> *exportedTypes) const override;
@@ -178,6 +181,7 @@ struct BitFieldType : public TemplatedType {
     bool isElidableType() const override;
 
     bool deepCanCheckEquality(std::unordered_set<const Type*>* visited) const override;
+    bool hasUniqueObjectRepresentation() const override;
 
     const ScalarType *resolveToScalarType() const override;
 
@@ -196,6 +200,8 @@ struct BitFieldType : public TemplatedType {
     void emitVtsAttributeType(Formatter& out) const override;
 
     void getAlignmentAndSize(size_t *align, size_t *size) const override;
+    size_t getCppParcelSize(const std::string& name,
+                            std::vector<std::string>* runtimeSizes) const override;
 
     void emitReaderWriter(
         Formatter &out,
@@ -208,7 +214,8 @@ struct BitFieldType : public TemplatedType {
     void emitDump(
             Formatter &out,
             const std::string &streamName,
-            const std::string &name) const override;
+            const std::string &name,
+            size_t depth) const override;
 
     void emitJavaDump(
             Formatter &out,
@@ -151,6 +151,11 @@ void FmqType::getAlignmentAndSize(
     *size = assertion.size();
 }
 
+size_t FmqType::getEmbeddedObjectCount(const std::string& /* name */,
+                                       std::vector<std::string>* /* runtimeCounts */) const {
+    return 3;  // grantors and handle
+}
+
 bool FmqType::needsEmbeddedReadWrite() const {
     return true;
 }
@@ -57,6 +57,8 @@ struct FmqType : public TemplatedType {
     bool deepIsJavaCompatible(std::unordered_set<const Type*>* visited) const override;
 
     void getAlignmentAndSize(size_t *align, size_t *size) const override;
+    size_t getEmbeddedObjectCount(const std::string& name,
+                                  std::vector<std::string>* runtimeCounts) const override;
 
     bool needsEmbeddedReadWrite() const override;
     bool resultNeedsDeref() const override;
@@ -184,6 +184,11 @@ void HandleType::getAlignmentAndSize(size_t *align, size_t *size) const {
     *size = assertion.size();
 }
 
+size_t HandleType::getEmbeddedObjectCount(const std::string& /* name */,
+                                          std::vector<std::string>* /* runtimeCounts */) const {
+    return 2;  // native_handle_t and its file descriptors
+}
+
 void HandleType::emitVtsTypeDeclarations(Formatter& out) const {
     out << "type: " << getVtsType() << "\n";
 }
@@ -80,6 +80,8 @@ struct HandleType : public Type {
     bool deepIsJavaCompatible(std::unordered_set<const Type*>* visited) const override;
 
     void getAlignmentAndSize(size_t *align, size_t *size) const override;
+    size_t getEmbeddedObjectCount(const std::string& name,
+                                  std::vector<std::string>* runtimeCounts) const override;
 
     void emitVtsTypeDeclarations(Formatter& out) const override;
 };
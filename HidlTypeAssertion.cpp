@@ -39,14 +39,16 @@ size_t HidlTypeAssertion::size() const {
 }
 
 void HidlTypeAssertion::EmitAll(Formatter &out) {
+    // Sort a copy, the registry is shared by all threads generating code.
+    Registry sorted = registry();
     std::sort(
-            registry().begin(),
-            registry().end(),
+            sorted.begin(),
+            sorted.end(),
             [](const auto &a, const auto &b) {
                 return a.first < b.first;
             });
 
-    for (const auto& entry : registry()) {
+    for (const auto& entry : sorted) {
         out << "static_assert(sizeof(::android::hardware::"
             << entry.first
             << ") == "
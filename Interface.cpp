@@ -27,6 +27,7 @@
 
 #include <unistd.h>
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <sstream>
@@ -441,11 +442,9 @@ bool Interface::fillDebugMethod(Method *method) const {
     return true;
 }
 
-static std::map<std::string, Method *> gAllReservedMethods;
-
 bool Interface::addMethod(Method *method) {
     if (isIBase()) {
-        if (!gAllReservedMethods.emplace(method->name(), method).second) {
+        if (!mDeclaredReservedMethods.emplace(method->name(), method).second) {
             std::cerr << "ERROR: hidl-gen encountered duplicated reserved method " << method->name()
                       << std::endl;
             return false;
@@ -548,6 +547,16 @@ void Interface::getAlignmentAndSize(size_t* align, size_t* size) const {
     *size = 8;
 }
 
+size_t Interface::getCppParcelSize(const std::string& /* name */,
+                                   std::vector<std::string>* /* runtimeSizes */) const {
+    return kBinderObjectSize;
+}
+
+size_t Interface::getEmbeddedObjectCount(const std::string& /* name */,
+                                         std::vector<std::string>* /* runtimeCounts */) const {
+    return 1;
+}
+
 status_t Interface::validateUniqueNames() const {
     std::unordered_map<std::string, const Interface*> registeredMethodNames;
     for (auto const& tuple : allSuperMethodsFromRoot()) {
@@ -582,7 +591,29 @@ status_t Interface::validateUniqueNames() const {
     return OK;
 }
 
+// Same limit TaskRunner had for binderized interfaces.
+static constexpr size_t kDefaultOnewayQueueCapacity = 3000;
+static constexpr size_t kMaxOnewayQueueCapacity = 1 << 20;
+
 status_t Interface::validateAnnotations() const {
+    for (const Annotation* annotation : annotations()) {
+        if (annotation->name() != "onewayQueue") continue;
+
+        const AnnotationParam* capacity = annotation->getParam("capacity");
+        if (capacity == nullptr || capacity->getConstantExpressions().size() != 1) {
+            std::cerr << "ERROR: @onewayQueue requires a single numeric 'capacity' at "
+                      << location() << std::endl;
+            return UNKNOWN_ERROR;
+        }
+
+        const size_t value = capacity->getConstantExpressions()[0]->castSizeT();
+        if (value == 0 || value > kMaxOnewayQueueCapacity) {
+            std::cerr << "ERROR: @onewayQueue capacity must be between 1 and "
+                      << kMaxOnewayQueueCapacity << " at " << location() << std::endl;
+            return UNKNOWN_ERROR;
+        }
+    }
+
     for (const Method* method : methods()) {
         for (const Annotation* annotation : method->annotations()) {
             const std::string name = annotation->name();
@@ -591,19 +622,31 @@ status_t Interface::validateAnnotations() const {
                 continue;
             }
 
+            if (name == "packed") {
+                if (method->numPackedArgs() == 0) {
+                    std::cerr << "ERROR: @packed method " << method->name()
+                              << " must start with a scalar argument at " << method->location()
+                              << std::endl;
+                    return UNKNOWN_ERROR;
+                }
+                continue;
+            }
+
             std::cerr << "ERROR: Unrecognized annotation '" << name
                       << "' for method: " << method->name() << ". An annotation should be one of: "
-                      << "entry, exit, callflow." << std::endl;
+                      << "entry, exit, callflow, packed." << std::endl;
             return UNKNOWN_ERROR;
         }
     }
     return OK;
 }
 
-bool Interface::addAllReservedMethods() {
+bool Interface::addAllReservedMethods(const Interface& ibase) {
+    CHECK(ibase.isIBase());
+
     // use a sorted map to insert them in serial ID order.
     std::map<int32_t, Method *> reservedMethodsById;
-    for (const auto &pair : gAllReservedMethods) {
+    for (const auto &pair : ibase.mDeclaredReservedMethods) {
         Method *method = pair.second->copySignature();
         bool fillSuccess = fillPingMethod(method)
             || fillDescriptorChainMethod(method)
@@ -655,7 +698,8 @@ std::vector<const Interface *> Interface::typeChain() const {
 }
 
 std::vector<const Interface *> Interface::superTypeChain() const {
-    return isIBase() ? std::vector<const Interface*>() : superType()->typeChain();
+    const Interface* super = superType();
+    return super == nullptr ? std::vector<const Interface*>() : super->typeChain();
 }
 
 bool Interface::isElidableType() const {
@@ -836,16 +880,18 @@ void Interface::emitReaderWriter(
     }
 }
 
-void Interface::emitPackageTypeDeclarations(Formatter& out) const {
-    Scope::emitPackageTypeDeclarations(out);
+void Interface::emitPackageTypeDeclarations(Formatter& out, bool outOfLine) const {
+    Scope::emitPackageTypeDeclarations(out, outOfLine);
 
-    out << "static inline std::string toString(" << getCppArgumentType() << " o);\n\n";
+    out << (outOfLine ? "" : "static inline ") << "std::string toString("
+        << getCppArgumentType() << " o);\n\n";
 }
 
-void Interface::emitPackageTypeHeaderDefinitions(Formatter& out) const {
-    Scope::emitPackageTypeHeaderDefinitions(out);
+void Interface::emitPackageTypeHeaderDefinitions(Formatter& out, bool outOfLine) const {
+    Scope::emitPackageTypeHeaderDefinitions(out, outOfLine);
 
-    out << "static inline std::string toString(" << getCppArgumentType() << " o) ";
+    out << (outOfLine ? "" : "static inline ") << "std::string toString("
+        << getCppArgumentType() << " o) ";
 
     out.block([&] {
         out << "std::string os = \"[class or subclass of \";\n"
@@ -975,6 +1021,21 @@ bool Interface::hasOnewayMethods() const {
     return false;
 }
 
+size_t Interface::getOnewayQueueCapacity() const {
+    for (const Annotation* annotation : annotations()) {
+        if (annotation->name() == "onewayQueue") {
+            return annotation->getParam("capacity")->getConstantExpressions()[0]->castSizeT();
+        }
+    }
+    return kDefaultOnewayQueueCapacity;
+}
+
+bool Interface::isServiceCached() const {
+    return std::any_of(annotations().begin(), annotations().end(), [](const Annotation* annotation) {
+        return annotation->name() == "cachedService";
+    });
+}
+
 bool Interface::deepIsJavaCompatible(std::unordered_set<const Type*>* visited) const {
     if (superType() != nullptr && !superType()->isJavaCompatible(visited)) {
         return false;
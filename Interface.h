@@ -18,6 +18,8 @@
 
 #define INTERFACE_H_
 
+#include <map>
+#include <string>
 #include <vector>
 
 #include <hidl-hash/Hash.h>
@@ -40,7 +42,9 @@ struct Interface : public Scope {
     const Hash* getFileHash() const;
 
     bool addMethod(Method *method);
-    bool addAllReservedMethods();
+    // Adds the reserved methods declared by ibase (which is this interface
+    // while parsing IBase itself).
+    bool addAllReservedMethods(const Interface& ibase);
 
     bool isElidableType() const override;
     bool isInterface() const override;
@@ -111,11 +115,15 @@ struct Interface : public Scope {
             bool isReader,
             ErrorMode mode) const override;
 
-    void emitPackageTypeDeclarations(Formatter& out) const override;
-    void emitPackageTypeHeaderDefinitions(Formatter& out) const override;
+    void emitPackageTypeDeclarations(Formatter& out, bool outOfLine) const override;
+    void emitPackageTypeHeaderDefinitions(Formatter& out, bool outOfLine) const override;
     void emitTypeDefinitions(Formatter& out, const std::string& prefix) const override;
 
     void getAlignmentAndSize(size_t* align, size_t* size) const override;
+    size_t getCppParcelSize(const std::string& name,
+                            std::vector<std::string>* runtimeSizes) const override;
+    size_t getEmbeddedObjectCount(const std::string& name,
+                                  std::vector<std::string>* runtimeCounts) const override;
     void emitJavaReaderWriter(
             Formatter &out,
             const std::string &parcelObj,
@@ -129,6 +137,14 @@ struct Interface : public Scope {
 
     bool hasOnewayMethods() const;
 
+    // Number of oneway calls a passthrough wrapper queues before rejecting
+    // new ones, as set by @onewayQueue(capacity=N).
+    size_t getOnewayQueueCapacity() const;
+
+    // Whether getService caches the services it returns, as requested by
+    // @cachedService.
+    bool isServiceCached() const;
+
     bool deepIsJavaCompatible(std::unordered_set<const Type*>* visited) const override;
 
     bool isNeverStrongReference() const override;
@@ -139,6 +155,9 @@ struct Interface : public Scope {
     std::vector<Method*> mUserMethods;
     std::vector<Method*> mReservedMethods;
 
+    // Only for IBase: the methods as declared in IBase.hal, by name.
+    std::map<std::string, Method*> mDeclaredReservedMethods;
+
     const Hash* mFileHash;
 
     bool fillPingMethod(Method* method) const;
@@ -155,6 +155,11 @@ void MemoryType::getAlignmentAndSize(size_t *align, size_t *size) const {
     *size = assertion.size();
 }
 
+size_t MemoryType::getEmbeddedObjectCount(const std::string& /* name */,
+                                          std::vector<std::string>* /* runtimeCounts */) const {
+    return 3;  // handle and name
+}
+
 void MemoryType::emitVtsTypeDeclarations(Formatter& out) const {
     out << "type: " << getVtsType() << "\n";
 }
@@ -283,6 +283,39 @@ const NamedReference<Type>* Method::canElideCallback() const {
     return nullptr;
 }
 
+size_t Method::numPackedArgs() const {
+    const bool packed =
+        std::any_of(mAnnotations->begin(), mAnnotations->end(),
+                    [](const Annotation* annotation) { return annotation->name() == "packed"; });
+    if (!packed) {
+        return 0;
+    }
+
+    size_t count = 0;
+    while (count < mArgs->size() && mArgs->at(count)->type().resolveToScalarType() != nullptr) {
+        count++;
+    }
+    return count;
+}
+
+size_t Method::getPackedArgsLayout(std::vector<size_t>* offsets) const {
+    offsets->clear();
+
+    size_t offset = 0;
+    size_t maxAlign = 1;
+    for (size_t i = 0; i < numPackedArgs(); i++) {
+        size_t align, size;
+        mArgs->at(i)->type().getAlignmentAndSize(&align, &size);
+
+        offset = (offset + align - 1) / align * align;
+        offsets->push_back(offset);
+        offset += size;
+        maxAlign = std::max(maxAlign, align);
+    }
+
+    return (offset + maxAlign - 1) / maxAlign * maxAlign;
+}
+
 const Location& Method::location() const {
     return mLocation;
 }
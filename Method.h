@@ -104,6 +104,14 @@ struct Method : DocCommentable {
 
     const NamedReference<Type>* canElideCallback() const;
 
+    // Number of leading scalar arguments that @packed marshals together, as
+    // a single buffer, instead of one Parcel call each. 0 without @packed.
+    size_t numPackedArgs() const;
+
+    // Lays out the packed arguments like the fields of a struct. Returns the
+    // size of the buffer and fills in the offset of each argument.
+    size_t getPackedArgsLayout(std::vector<size_t>* offsets) const;
+
     void dumpAnnotations(Formatter &out) const;
 
     bool deepIsJavaCompatible(std::unordered_set<const Type*>* visited) const;
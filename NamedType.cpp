@@ -49,7 +49,8 @@ const Location &NamedType::location() const {
 void NamedType::emitDump(
         Formatter &out,
         const std::string &streamName,
-        const std::string &name) const {
+        const std::string &name,
+        size_t /* depth */) const {
     emitDumpWithMethod(out, streamName, fqName().cppNamespace() + "::toString", name);
 }
 
@@ -46,7 +46,8 @@ struct NamedType : public Type {
     void emitDump(
             Formatter &out,
             const std::string &streamName,
-            const std::string &name) const override;
+            const std::string &name,
+            size_t depth) const override;
 
    private:
     const std::string mLocalName;
@@ -43,6 +43,11 @@ bool ScalarType::deepCanCheckEquality(std::unordered_set<const Type*>* /* visite
     return true;
 }
 
+bool ScalarType::hasUniqueObjectRepresentation() const {
+    // 0.0 == -0.0
+    return mKind != KIND_FLOAT && mKind != KIND_DOUBLE;
+}
+
 std::string ScalarType::typeName() const {
     return getCppStackType();
 }
@@ -300,6 +305,14 @@ void ScalarType::getAlignmentAndSize(size_t *align, size_t *size) const {
     *align = *size = kAlign[mKind];
 }
 
+size_t ScalarType::getCppParcelSize(const std::string& /* name */,
+                                    std::vector<std::string>* /* runtimeSizes */) const {
+    size_t align, size;
+    getAlignmentAndSize(&align, &size);
+    // Parcel pads scalars to 4 bytes.
+    return (size + 3) & ~static_cast<size_t>(3);
+}
+
 ScalarType::Kind ScalarType::getKind() const {
     return mKind;
 }
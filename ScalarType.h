@@ -45,6 +45,7 @@ struct ScalarType : public Type {
     const ScalarType *resolveToScalarType() const override;
 
     bool deepCanCheckEquality(std::unordered_set<const Type*>* visited) const override;
+    bool hasUniqueObjectRepresentation() const override;
 
     std::string typeName() const override;
     bool isValidEnumStorageType() const;
@@ -99,6 +100,8 @@ struct ScalarType : public Type {
     void emitVtsTypeDeclarations(Formatter& out) const override;
 
     void getAlignmentAndSize(size_t *align, size_t *size) const override;
+    size_t getCppParcelSize(const std::string& name,
+                            std::vector<std::string>* runtimeSizes) const override;
 
     Kind getKind() const;
 
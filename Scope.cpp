@@ -171,15 +171,21 @@ void Scope::emitGlobalTypeDeclarations(Formatter& out) const {
     }
 }
 
-void Scope::emitPackageTypeDeclarations(Formatter& out) const {
+void Scope::emitGlobalTypeHeaderDefinitions(Formatter& out, bool outOfLine) const {
     for (const Type* type : mTypes) {
-        type->emitPackageTypeDeclarations(out);
+        type->emitGlobalTypeHeaderDefinitions(out, outOfLine);
     }
 }
 
-void Scope::emitPackageTypeHeaderDefinitions(Formatter& out) const {
+void Scope::emitPackageTypeDeclarations(Formatter& out, bool outOfLine) const {
     for (const Type* type : mTypes) {
-        type->emitPackageTypeHeaderDefinitions(out);
+        type->emitPackageTypeDeclarations(out, outOfLine);
+    }
+}
+
+void Scope::emitPackageTypeHeaderDefinitions(Formatter& out, bool outOfLine) const {
+    for (const Type* type : mTypes) {
+        type->emitPackageTypeHeaderDefinitions(out, outOfLine);
     }
 }
 
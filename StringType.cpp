@@ -32,6 +32,16 @@ bool StringType::deepCanCheckEquality(std::unordered_set<const Type*>* /* visite
     return true;
 }
 
+void StringType::emitHash(
+        Formatter &out,
+        const std::string &hashName,
+        const std::string &name,
+        size_t /* depth */) const {
+    out << hashName << " = ::android::hardware::details::hidl_hash_combine(" << hashName
+        << ", ::android::hardware::details::hidl_hash_bytes(" << name << ".c_str(), " << name
+        << ".size()));\n";
+}
+
 std::string StringType::typeName() const {
     return "string";
 }
@@ -222,5 +232,10 @@ void StringType::getAlignmentAndSize(size_t *align, size_t *size) const {
     *size = assertion.size();
 }
 
+size_t StringType::getEmbeddedObjectCount(const std::string& /* name */,
+                                          std::vector<std::string>* /* runtimeCounts */) const {
+    return 1;  // characters
+}
+
 }  // namespace android
 
@@ -41,6 +41,12 @@ struct StringType : public Type {
 
     std::string getVtsType() const override;
 
+    void emitHash(
+            Formatter &out,
+            const std::string &hashName,
+            const std::string &name,
+            size_t depth) const override;
+
     void emitReaderWriter(
             Formatter &out,
             const std::string &name,
@@ -83,6 +89,8 @@ struct StringType : public Type {
     void emitVtsTypeDeclarations(Formatter& out) const override;
 
     void getAlignmentAndSize(size_t *align, size_t *size) const override;
+    size_t getEmbeddedObjectCount(const std::string& name,
+                                  std::vector<std::string>* runtimeCounts) const override;
 };
 
 }  // namespace android
@@ -352,6 +352,14 @@ bool Type::deepCanCheckEquality(std::unordered_set<const Type*>* /* visited */)
     return false;
 }
 
+bool Type::hasUniqueObjectRepresentation() const {
+    return false;
+}
+
+bool Type::dumpsInPlace() const {
+    return false;
+}
+
 Type::ParseStage Type::getParseStage() const {
     return mParseStage;
 }
@@ -446,7 +454,8 @@ void Type::emitResolveReferencesEmbedded(
 void Type::emitDump(
         Formatter &out,
         const std::string &streamName,
-        const std::string &name) const {
+        const std::string &name,
+        size_t /* depth */) const {
     emitDumpWithMethod(out, streamName, "::android::hardware::toString", name);
 }
 
@@ -463,6 +472,15 @@ void Type::emitDumpWithMethod(
         << ");\n";
 }
 
+void Type::emitHash(
+        Formatter &out,
+        const std::string &hashName,
+        const std::string &name,
+        size_t /* depth */) const {
+    out << hashName << " = ::android::hardware::details::hidl_hash_combine(" << hashName
+        << ", ::std::hash<" << getCppStackType() << ">{}(" << name << "));\n";
+}
+
 void Type::emitJavaDump(
         Formatter &out,
         const std::string &streamName,
@@ -623,9 +641,11 @@ void Type::emitTypeForwardDeclaration(Formatter&) const {}
 
 void Type::emitGlobalTypeDeclarations(Formatter&) const {}
 
-void Type::emitPackageTypeDeclarations(Formatter&) const {}
+void Type::emitGlobalTypeHeaderDefinitions(Formatter&, bool) const {}
 
-void Type::emitPackageTypeHeaderDefinitions(Formatter&) const {}
+void Type::emitPackageTypeDeclarations(Formatter&, bool) const {}
+
+void Type::emitPackageTypeHeaderDefinitions(Formatter&, bool) const {}
 
 void Type::emitPackageHwDeclarations(Formatter&) const {}
 
@@ -751,6 +771,22 @@ void Type::getAlignmentAndSize(
     CHECK(!"Should not be here.");
 }
 
+size_t Type::getCppParcelSize(const std::string& name,
+                              std::vector<std::string>* runtimeSizes) const {
+    // Anything not written as a scalar is written as a buffer.
+    std::vector<std::string> runtimeCounts;
+    const size_t count = 1 + getEmbeddedObjectCount(name, &runtimeCounts);
+    for (const std::string& runtimeCount : runtimeCounts) {
+        runtimeSizes->push_back(runtimeCount + " * " + std::to_string(kBinderObjectSize));
+    }
+    return count * kBinderObjectSize;
+}
+
+size_t Type::getEmbeddedObjectCount(const std::string& /* name */,
+                                    std::vector<std::string>* /* runtimeCounts */) const {
+    return 0;
+}
+
 void Type::appendToExportedTypesVector(
         std::vector<const Type *> * /* exportedTypes */) const {
 }
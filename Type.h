@@ -140,6 +140,15 @@ struct Type : DocCommentable {
     bool canCheckEquality(std::unordered_set<const Type*>* visited) const;
     virtual bool deepCanCheckEquality(std::unordered_set<const Type*>* visited) const;
 
+    // Returns true iff two values of this type are equal exactly when their
+    // bytes are, i.e. the C++ type has no padding, pointers or floating point
+    // members. Such values can be hashed as raw memory.
+    virtual bool hasUniqueObjectRepresentation() const;
+
+    // Returns true iff emitDump appends to the stream in place, instead of
+    // concatenating a temporary string built by toString.
+    virtual bool dumpsInPlace() const;
+
     // ParseStage can only be incremented.
     ParseStage getParseStage() const;
     void setParseStage(ParseStage stage);
@@ -239,16 +248,27 @@ struct Type : DocCommentable {
             const std::string &parentName,
             const std::string &offsetText) const;
 
+    // Emits statements appending the string representation of name to the
+    // std::string streamName, for the generated toString and appendToString.
     virtual void emitDump(
             Formatter &out,
             const std::string &streamName,
-            const std::string &name) const;
+            const std::string &name,
+            size_t depth) const;
 
     virtual void emitJavaDump(
             Formatter &out,
             const std::string &streamName,
             const std::string &name) const;
 
+    // Emits statements mixing the hash of name into hashName, for the
+    // generated std::hash specializations. Only valid if canCheckEquality().
+    virtual void emitHash(
+            Formatter &out,
+            const std::string &hashName,
+            const std::string &name,
+            size_t depth) const;
+
     virtual bool useParentInEmitResolveReferencesEmbedded() const;
 
     virtual void emitJavaReaderWriter(
@@ -278,6 +298,13 @@ struct Type : DocCommentable {
 
     virtual void emitGlobalTypeDeclarations(Formatter& out) const;
 
+    // Emit any definitions pertaining to this type that have to be at
+    // global scope, after all global type declarations, i.e. std::hash
+    // members which may use the std::hash of types declared later.
+    // If outOfLine, these are emitted into the C++ source instead, and
+    // are not inline.
+    virtual void emitGlobalTypeHeaderDefinitions(Formatter& out, bool outOfLine) const;
+
     // Emit scope C++ forward declaration.
     // There is no need to forward declare interfaces, as
     // they are always declared in global scope in dedicated file.
@@ -287,7 +314,9 @@ struct Type : DocCommentable {
     // directly in a namespace, i.e. enum class operators.
     // For android.hardware.foo@1.0::*, this will be in namespace
     // android::hardware::foo::V1_0
-    virtual void emitPackageTypeDeclarations(Formatter& out) const;
+    // If outOfLine, functions whose definitions emitPackageTypeHeaderDefinitions
+    // moves out of line are declared with external linkage.
+    virtual void emitPackageTypeDeclarations(Formatter& out, bool outOfLine) const;
 
     // Emit any definitions pertaining to this type that have to be
     // directly in a namespace. Typically, these are things that are only
@@ -296,7 +325,10 @@ struct Type : DocCommentable {
     // feature.
     // For android.hardware.foo@1.0::*, this will be in namespace
     // android::hardware::foo::V1_0
-    virtual void emitPackageTypeHeaderDefinitions(Formatter& out) const;
+    // If outOfLine, these are emitted into the C++ source instead, so that
+    // clients do not compile them again, and are not inline. constexpr
+    // helpers are declared by emitPackageTypeDeclarations and stay inline.
+    virtual void emitPackageTypeHeaderDefinitions(Formatter& out, bool outOfLine) const;
 
     // Emit any declarations pertaining to this type that have to be
     // at global scope for transport, e.g. read/writeEmbeddedTo/FromParcel
@@ -334,6 +366,23 @@ struct Type : DocCommentable {
 
     virtual void getAlignmentAndSize(size_t *align, size_t *size) const;
 
+    // Upper bound of the size of a binder object written to a Parcel, i.e.
+    // that of a binder_buffer_object on 64-bit.
+    static constexpr size_t kBinderObjectSize = 40;
+
+    // Estimates the size of the Parcel data emitReaderWriter writes for
+    // name. Sizes only known at runtime, e.g. those depending on the size of
+    // a vector, are appended to runtimeSizes as C++ expressions.
+    virtual size_t getCppParcelSize(const std::string& name,
+                                    std::vector<std::string>* runtimeSizes) const;
+
+    // Number of binder objects emitReaderWriterEmbedded writes for name,
+    // besides the buffer containing it. Counts only known at runtime are
+    // appended to runtimeCounts, except for those of objects nested in
+    // vector and array elements, which are left out.
+    virtual size_t getEmbeddedObjectCount(const std::string& name,
+                                          std::vector<std::string>* runtimeCounts) const;
+
     virtual void appendToExportedTypesVector(
             std::vector<const Type *> *exportedTypes) const;
 
@@ -19,6 +19,7 @@
 #include "ArrayType.h"
 #include "CompoundType.h"
 #include "HidlTypeAssertion.h"
+#include "ScalarType.h"
 
 #include <hidl-util/Formatter.h>
 #include <android-base/logging.h>
@@ -82,6 +83,64 @@ bool VectorType::deepCanCheckEquality(std::unordered_set<const Type*>* visited)
     return mElementType->canCheckEquality(visited);
 }
 
+void VectorType::emitHash(
+        Formatter &out,
+        const std::string &hashName,
+        const std::string &name,
+        size_t depth) const {
+    if (mElementType->hasUniqueObjectRepresentation()) {
+        out << hashName << " = ::android::hardware::details::hidl_hash_combine(" << hashName
+            << ", ::android::hardware::details::hidl_hash_bytes(" << name << ".data(), "
+            << name << ".size() * sizeof(" << mElementType->getCppStackType() << ")));\n";
+        return;
+    }
+
+    std::string iteratorName = "_hidl_index_" + std::to_string(depth);
+
+    out << hashName << " = ::android::hardware::details::hidl_hash_combine(" << hashName << ", "
+        << name << ".size());\n";
+    out.sFor("size_t " + iteratorName + " = 0; " + iteratorName + " < " + name + ".size(); ++" +
+                 iteratorName,
+             [&] {
+                 mElementType->emitHash(out, hashName, name + "[" + iteratorName + "]",
+                                        depth + 1);
+             })
+        .endl();
+}
+
+void VectorType::emitDump(
+        Formatter &out,
+        const std::string &streamName,
+        const std::string &name,
+        size_t depth) const {
+    if (!dumpsInPlace()) {
+        Type::emitDump(out, streamName, name, depth);
+        return;
+    }
+
+    // Same format as ::android::hardware::toString(const hidl_vec<T>&).
+    std::string iteratorName = "_hidl_index_" + std::to_string(depth);
+
+    out << streamName << " += \"[\";\n";
+    out << streamName << " += std::to_string(" << name << ".size());\n";
+    out << streamName << " += \"]{\";\n";
+    out.sFor("size_t " + iteratorName + " = 0; " + iteratorName + " < " + name + ".size(); ++" +
+                 iteratorName,
+             [&] {
+                 out.sIf(iteratorName + " > 0", [&] {
+                     out << streamName << " += \", \";\n";
+                 }).endl();
+                 mElementType->emitDump(out, streamName, name + "[" + iteratorName + "]",
+                                        depth + 1);
+             })
+        .endl();
+    out << streamName << " += \"}\";\n";
+}
+
+bool VectorType::dumpsInPlace() const {
+    return mElementType->dumpsInPlace();
+}
+
 std::vector<const Reference<Type>*> VectorType::getStrongReferences() const {
     return {};
 }
@@ -595,6 +654,10 @@ void VectorType::EmitJavaFieldReaderWriterForElementType(
     size_t elementAlign, elementSize;
     elementType->getAlignmentAndSize(&elementAlign, &elementSize);
 
+    // Scalars and enums are copied with a single call, like the elements of
+    // arrays, rather than one get/put call each.
+    const ScalarType* scalarType = elementType->resolveToScalarType();
+
     if (isReader) {
         out << "{\n";
         out.indent();
@@ -624,6 +687,24 @@ void VectorType::EmitJavaFieldReaderWriterForElementType(
         out.unindent();
 
         out << fieldName << ".clear();\n";
+
+        if (scalarType != nullptr) {
+            const std::string arrayName = "_hidl_vec_array_" + std::to_string(depth);
+            out << scalarType->getJavaType(false /* forInitializer */) << "[] " << arrayName << " = new "
+                << scalarType->getJavaType(false /* forInitializer */) << "[_hidl_vec_size];\n";
+            out << "childBlob.copyTo" << scalarType->getJavaSuffix() << "Array(0 /* offset */, "
+                << arrayName << ", _hidl_vec_size);\n";
+            out << fieldName << ".ensureCapacity(_hidl_vec_size);\n";
+            out << "for (" << scalarType->getJavaType(false /* forInitializer */) << " _hidl_vec_element : " << arrayName
+                << ") ";
+            out.block([&] { out << fieldName << ".add(_hidl_vec_element);\n"; }).endl();
+
+            out.unindent();
+            out << "}\n";
+
+            return;
+        }
+
         std::string iteratorName = "_hidl_index_" + std::to_string(depth);
 
         out << "for (int "
@@ -637,7 +718,12 @@ void VectorType::EmitJavaFieldReaderWriterForElementType(
 
         out.indent();
 
-        elementType->emitJavaFieldInitializer(out, "_hidl_vec_element");
+        if (elementType->isString()) {
+            // Assigned below, so a default value would be garbage right away.
+            out << elementType->getJavaType() << " _hidl_vec_element;\n";
+        } else {
+            elementType->emitJavaFieldInitializer(out, "_hidl_vec_element");
+        }
 
         elementType->emitJavaFieldReaderWriter(
                 out,
@@ -685,29 +771,43 @@ void VectorType::EmitJavaFieldReaderWriterForElementType(
 
     std::string iteratorName = "_hidl_index_" + std::to_string(depth);
 
-    out << "for (int "
-        << iteratorName
-        << " = 0; "
-        << iteratorName
-        << " < _hidl_vec_size; "
-        << "++"
-        << iteratorName
-        << ") {\n";
+    if (scalarType != nullptr) {
+        const std::string arrayName = "_hidl_vec_array_" + std::to_string(depth);
+        out << scalarType->getJavaType(false /* forInitializer */) << "[] " << arrayName << " = new "
+            << scalarType->getJavaType(false /* forInitializer */) << "[_hidl_vec_size];\n";
+        out << "for (int " << iteratorName << " = 0; " << iteratorName << " < _hidl_vec_size; ++"
+            << iteratorName << ") ";
+        out.block([&] {
+            out << arrayName << "[" << iteratorName << "] = " << fieldName << ".get("
+                << iteratorName << ");\n";
+        }).endl();
+        out << "childBlob.put" << scalarType->getJavaSuffix() << "Array(0 /* offset */, "
+            << arrayName << ");\n";
+    } else {
+        out << "for (int "
+            << iteratorName
+            << " = 0; "
+            << iteratorName
+            << " < _hidl_vec_size; "
+            << "++"
+            << iteratorName
+            << ") {\n";
 
-    out.indent();
+        out.indent();
 
-    elementType->emitJavaFieldReaderWriter(
-            out,
-            depth + 1,
-            parcelName,
-            "childBlob",
-            fieldName + ".get(" + iteratorName + ")",
-            iteratorName + " * " + std::to_string(elementSize),
-            false /* isReader */);
+        elementType->emitJavaFieldReaderWriter(
+                out,
+                depth + 1,
+                parcelName,
+                "childBlob",
+                fieldName + ".get(" + iteratorName + ")",
+                iteratorName + " * " + std::to_string(elementSize),
+                false /* isReader */);
 
-    out.unindent();
+        out.unindent();
 
-    out << "}\n";
+        out << "}\n";
+    }
 
     out << blobName
         << ".putBlob("
@@ -718,6 +818,58 @@ void VectorType::EmitJavaFieldReaderWriterForElementType(
     out << "}\n";
 }
 
+bool VectorType::canBeJavaPrimitiveArray() const {
+    return mElementType->resolveToScalarType() != nullptr;
+}
+
+std::string VectorType::getJavaPrimitiveArrayType() const {
+    CHECK(canBeJavaPrimitiveArray());
+    return mElementType->resolveToScalarType()->getJavaType(false /* forInitializer */) + "[]";
+}
+
+void VectorType::emitJavaPrimitiveArrayFieldReaderWriter(Formatter& out,
+                                                         const std::string& parcelName,
+                                                         const std::string& blobName,
+                                                         const std::string& fieldName,
+                                                         const std::string& offset,
+                                                         bool isReader) const {
+    const ScalarType* scalarType = mElementType->resolveToScalarType();
+    CHECK(scalarType != nullptr);
+
+    size_t elementAlign, elementSize;
+    scalarType->getAlignmentAndSize(&elementAlign, &elementSize);
+
+    out.block([&] {
+        if (isReader) {
+            out << "int _hidl_vec_size = " << blobName << ".getInt32(" << offset
+                << " + 8 /* offsetof(hidl_vec<T>, mSize) */);\n";
+            out << "android.os.HwBlob childBlob = " << parcelName << ".readEmbeddedBuffer(\n";
+            out.indent(2, [&] {
+                out << "_hidl_vec_size * " << elementSize << "," << blobName << ".handle(),\n"
+                    << offset << " + 0 /* offsetof(hidl_vec<T>, mBuffer) */,"
+                    << "true /* nullable */);\n\n";
+            });
+            out << fieldName << " = new " << scalarType->getJavaType(false /* forInitializer */)
+                << "[_hidl_vec_size];\n";
+            out << "childBlob.copyTo" << scalarType->getJavaSuffix() << "Array(0 /* offset */, "
+                << fieldName << ", _hidl_vec_size);\n";
+            return;
+        }
+
+        out << "int _hidl_vec_size = " << fieldName << ".length;\n";
+        out << blobName << ".putInt32(" << offset
+            << " + 8 /* offsetof(hidl_vec<T>, mSize) */, _hidl_vec_size);\n";
+        out << blobName << ".putBool(" << offset
+            << " + 12 /* offsetof(hidl_vec<T>, mOwnsBuffer) */, false);\n";
+        out << "android.os.HwBlob childBlob = new android.os.HwBlob((int)(_hidl_vec_size * "
+            << elementSize << "));\n";
+        out << "childBlob.put" << scalarType->getJavaSuffix() << "Array(0 /* offset */, "
+            << fieldName << ");\n";
+        out << blobName << ".putBlob(" << offset
+            << " + 0 /* offsetof(hidl_vec<T>, mBuffer) */, childBlob);\n";
+    }).endl();
+}
+
 bool VectorType::needsEmbeddedReadWrite() const {
     return true;
 }
@@ -772,5 +924,25 @@ void VectorType::getAlignmentAndSize(size_t *align, size_t *size) const {
     VectorType::getAlignmentAndSizeStatic(align, size);
 }
 
+size_t VectorType::getCppParcelSize(const std::string& name,
+                                    std::vector<std::string>* runtimeSizes) const {
+    if (isVectorOfBinders()) {
+        runtimeSizes->push_back(name + ".size() * " + std::to_string(kBinderObjectSize));
+        return sizeof(uint64_t);
+    }
+    return Type::getCppParcelSize(name, runtimeSizes);
+}
+
+size_t VectorType::getEmbeddedObjectCount(const std::string& name,
+                                          std::vector<std::string>* runtimeCounts) const {
+    std::vector<std::string> elementRuntimeCounts;
+    const size_t elementCount =
+        mElementType->getEmbeddedObjectCount(name + "[0]", &elementRuntimeCounts);
+    if (elementCount > 0) {
+        runtimeCounts->push_back(name + ".size() * " + std::to_string(elementCount));
+    }
+    return 1;  // elements
+}
+
 }  // namespace android
 
@@ -48,6 +48,20 @@ struct VectorType : public TemplatedType {
     std::string getVtsType() const override;
     std::string getVtsValueName() const override;
 
+    void emitHash(
+            Formatter &out,
+            const std::string &hashName,
+            const std::string &name,
+            size_t depth) const override;
+
+    void emitDump(
+            Formatter &out,
+            const std::string &streamName,
+            const std::string &name,
+            size_t depth) const override;
+
+    bool dumpsInPlace() const override;
+
     void emitReaderWriter(
             Formatter &out,
             const std::string &name,
@@ -124,6 +138,16 @@ struct VectorType : public TemplatedType {
             const std::string &offset,
             bool isReader);
 
+    // Fields of @unboxed structs represent vectors of scalars and enums as
+    // primitive arrays in Java, e.g. int[] instead of ArrayList<Integer>,
+    // and use these instead of the methods above.
+    bool canBeJavaPrimitiveArray() const;
+    std::string getJavaPrimitiveArrayType() const;
+    void emitJavaPrimitiveArrayFieldReaderWriter(Formatter& out, const std::string& parcelName,
+                                                 const std::string& blobName,
+                                                 const std::string& fieldName,
+                                                 const std::string& offset, bool isReader) const;
+
     bool needsEmbeddedReadWrite() const override;
     bool deepNeedsResolveReferences(std::unordered_set<const Type*>* visited) const override;
     bool resultNeedsDeref() const override;
@@ -132,6 +156,10 @@ struct VectorType : public TemplatedType {
     bool deepContainsPointer(std::unordered_set<const Type*>* visited) const override;
 
     void getAlignmentAndSize(size_t *align, size_t *size) const override;
+    size_t getCppParcelSize(const std::string& name,
+                            std::vector<std::string>* runtimeSizes) const override;
+    size_t getEmbeddedObjectCount(const std::string& name,
+                                  std::vector<std::string>* runtimeCounts) const override;
     static void getAlignmentAndSizeStatic(size_t *align, size_t *size);
  private:
     // Helper method for emitResolveReferences[Embedded].
@@ -461,6 +461,7 @@ This corresponds to the "-r%s:<some path>" option that would be passed into hidl
 		Interfaces: i.properties.Interfaces,
 		Inputs:     i.properties.Srcs,
 		Outputs: concat(wrap(name.dir()+"I", interfaces, ".h"),
+			wrap(name.dir()+"I", interfaces, "Fwd.h"),
 			wrap(name.dir()+"Bs", interfaces, ".h"),
 			wrap(name.dir()+"BnHw", interfaces, ".h"),
 			wrap(name.dir()+"BpHw", interfaces, ".h"),
@@ -16,6 +16,7 @@
 
 #include "AST.h"
 
+#include "CompoundType.h"
 #include "Coordinator.h"
 #include "EnumType.h"
 #include "HidlTypeAssertion.h"
@@ -29,6 +30,7 @@
 #include <hidl-util/Formatter.h>
 #include <hidl-util/StringHelper.h>
 #include <android-base/logging.h>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -164,9 +166,82 @@ static void declareServiceManagerInteractions(Formatter &out, const std::string
 
 }
 
+// Keeps the services getService returns, by instance name. Local services
+// can't die, and remote ones are evicted from their death recipient.
+static void implementServiceCache(Formatter& out, const std::string& interfaceName) {
+    const std::string klassName = "_hidl_" + interfaceName + "ServiceCache";
+
+    out << "// Services returned by getService and tryGetService, by instance name. Remote\n"
+        << "// services are evicted when they die.\n";
+    out << "struct " << klassName << " : public ::android::hardware::IBinder::DeathRecipient {\n";
+    out.indent([&] {
+        out << "static " << klassName << "* get() {\n";
+        out.indent([&] {
+            out << "// never destroyed, since binder threads may still use it at exit\n";
+            out << "static " << klassName << "* const sCache = [] {\n";
+            out.indent([&] {
+                out << klassName << "* cache = new " << klassName << "();\n";
+                out << "cache->incStrong(nullptr);\n";
+                out << "return cache;\n";
+            });
+            out << "}();\n";
+            out << "return sCache;\n";
+        });
+        out << "}\n\n";
+
+        out << "::android::sp<" << interfaceName
+            << "> lookup(const std::string& serviceName) {\n";
+        out.indent([&] {
+            out << "std::lock_guard<std::mutex> lock(mMutex);\n";
+            out << "auto it = mServices.find(serviceName);\n";
+            out << "return it == mServices.end() ? nullptr : it->second;\n";
+        });
+        out << "}\n\n";
+
+        out << "void insert(const std::string& serviceName, const ::android::sp<" << interfaceName
+            << ">& service) {\n";
+        out.indent([&] {
+            // Locked first, so a death notification that comes right after
+            // linkToDeath waits for the service to be in the map.
+            out << "std::lock_guard<std::mutex> lock(mMutex);\n";
+            out.sIf("service->isRemote() &&\n"
+                    "        ::android::hardware::toBinder<" + interfaceName +
+                        ">(service)->linkToDeath(this) != ::android::OK",
+                    [&] {
+                        out << "return;\n";
+                    })
+                .endl();
+            out << "mServices[serviceName] = service;\n";
+        });
+        out << "}\n\n";
+
+        out << "void binderDied(const ::android::wp<::android::hardware::IBinder>& who) "
+               "override {\n";
+        out.indent([&] {
+            out << "std::lock_guard<std::mutex> lock(mMutex);\n";
+            out << "for (auto it = mServices.begin(); it != mServices.end();) {\n";
+            out.indent([&] {
+                out << "const bool died = it->second->isRemote() &&\n";
+                out.indent(2, [&] {
+                    out << "::android::hardware::toBinder<" << interfaceName
+                        << ">(it->second).get() == who.unsafe_get();\n";
+                });
+                out << "it = died ? mServices.erase(it) : std::next(it);\n";
+            });
+            out << "}\n";
+        });
+        out << "}\n\n";
+
+        out << "std::mutex mMutex;\n";
+        out << "std::map<std::string, ::android::sp<" << interfaceName << ">> mServices;\n";
+    });
+    out << "};\n\n";
+}
+
 static void implementGetService(Formatter &out,
         const FQName &fqName,
-        bool isTry) {
+        bool isTry,
+        bool isCached) {
 
     const std::string interfaceName = fqName.getInterfaceName();
     const std::string functionName = isTry ? "tryGetService" : "getService";
@@ -174,21 +249,49 @@ static void implementGetService(Formatter &out,
     out << "::android::sp<" << interfaceName << "> " << interfaceName << "::" << functionName << "("
         << "const std::string &serviceName, const bool getStub) ";
     out.block([&] {
-        out << "return ::android::hardware::details::getServiceInternal<"
-            << fqName.getInterfaceProxyName()
-            << ">(serviceName, "
-            << (!isTry ? "true" : "false") // retry
-            << ", getStub);\n";
+        if (!isCached) {
+            out << "return ::android::hardware::details::getServiceInternal<"
+                << fqName.getInterfaceProxyName()
+                << ">(serviceName, "
+                << (!isTry ? "true" : "false") // retry
+                << ", getStub);\n";
+            return;
+        }
+
+        const std::string cache = "_hidl_" + interfaceName + "ServiceCache::get()";
+        out.sIf("!getStub", [&] {
+            out << "::android::sp<" << interfaceName << "> _hidl_cached = " << cache
+                << "->lookup(serviceName);\n";
+            out.sIf("_hidl_cached != nullptr", [&] {
+                out << "return _hidl_cached;\n";
+            }).endl();
+        }).endl().endl();
+
+        out << "::android::sp<" << interfaceName << "> _hidl_service =\n";
+        out.indent(2, [&] {
+            out << "::android::hardware::details::getServiceInternal<"
+                << fqName.getInterfaceProxyName()
+                << ">(serviceName, "
+                << (!isTry ? "true" : "false") // retry
+                << ", getStub);\n";
+        });
+        out.sIf("!getStub && _hidl_service != nullptr", [&] {
+            out << cache << "->insert(serviceName, _hidl_service);\n";
+        }).endl();
+        out << "return _hidl_service;\n";
     }).endl().endl();
 }
 
 static void implementServiceManagerInteractions(Formatter &out,
-        const FQName &fqName, const std::string &package) {
+        const FQName &fqName, const std::string &package, bool isCached) {
 
     const std::string interfaceName = fqName.getInterfaceName();
 
-    implementGetService(out, fqName, true /* isTry */);
-    implementGetService(out, fqName, false /* isTry */);
+    if (isCached) {
+        implementServiceCache(out, interfaceName);
+    }
+    implementGetService(out, fqName, true /* isTry */, isCached);
+    implementGetService(out, fqName, false /* isTry */, isCached);
 
     out << "::android::status_t " << interfaceName << "::registerAsService("
         << "const std::string &serviceName) ";
@@ -221,6 +324,48 @@ static void implementServiceManagerInteractions(Formatter &out,
     }).endl().endl();
 }
 
+// Helpers for the generated std::hash specializations. They are shared by all
+// generated headers, hence the guard.
+static void emitHashSupport(Formatter& out) {
+    out << "#ifndef HIDL_GENERATED_HASH_SUPPORT\n"
+        << "#define HIDL_GENERATED_HASH_SUPPORT\n\n";
+
+    out << "namespace android {\n"
+        << "namespace hardware {\n"
+        << "namespace details {\n\n";
+
+    out << "inline size_t hidl_hash_combine(size_t seed, size_t value) ";
+    out.block([&] {
+        out << "return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));\n";
+    }).endl().endl();
+
+    out << "inline size_t hidl_hash_bytes(const void* data, size_t size) ";
+    out.block([&] {
+        out << "static constexpr uint64_t kMul = 0x9ddfea08eb382d69ull;\n"
+            << "const uint8_t* bytes = static_cast<const uint8_t*>(data);\n"
+            << "uint64_t hash = 0xcbf29ce484222325ull ^ size;\n"
+            << "uint64_t word;\n";
+        out.sFor("; size >= sizeof(word); bytes += sizeof(word), size -= sizeof(word)", [&] {
+            out << "memcpy(&word, bytes, sizeof(word));\n"
+                << "hash = (hash ^ word) * kMul;\n"
+                << "hash ^= hash >> 47;\n";
+        }).endl();
+        out.sIf("size > 0", [&] {
+            out << "word = 0;\n"
+                << "memcpy(&word, bytes, size);\n"
+                << "hash = (hash ^ word) * kMul;\n"
+                << "hash ^= hash >> 47;\n";
+        }).endl();
+        out << "return static_cast<size_t>(hash);\n";
+    }).endl().endl();
+
+    out << "}  // namespace details\n"
+        << "}  // namespace hardware\n"
+        << "}  // namespace android\n\n";
+
+    out << "#endif  // HIDL_GENERATED_HASH_SUPPORT\n\n";
+}
+
 void AST::generateInterfaceHeader(Formatter& out) const {
     const Interface *iface = getInterface();
     std::string ifaceName = iface ? iface->localName() : "types";
@@ -229,8 +374,15 @@ void AST::generateInterfaceHeader(Formatter& out) const {
     out << "#ifndef " << guard << "\n";
     out << "#define " << guard << "\n\n";
 
+    std::set<FQName> forwardDeclaredNames;
+    getForwardDeclaredNames(&forwardDeclaredNames);
+
     for (const auto &item : mImportedNames) {
-        generateCppPackageInclude(out, item, item.name());
+        if (forwardDeclaredNames.find(item) != forwardDeclaredNames.end()) {
+            generateCppPackageInclude(out, item, item.name() + "Fwd");
+        } else {
+            generateCppPackageInclude(out, item, item.name());
+        }
     }
 
     if (!mImportedNames.empty()) {
@@ -245,6 +397,22 @@ void AST::generateInterfaceHeader(Formatter& out) const {
         }
     }
 
+    // for std::hash and memcmp
+    bool hasHashedTypes = false;
+    for (const auto& pair : mDefinedTypesByFullName) {
+        const Type* type = pair.second;
+        hasHashedTypes |= type->isCompoundType() && type->canCheckEquality();
+    }
+    if (hasHashedTypes) {
+        out << "#include <string.h>\n";
+        out << "#include <functional>\n\n";
+    }
+
+    if (getLatencyHistogramCount() > 0) {
+        out << "#include <atomic>\n";
+        out << "#include <chrono>\n\n";
+    }
+
     out << "#include <hidl/HidlSupport.h>\n";
     out << "#include <hidl/MQDescriptor.h>\n";
 
@@ -285,6 +453,8 @@ void AST::generateInterfaceHeader(Formatter& out) const {
                 .emit(out);
         out << "static const char* descriptor;\n\n";
 
+        generateLatencyHistogramDeclarations(out);
+
         iface->emitTypeDeclarations(out);
     } else {
         mRootScope.emitTypeDeclarations(out);
@@ -375,11 +545,14 @@ void AST::generateInterfaceHeader(Formatter& out) const {
     out << "//\n";
     out << "// type declarations for package\n";
     out << "//\n\n";
-    mRootScope.emitPackageTypeDeclarations(out);
+    const bool outOfLine = mCoordinator->outOfLineTypeDefinitions();
+    mRootScope.emitPackageTypeDeclarations(out, outOfLine);
     out << "//\n";
     out << "// type header definitions for package\n";
     out << "//\n\n";
-    mRootScope.emitPackageTypeHeaderDefinitions(out);
+    if (!outOfLine) {
+        mRootScope.emitPackageTypeHeaderDefinitions(out, false /* outOfLine */);
+    }
 
     out << "\n";
     enterLeaveNamespace(out, false /* enter */);
@@ -388,8 +561,39 @@ void AST::generateInterfaceHeader(Formatter& out) const {
     out << "//\n";
     out << "// global type declarations for package\n";
     out << "//\n\n";
+
+    if (hasHashedTypes) {
+        emitHashSupport(out);
+    }
+
     mRootScope.emitGlobalTypeDeclarations(out);
 
+    out << "//\n";
+    out << "// global type header definitions for package\n";
+    out << "//\n\n";
+    if (!outOfLine) {
+        mRootScope.emitGlobalTypeHeaderDefinitions(out, false /* outOfLine */);
+    }
+
+    out << "\n#endif  // " << guard << "\n";
+}
+
+void AST::generateInterfaceForwardHeader(Formatter& out) const {
+    const Interface* iface = getInterface();
+    CHECK(iface != nullptr);
+
+    const std::string guard = makeHeaderGuard(iface->localName() + "Fwd");
+
+    out << "#ifndef " << guard << "\n";
+    out << "#define " << guard << "\n\n";
+
+    enterLeaveNamespace(out, true /* enter */);
+    out << "\n";
+
+    out << "struct " << iface->localName() << ";\n\n";
+
+    enterLeaveNamespace(out, false /* enter */);
+
     out << "\n#endif  // " << guard << "\n";
 }
 
@@ -500,6 +704,9 @@ void AST::generatePassthroughMethod(Formatter& out, const Method* method, const
     }
 
     out << "::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();\n";
+    if (!method->isHidlReserved()) {
+        generateLatencyStart(out);
+    }
     out << "auto _hidl_return = ";
 
     if (method->isOneway()) {
@@ -508,8 +715,16 @@ void AST::generatePassthroughMethod(Formatter& out, const Method* method, const
                ", mEnableInstrumentation = this->mEnableInstrumentation, "
                "mInstrumentationCallbacks = this->mInstrumentationCallbacks\n"
             << "#endif // __ANDROID_DEBUGGABLE__\n";
-        for (const std::string& arg : wrappedArgNames) {
-            out << ", " << arg;
+        for (size_t i = 0; i < wrappedArgNames.size(); i++) {
+            // Arguments arrive by const reference, so this is their only copy;
+            // wrapped interfaces are local and can be moved into the task.
+            const std::string& arg = wrappedArgNames[i];
+            out << ", ";
+            if (arg != method->args()[i]->name()) {
+                out << arg << " = std::move(" << arg << ")";
+            } else {
+                out << arg;
+            }
         }
         out << "] {\n";
         out.indent();
@@ -594,7 +809,12 @@ void AST::generatePassthroughMethod(Formatter& out, const Method* method, const
     if (method->isOneway()) {
         out.unindent();
         out << "});\n";
-    } else {
+    }
+    if (!method->isHidlReserved()) {
+        generateLatencyRecord(out, "passthrough", std::to_string(method->getSerialId() - 1));
+    }
+
+    if (!method->isOneway()) {
         out << "if (!_hidl_error.isOk()) return _hidl_error;\n";
     }
 
@@ -833,6 +1053,48 @@ void AST::generateProxyHeader(Formatter& out) const {
     out << "\n#endif  // " << guard << "\n";
 }
 
+// Whether -S marshals type through the shared _hidl_writeToParcel and
+// _hidl_readFromParcel. Each argument or result is written once and read once,
+// so sharing only pays for the calls of the helpers if the type is passed more
+// than once.
+static bool sharesParcelHelpers(const Interface* iface, const CompoundType* type) {
+    if (!type->hasParcelHelpers()) {
+        return false;
+    }
+
+    size_t uses = 0;
+    for (const Method* method : iface->methods()) {
+        for (const auto* args : {&method->args(), &method->results()}) {
+            uses += std::count_if(args->begin(), args->end(), [&](const auto* arg) {
+                return &arg->type() == type;
+            });
+        }
+    }
+    return uses > 1;
+}
+
+void AST::generateParcelHelpers(Formatter& out, const Interface* iface) {
+    std::vector<const CompoundType*> types;
+    for (const Method* method : iface->methods()) {
+        for (const auto* args : {&method->args(), &method->results()}) {
+            for (const auto* arg : *args) {
+                if (!arg->type().isCompoundType()) {
+                    continue;
+                }
+                const auto* type = static_cast<const CompoundType*>(&arg->type());
+                if (sharesParcelHelpers(iface, type) &&
+                    std::find(types.begin(), types.end(), type) == types.end()) {
+                    types.push_back(type);
+                }
+            }
+        }
+    }
+
+    for (const CompoundType* type : types) {
+        type->emitParcelHelpers(out);
+    }
+}
+
 void AST::generateCppSource(Formatter& out) const {
     std::string baseName = getBaseName();
     const Interface *iface = getInterface();
@@ -864,6 +1126,34 @@ void AST::generateCppSource(Formatter& out) const {
         }
 
         out << "#include <hidl/ServiceManagement.h>\n";
+
+        std::set<std::string> systemHeaders;
+        if (iface->superType() != nullptr) {
+            // for the castFrom cache
+            systemHeaders.insert({"algorithm", "mutex", "unordered_map"});
+        }
+        if (iface->isServiceCached()) {
+            systemHeaders.insert({"map", "mutex"});
+        }
+        if (getLatencyHistogramCount() > 0) {
+            systemHeaders.insert({"inttypes.h", "stdio.h"});
+        }
+        const std::vector<Method*>& methods = iface->userDefinedMethods();
+        if (std::any_of(methods.begin(), methods.end(),
+                        [](const Method* method) { return method->numPackedArgs() > 0; })) {
+            // for clearing the padding of @packed arguments
+            systemHeaders.insert("cstring");
+        }
+        if (iface->hasOnewayMethods()) {
+            // for the passthrough oneway queue
+            systemHeaders.insert({"atomic", "condition_variable", "mutex", "thread"});
+        }
+        if (!systemHeaders.empty()) {
+            out << "\n";
+            for (const std::string& header : systemHeaders) {
+                out << "#include <" << header << ">\n";
+            }
+        }
     } else {
         generateCppPackageInclude(out, mPackage, "types");
         generateCppPackageInclude(out, mPackage, "hwtypes");
@@ -876,6 +1166,11 @@ void AST::generateCppSource(Formatter& out) const {
 
     generateTypeSource(out, iface ? iface->localName() : "");
 
+    const bool outOfLine = mCoordinator->outOfLineTypeDefinitions();
+    if (outOfLine) {
+        mRootScope.emitPackageTypeHeaderDefinitions(out, true /* outOfLine */);
+    }
+
     if (iface) {
         const Interface* iface = mRootScope.getInterface();
 
@@ -933,6 +1228,9 @@ void AST::generateCppSource(Formatter& out) const {
         out << "};\n\n";
 
         generateInterfaceSource(out);
+        if (mCoordinator->optimizeSize()) {
+            generateParcelHelpers(out, iface);
+        }
         generateProxySource(out, iface->fqName());
         generateStubSource(out, iface);
         generatePassthroughSource(out);
@@ -943,7 +1241,8 @@ void AST::generateCppSource(Formatter& out) const {
             std::string package = iface->fqName().package()
                     + iface->fqName().atVersion();
 
-            implementServiceManagerInteractions(out, iface->fqName(), package);
+            implementServiceManagerInteractions(out, iface->fqName(), package,
+                                                iface->isServiceCached());
         }
     }
 
@@ -951,6 +1250,11 @@ void AST::generateCppSource(Formatter& out) const {
     out << "\n";
 
     enterLeaveNamespace(out, false /* enter */);
+
+    if (outOfLine) {
+        out << "\n";
+        mRootScope.emitGlobalTypeHeaderDefinitions(out, true /* outOfLine */);
+    }
 }
 
 void AST::generateCheckNonNull(Formatter &out, const std::string &nonNull) {
@@ -967,6 +1271,30 @@ void AST::generateTypeSource(Formatter& out, const std::string& ifaceName) const
     mRootScope.emitTypeDefinitions(out, ifaceName);
 }
 
+// Declares the struct @packed arguments are marshalled as, with the layout
+// the Java backend uses for them asserted.
+void AST::declarePackedArgsStruct(Formatter& out, const Method* method) {
+    std::vector<size_t> offsets;
+    const size_t size = method->getPackedArgsLayout(&offsets);
+
+    out << "struct _hidl_packed_args_t ";
+    out.block([&] {
+        for (size_t i = 0; i < offsets.size(); i++) {
+            const NamedReference<Type>* arg = method->args()[i];
+            size_t align, size;
+            arg->type().getAlignmentAndSize(&align, &size);
+            out << arg->type().getCppStackType() << " " << arg->name()
+                << " __attribute__ ((aligned(" << align << ")));\n";
+        }
+    });
+    out << ";\n";
+    for (size_t i = 0; i < offsets.size(); i++) {
+        out << "static_assert(offsetof(_hidl_packed_args_t, " << method->args()[i]->name()
+            << ") == " << offsets[i] << ", \"wrong offset\");\n";
+    }
+    out << "static_assert(sizeof(_hidl_packed_args_t) == " << size << ", \"wrong size\");\n";
+}
+
 void AST::declareCppReaderLocals(Formatter& out, const std::vector<NamedReference<Type>*>& args,
                                  bool forResults) const {
     if (args.empty()) {
@@ -990,6 +1318,18 @@ void AST::emitCppReaderWriter(Formatter& out, const std::string& parcelObj, bool
                               bool addPrefixToName) const {
     const Type &type = arg->type();
 
+    if (mCoordinator->optimizeSize() && type.isCompoundType() &&
+        sharesParcelHelpers(getInterface(), static_cast<const CompoundType*>(&type))) {
+        static_cast<const CompoundType&>(type).emitParcelHelperCall(
+                out,
+                addPrefixToName ? ("_hidl_out_" + arg->name()) : arg->name(),
+                parcelObj,
+                parcelObjIsPointer,
+                isReader,
+                mode);
+        return;
+    }
+
     type.emitReaderWriter(
             out,
             addPrefixToName ? ("_hidl_out_" + arg->name()) : arg->name(),
@@ -1033,6 +1373,10 @@ void AST::generateProxyMethodSource(Formatter& out, const std::string& klassName
         const bool returnsValue = !method->results().empty();
         const NamedReference<Type>* elidedReturn = method->canElideCallback();
 
+        if (!method->isHidlReserved()) {
+            generateLatencyStart(out);
+        }
+
         method->generateCppReturnType(out);
 
         out << " _hidl_out = "
@@ -1060,6 +1404,11 @@ void AST::generateProxyMethodSource(Formatter& out, const std::string& klassName
 
         out << ");\n\n";
 
+        if (!method->isHidlReserved() && getLatencyHistogramCount() > 0) {
+            generateLatencyRecord(out, "client", std::to_string(method->getSerialId() - 1));
+            out << "\n";
+        }
+
         out << "return _hidl_out;\n";
     }).endl().endl();
 }
@@ -1115,14 +1464,51 @@ void AST::generateStaticProxyMethodSource(Formatter& out, const std::string& kla
     declareCppReaderLocals(
             out, method->results(), true /* forResults */);
 
+    const size_t numPackedArgs = method->numPackedArgs();
+    if (numPackedArgs > 0) {
+        declarePackedArgsStruct(out, method);
+        out << "_hidl_packed_args_t _hidl_packed_args;\n";
+        out << "size_t _hidl_packed_args_parent;\n\n";
+    }
+
+    // Reserve what the arguments are known to need up front, so that writing
+    // them does not grow (and copy) the Parcel repeatedly.
+    size_t parcelSize = (getInterface()->fqName().string().size() + 1 + 3) & ~static_cast<size_t>(3);
+    std::vector<std::string> runtimeSizes;
+    if (numPackedArgs > 0) {
+        parcelSize += Type::kBinderObjectSize;
+    }
+    for (size_t i = numPackedArgs; i < method->args().size(); i++) {
+        const NamedReference<Type>* arg = method->args()[i];
+        parcelSize += arg->type().getCppParcelSize(arg->name(), &runtimeSizes);
+    }
+    out << "_hidl_data.setDataCapacity(" << parcelSize;
+    for (const auto& runtimeSize : runtimeSizes) {
+        out << " + " << runtimeSize;
+    }
+    out << ");\n\n";
+
     out << "_hidl_err = _hidl_data.writeInterfaceToken(";
     out << klassName;
     out << "::descriptor);\n";
     out << "if (_hidl_err != ::android::OK) { goto _hidl_error; }\n\n";
 
+    if (numPackedArgs > 0) {
+        // Zeroed first, so that padding does not leak stack contents.
+        out << "::std::memset(&_hidl_packed_args, 0, sizeof(_hidl_packed_args));\n";
+        for (size_t i = 0; i < numPackedArgs; i++) {
+            const std::string& name = method->args()[i]->name();
+            out << "_hidl_packed_args." << name << " = " << name << ";\n";
+        }
+        out << "_hidl_err = _hidl_data.writeBuffer(&_hidl_packed_args, "
+               "sizeof(_hidl_packed_args), &_hidl_packed_args_parent);\n";
+        out << "if (_hidl_err != ::android::OK) { goto _hidl_error; }\n\n";
+    }
+
     bool hasInterfaceArgument = false;
     // First DFS: write all buffers and resolve pointers for parent
-    for (const auto &arg : method->args()) {
+    for (size_t i = numPackedArgs; i < method->args().size(); i++) {
+        const NamedReference<Type>* arg = method->args()[i];
         if (arg->type().isInterface()) {
             hasInterfaceArgument = true;
         }
@@ -1377,6 +1763,32 @@ void AST::generateStubSource(Formatter& out, const Interface* iface) const {
     out.unindent();
 
     out << "::android::status_t _hidl_err = ::android::OK;\n\n";
+
+    if (iface->isIBase()) {
+        generateStubSwitch(out, iface);
+    } else {
+        generateStubDispatchTable(out, iface);
+    }
+
+    out.sIf("_hidl_err == ::android::UNEXPECTED_NULL", [&] {
+        out << "_hidl_err = ::android::hardware::writeToParcel(\n";
+        out.indent(2, [&] {
+            out << "::android::hardware::Status::fromExceptionCode(::android::hardware::Status::EX_NULL_POINTER),\n";
+            out << "_hidl_reply);\n";
+        });
+    });
+
+    out << "return _hidl_err;\n";
+
+    out.unindent();
+    out << "}\n\n";
+}
+
+// IBase's reserved methods have sparse serial IDs, and some are implemented
+// inline, so they are dispatched with a switch.
+void AST::generateStubSwitch(Formatter& out, const Interface* iface) const {
+    CHECK(iface->isIBase());
+
     out << "switch (_hidl_code) {\n";
     out.indent();
 
@@ -1384,9 +1796,6 @@ void AST::generateStubSource(Formatter& out, const Interface* iface) const {
         const Method *method = tuple.method();
         const Interface *superInterface = tuple.interface();
 
-        if (!isIBase() && method->isHidlReserved()) {
-            continue;
-        }
         out << "case "
             << method->getSerialId()
             << " /* "
@@ -1408,43 +1817,77 @@ void AST::generateStubSource(Formatter& out, const Interface* iface) const {
 
     out << "default:\n{\n";
     out.indent();
-
-    if (iface->isIBase()) {
-        out << "(void)_hidl_flags;\n";
-        out << "return ::android::UNKNOWN_TRANSACTION;\n";
-    } else {
-        out << "return ";
-        out << gIBaseFqName.getInterfaceStubFqName().cppName();
-        out << "::onTransact(\n";
-
-        out.indent();
-        out.indent();
-
-        out << "_hidl_code, _hidl_data, _hidl_reply, "
-            << "_hidl_flags, _hidl_cb);\n";
-
-        out.unindent();
-        out.unindent();
-    }
-
+    out << "(void)_hidl_flags;\n";
+    out << "return ::android::UNKNOWN_TRANSACTION;\n";
     out.unindent();
     out << "}\n";
 
     out.unindent();
     out << "}\n\n";
+}
 
-    out.sIf("_hidl_err == ::android::UNEXPECTED_NULL", [&] {
-        out << "_hidl_err = ::android::hardware::writeToParcel(\n";
+// User-defined methods have consecutive serial IDs starting at
+// FIRST_CALL_TRANSACTION, so they are looked up in a table instead, which
+// takes the same time for any number of methods and any depth of the
+// inheritance chain.
+void AST::generateStubDispatchTable(Formatter& out, const Interface* iface) const {
+    const std::string baseStub = gIBaseFqName.getInterfaceStubFqName().cppName();
+
+    std::vector<InterfaceAndMethod> methods;
+    for (const auto& tuple : iface->allMethodsFromRoot()) {
+        if (tuple.method()->isHidlReserved()) continue;
+        CHECK_EQ(tuple.method()->getSerialId(), methods.size() + 1 /* FIRST_CALL_TRANSACTION */);
+        methods.push_back(tuple);
+    }
+
+    if (!methods.empty()) {
+        out << "static constexpr struct ";
+        out.block([&] {
+            out << "::android::status_t (*method)(\n";
+            out.indent(2, [&] {
+                out << "::android::hidl::base::V1_0::BnHwBase* _hidl_this,\n"
+                    << "const ::android::hardware::Parcel &_hidl_data,\n"
+                    << "::android::hardware::Parcel *_hidl_reply,\n"
+                    << "TransactCallback _hidl_cb);\n";
+            });
+            out << "bool oneway;\n";
+        });
+        out << " kMethods[] = ";
+        out.block([&] {
+            for (const auto& tuple : methods) {
+                const Method* method = tuple.method();
+                const Interface* superInterface = tuple.interface();
+                out << "{&" << superInterface->fqName().cppNamespace()
+                    << "::" << superInterface->getStubName() << "::_hidl_" << method->name()
+                    << ", " << (method->isOneway() ? "true" : "false") << "},  // "
+                    << method->getSerialId() << ": " << method->name() << "\n";
+            }
+        });
+        out << ";\n\n";
+
+        out << "const uint32_t _hidl_index = _hidl_code - 1 /* FIRST_CALL_TRANSACTION */;\n";
+        out.sIf("_hidl_index < " + std::to_string(methods.size()), [&] {
+            out << "bool _hidl_is_oneway = _hidl_flags & " << Interface::FLAG_ONE_WAY->cppValue()
+                << ";\n";
+            out.sIf("_hidl_is_oneway != kMethods[_hidl_index].oneway", [&] {
+                out << "return ::android::UNKNOWN_ERROR;\n";
+            }).endl().endl();
+            generateLatencyStart(out);
+            out << "_hidl_err = kMethods[_hidl_index].method(this, _hidl_data, _hidl_reply, "
+                   "_hidl_cb);\n";
+            generateLatencyRecord(out, "server", "_hidl_index");
+        }).sElse([&] {
+            out << "return " << baseStub << "::onTransact(\n";
+            out.indent(2, [&] {
+                out << "_hidl_code, _hidl_data, _hidl_reply, _hidl_flags, _hidl_cb);\n";
+            });
+        }).endl().endl();
+    } else {
+        out << "return " << baseStub << "::onTransact(\n";
         out.indent(2, [&] {
-            out << "::android::hardware::Status::fromExceptionCode(::android::hardware::Status::EX_NULL_POINTER),\n";
-            out << "_hidl_reply);\n";
+            out << "_hidl_code, _hidl_data, _hidl_reply, _hidl_flags, _hidl_cb);\n";
         });
-    });
-
-    out << "return _hidl_err;\n";
-
-    out.unindent();
-    out << "}\n\n";
+    }
 }
 
 void AST::generateStubSourceForMethod(Formatter& out, const Method* method,
@@ -1504,8 +1947,24 @@ void AST::generateStaticStubMethodSource(Formatter& out, const FQName& fqName,
 
     declareCppReaderLocals(out, method->args(), false /* forResults */);
 
+    const size_t numPackedArgs = method->numPackedArgs();
+    if (numPackedArgs > 0) {
+        declarePackedArgsStruct(out, method);
+        out << "const _hidl_packed_args_t* _hidl_packed_args;\n";
+        out << "size_t _hidl_packed_args_parent;\n\n";
+        out << "_hidl_err = _hidl_data.readBuffer(sizeof(*_hidl_packed_args), "
+               "&_hidl_packed_args_parent, reinterpret_cast<const void**>(&_hidl_packed_args));\n";
+        out << "if (_hidl_err != ::android::OK) { return _hidl_err; }\n\n";
+        for (size_t i = 0; i < numPackedArgs; i++) {
+            const std::string& name = method->args()[i]->name();
+            out << name << " = _hidl_packed_args->" << name << ";\n";
+        }
+        out << "\n";
+    }
+
     // First DFS: write buffers
-    for (const auto &arg : method->args()) {
+    for (size_t i = numPackedArgs; i < method->args().size(); i++) {
+        const NamedReference<Type>* arg = method->args()[i];
         emitCppReaderWriter(
                 out,
                 "_hidl_data",
@@ -1723,11 +2182,19 @@ void AST::generatePassthroughHeader(Formatter& out) const {
     out << "#include <future>\n";
 
     generateCppPackageInclude(out, mPackage, iface->localName());
+
+    // the wrappers pass these to wrapPassthrough, which needs them complete
+    std::set<FQName> forwardDeclaredNames;
+    getForwardDeclaredNames(&forwardDeclaredNames);
+    for (const auto& item : forwardDeclaredNames) {
+        generateCppPackageInclude(out, item, item.name());
+    }
     out << "\n";
 
     out << "#include <hidl/HidlPassthroughSupport.h>\n";
     if (supportOneway) {
-        out << "#include <hidl/TaskRunner.h>\n";
+        out << "#include <functional>\n";
+        out << "#include <memory>\n";
     }
 
     enterLeaveNamespace(out, true /* enter */);
@@ -1745,10 +2212,21 @@ void AST::generatePassthroughHeader(Formatter& out) const {
         << iface->localName()
         << "> impl);\n";
 
+    if (supportOneway) {
+        out << "~" << klassName << "();\n";
+    }
+
     out.endl();
     generateTemplatizationLink(out);
     generateCppTag(out, "android::hardware::details::bs_tag");
 
+    if (supportOneway) {
+        DocComment("Number of oneway calls queued and not yet started.").emit(out);
+        out << "size_t getOnewayQueueDepth() const;\n\n";
+        DocComment("Number of oneway calls rejected because the queue was full.").emit(out);
+        out << "uint64_t getOnewayDropCount() const;\n\n";
+    }
+
     generateMethods(out, [&](const Method* method, const Interface* superInterface) {
         generatePassthroughMethod(out, method, superInterface);
     });
@@ -1759,12 +2237,13 @@ void AST::generatePassthroughHeader(Formatter& out) const {
     out << "const ::android::sp<" << iface->localName() << "> mImpl;\n";
 
     if (supportOneway) {
-        out << "::android::hardware::details::TaskRunner mOnewayQueue;\n";
+        out << "struct OnewayQueue;\n";
+        out << "const std::shared_ptr<OnewayQueue> mOnewayQueue;\n";
 
         out << "\n";
 
         out << "::android::hardware::Return<void> addOnewayTask("
-               "std::function<void(void)>);\n\n";
+               "std::function<void(void)>&& task);\n\n";
     }
 
     out.unindent();
@@ -1776,6 +2255,84 @@ void AST::generatePassthroughHeader(Formatter& out) const {
     out << "\n#endif  // " << guard << "\n";
 }
 
+// Remembers whether remote binders can be cast to the interface, so that
+// castFrom only fetches their interfaceChain() once.
+static void generateCastCache(Formatter& out, const std::string& klassName) {
+    out << "// Whether remote binders implement this interface, by binder. Entries are\n"
+        << "// evicted when their binder dies, and ignored once it has been destroyed.\n";
+    out << "struct " << klassName
+        << " : public ::android::hardware::IBinder::DeathRecipient {\n";
+    out.indent([&] {
+        out << "static " << klassName << "* get() {\n";
+        out.indent([&] {
+            out << "// never destroyed, since binder threads may still use it at exit\n";
+            out << "static " << klassName << "* const sCache = [] {\n";
+            out.indent([&] {
+                out << klassName << "* cache = new " << klassName << "();\n";
+                out << "cache->incStrong(nullptr);\n";
+                out << "return cache;\n";
+            });
+            out << "}();\n";
+            out << "return sCache;\n";
+        });
+        out << "}\n\n";
+
+        out << "bool lookup(const ::android::sp<::android::hardware::IBinder>& binder, "
+               "bool* canCast) {\n";
+        out.indent([&] {
+            out << "std::lock_guard<std::mutex> lock(mMutex);\n";
+            out << "auto it = mEntries.find(binder.get());\n";
+            out.sIf("it == mEntries.end() || it->second.binder.promote() != binder", [&] {
+                out << "return false;\n";
+            }).endl();
+            out << "*canCast = it->second.canCast;\n";
+            out << "return true;\n";
+        });
+        out << "}\n\n";
+
+        out << "void insert(const ::android::sp<::android::hardware::IBinder>& binder, "
+               "bool canCast) {\n";
+        out.indent([&] {
+            out.sIf("binder->linkToDeath(this) != ::android::OK", [&] {
+                out << "return;\n";
+            }).endl();
+            out << "std::lock_guard<std::mutex> lock(mMutex);\n";
+            out.sIf("mEntries.size() >= mSweepSize", [&] {
+                out << "// drop the entries of destroyed binders\n";
+                out << "for (auto it = mEntries.begin(); it != mEntries.end();) {\n";
+                out.indent([&] {
+                    out << "it = it->second.binder.promote() == nullptr ? mEntries.erase(it) "
+                           ": std::next(it);\n";
+                });
+                out << "}\n";
+                out << "mSweepSize = 2 * std::max<size_t>(mEntries.size(), 16);\n";
+            }).endl();
+            out << "mEntries[binder.get()] = {binder, canCast};\n";
+        });
+        out << "}\n\n";
+
+        out << "void binderDied(const ::android::wp<::android::hardware::IBinder>& who) "
+               "override {\n";
+        out.indent([&] {
+            out << "std::lock_guard<std::mutex> lock(mMutex);\n";
+            out << "mEntries.erase(who.unsafe_get());\n";
+        });
+        out << "}\n\n";
+
+        out << "struct Entry {\n";
+        out.indent([&] {
+            out << "::android::wp<::android::hardware::IBinder> binder;\n";
+            out << "bool canCast;\n";
+        });
+        out << "};\n\n";
+
+        out << "std::mutex mMutex;\n";
+        out << "std::unordered_map<const ::android::hardware::IBinder*, Entry> mEntries;\n";
+        out << "size_t mSweepSize = 16;\n";
+    });
+    out << "};\n\n";
+}
+
 void AST::generateInterfaceSource(Formatter& out) const {
     const Interface* iface = mRootScope.getInterface();
 
@@ -1789,7 +2346,16 @@ void AST::generateInterfaceSource(Formatter& out) const {
             out << "// no default implementation for: ";
         }
         method->generateCppSignature(out, iface->localName());
-        if (reserved) {
+        if (reserved && method->name() == "debug" &&
+            getLatencyHistogramCount() > 0) {
+            out.block([&]() {
+                out.sIf("fd.getNativeHandle() != nullptr && fd->numFds > 0", [&] {
+                    out << "_hidl_dumpLatency(fd->data[0]);\n";
+                }).endl();
+                out << "(void)options;\n";
+                out << "return ::android::hardware::Void();\n";
+            }).endl();
+        } else if (reserved) {
             out.block([&]() {
                 method->cppImpl(IMPL_INTERFACE, out);
             }).endl();
@@ -1800,6 +2366,11 @@ void AST::generateInterfaceSource(Formatter& out) const {
         return;
     });
 
+    const std::string castCache = "_hidl_" + iface->localName() + "CastCache";
+    if (iface->superType() != nullptr) {
+        generateCastCache(out, castCache);
+    }
+
     for (const Interface *superType : iface->typeChain()) {
         out << "::android::hardware::Return<"
             << childTypeResult
@@ -1814,22 +2385,173 @@ void AST::generateInterfaceSource(Formatter& out) const {
         if (iface == superType) {
             out << "return parent;\n";
         } else {
-            out << "return ::android::hardware::details::castInterface<";
-            out << iface->localName() << ", "
-                << superType->fqName().cppName() << ", "
-                << iface->getProxyName()
-                << ">(\n";
-            out.indent();
-            out.indent();
-            out << "parent, \""
-                << iface->fqName().string()
-                << "\", emitError);\n";
-            out.unindent();
-            out.unindent();
+            out.sIf("parent == nullptr || !parent->isRemote()", [&] {
+                out << "return ::android::hardware::details::castInterface<";
+                out << iface->localName() << ", "
+                    << superType->fqName().cppName() << ", "
+                    << iface->getProxyName()
+                    << ">(\n";
+                out.indent(2, [&] {
+                    out << "parent, \""
+                        << iface->fqName().string()
+                        << "\", emitError);\n";
+                });
+            }).endl().endl();
+
+            out << "// Remote objects don't change interfaces, so interfaceChain() is only\n"
+                << "// called once per binder.\n";
+            out << "const ::android::sp<::android::hardware::IBinder> _hidl_binder =\n";
+            out.indent(2, [&] {
+                out << "::android::hardware::toBinder<" << superType->fqName().cppName()
+                    << ">(parent);\n";
+            });
+            out << "bool _hidl_canCast;\n";
+            out.sIf(castCache + "::get()->lookup(_hidl_binder, &_hidl_canCast)", [&] {
+                out.sIf("!_hidl_canCast", [&] {
+                    out << "return " << childTypeResult << "(nullptr);\n";
+                }).endl();
+                out << "return " << childTypeResult << "(new " << iface->getProxyName()
+                    << "(_hidl_binder));\n";
+            }).endl().endl();
+
+            out << "// Errors are always requested, so that a failed interfaceChain() call isn't\n"
+                << "// taken for, and cached as, an interface the binder doesn't implement.\n";
+            out << "::android::hardware::Return<bool> _hidl_canCast_ret =\n";
+            out.indent(2, [&] {
+                out << "::android::hardware::details::canCastInterface(parent.get(), \""
+                    << iface->fqName().string() << "\", true /* emitError */);\n";
+            });
+            out.sIf("!_hidl_canCast_ret.isOk()", [&] {
+                out.sIf("emitError", [&] {
+                    out << "return ::android::hardware::details::StatusOf<bool, "
+                        << childTypeResult << ">(_hidl_canCast_ret);\n";
+                }).endl();
+                out << "return " << childTypeResult << "(nullptr);\n";
+            }).endl().endl();
+
+            out << "_hidl_canCast = _hidl_canCast_ret;\n";
+            out << castCache << "::get()->insert(_hidl_binder, _hidl_canCast);\n";
+            out.sIf("!_hidl_canCast", [&] {
+                out << "return " << childTypeResult << "(nullptr);\n";
+            }).endl();
+            out << "return " << childTypeResult << "(new " << iface->getProxyName()
+                << "(_hidl_binder));\n";
         }
         out.unindent();
         out << "}\n\n";
     }
+
+    generateLatencyHistogramSource(out);
+}
+
+// Bounded multi-producer, single-consumer ring of oneway calls. Each slot
+// carries a sequence number, as in Vyukov's bounded queue: producers claim a
+// slot with a CAS on mTail, and a single thread runs the tasks in claim
+// order. The mutex is only taken to wake that thread up when it is idle.
+static void generateOnewayQueue(Formatter& out, const std::string& klassName) {
+    out << "struct " << klassName
+        << "::OnewayQueue : public std::enable_shared_from_this<OnewayQueue> {\n";
+    out.indent([&] {
+        out << "struct Slot {\n";
+        out.indent([&] {
+            out << "std::atomic<size_t> sequence;\n";
+            out << "std::function<void(void)> task;\n";
+        });
+        out << "};\n\n";
+
+        out << "explicit OnewayQueue(size_t capacity) : mCapacity(capacity), "
+               "mSlots(new Slot[capacity]) {\n";
+        out.indent([&] {
+            out << "for (size_t i = 0; i < mCapacity; i++) {\n";
+            out.indent([&] { out << "mSlots[i].sequence.store(i, std::memory_order_relaxed);\n"; });
+            out << "}\n";
+        });
+        out << "}\n\n";
+
+        out << "bool push(std::function<void(void)>&& task) {\n";
+        out.indent([&] {
+            out << "std::call_once(mStarted, [self = shared_from_this()] {\n";
+            out.indent([&] { out << "std::thread([self] { self->run(); }).detach();\n"; });
+            out << "});\n\n";
+
+            out << "size_t tail = mTail.load(std::memory_order_relaxed);\n";
+            out << "for (;;) {\n";
+            out.indent([&] {
+                out << "Slot& slot = mSlots[tail % mCapacity];\n";
+                out << "const intptr_t diff = static_cast<intptr_t>(\n";
+                out.indent(2, [&] {
+                    out << "slot.sequence.load(std::memory_order_acquire) - tail);\n";
+                });
+                out.sIf("diff == 0", [&] {
+                    out.sIf("mTail.compare_exchange_weak(tail, tail + 1, "
+                            "std::memory_order_relaxed)",
+                            [&] {
+                                out << "slot.task = std::move(task);\n";
+                                out << "slot.sequence.store(tail + 1);\n";
+                                out << "break;\n";
+                            })
+                        .endl();
+                }).sElseIf("diff < 0", [&] {
+                    out << "// the consumer has not emptied this slot yet\n";
+                    out << "mDropped.fetch_add(1, std::memory_order_relaxed);\n";
+                    out << "return false;\n";
+                }).sElse([&] {
+                    out << "tail = mTail.load(std::memory_order_relaxed);\n";
+                }).endl();
+            });
+            out << "}\n\n";
+
+            out.sIf("mWaiting.load()", [&] {
+                out << "std::lock_guard<std::mutex> lock(mMutex);\n";
+                out << "mCondition.notify_one();\n";
+            }).endl();
+            out << "return true;\n";
+        });
+        out << "}\n\n";
+
+        out << "void stop() {\n";
+        out.indent([&] {
+            out << "std::lock_guard<std::mutex> lock(mMutex);\n";
+            out << "mStopped = true;\n";
+            out << "mCondition.notify_one();\n";
+        });
+        out << "}\n\n";
+
+        out << "void run() {\n";
+        out.indent([&] {
+            out << "for (size_t head = 0;; head++) {\n";
+            out.indent([&] {
+                out << "Slot& slot = mSlots[head % mCapacity];\n";
+                out << "auto ready = [&] { return slot.sequence.load() == head + 1; };\n";
+                out.sIf("!ready()", [&] {
+                    out << "std::unique_lock<std::mutex> lock(mMutex);\n";
+                    out << "mWaiting.store(true);\n";
+                    out << "mCondition.wait(lock, [&] { return ready() || mStopped; });\n";
+                    out << "mWaiting.store(false);\n";
+                    out << "if (!ready()) return;\n";
+                }).endl();
+                out << "std::function<void(void)> task = std::move(slot.task);\n";
+                out << "slot.task = nullptr;\n";
+                out << "slot.sequence.store(head + mCapacity, std::memory_order_release);\n";
+                out << "mHead.store(head + 1, std::memory_order_relaxed);\n";
+                out << "task();\n";
+            });
+            out << "}\n";
+        });
+        out << "}\n\n";
+
+        out << "const size_t mCapacity;\n";
+        out << "const std::unique_ptr<Slot[]> mSlots;\n";
+        out << "std::atomic<size_t> mHead{0};\n";
+        out << "std::atomic<size_t> mTail{0};\n";
+        out << "std::atomic<uint64_t> mDropped{0};\n";
+        out << "std::atomic<bool> mWaiting{false};\n";
+        out << "std::once_flag mStarted;\n";
+        out << "std::mutex mMutex;\n";
+        out << "std::condition_variable mCondition;\n";
+        out << "bool mStopped = false;\n";
+    });
+    out << "};\n\n";
 }
 
 void AST::generatePassthroughSource(Formatter& out) const {
@@ -1837,6 +2559,10 @@ void AST::generatePassthroughSource(Formatter& out) const {
 
     const std::string klassName = iface->getPassthroughName();
 
+    if (iface->hasOnewayMethods()) {
+        generateOnewayQueue(out, klassName);
+    }
+
     out << klassName
         << "::"
         << klassName
@@ -1846,21 +2572,43 @@ void AST::generatePassthroughSource(Formatter& out) const {
         << mPackage.string()
         << "\", \""
         << iface->localName()
-        << "\"), mImpl(impl) {";
+        << "\"), mImpl(impl)";
     if (iface->hasOnewayMethods()) {
-        out << "\n";
-        out.indent([&] {
-            out << "mOnewayQueue.start(3000 /* similar limit to binderized */);\n";
+        out << ",\n";
+        out.indent(2, [&] {
+            out << "mOnewayQueue(std::make_shared<OnewayQueue>("
+                << iface->getOnewayQueueCapacity() << ")) {}\n\n";
         });
+    } else {
+        out << " {}\n\n";
     }
-    out << "}\n\n";
 
     if (iface->hasOnewayMethods()) {
+        out << klassName << "::~" << klassName << "() {\n";
+        out.indent([&] {
+            out << "// the consumer thread finishes the queued calls, then exits\n";
+            out << "mOnewayQueue->stop();\n";
+        });
+        out << "}\n\n";
+
+        out << "size_t " << klassName << "::getOnewayQueueDepth() const {\n";
+        out.indent([&] {
+            out << "return mOnewayQueue->mTail.load(std::memory_order_relaxed) -\n";
+            out.indent(2, [&] { out << "mOnewayQueue->mHead.load(std::memory_order_relaxed);\n"; });
+        });
+        out << "}\n\n";
+
+        out << "uint64_t " << klassName << "::getOnewayDropCount() const {\n";
+        out.indent([&] {
+            out << "return mOnewayQueue->mDropped.load(std::memory_order_relaxed);\n";
+        });
+        out << "}\n\n";
+
         out << "::android::hardware::Return<void> "
             << klassName
-            << "::addOnewayTask(std::function<void(void)> fun) {\n";
+            << "::addOnewayTask(std::function<void(void)>&& task) {\n";
         out.indent();
-        out << "if (!mOnewayQueue.push(fun)) {\n";
+        out << "if (!mOnewayQueue->push(std::move(task))) {\n";
         out.indent();
         out << "return ::android::hardware::Status::fromExceptionCode(\n";
         out.indent();
@@ -1876,8 +2624,6 @@ void AST::generatePassthroughSource(Formatter& out) const {
 
         out.unindent();
         out << "}\n\n";
-
-
     }
 }
 
@@ -1929,20 +2675,16 @@ void AST::generateCppInstrumentationCall(
         const Interface* superInterface) const {
     generateCppAtraceCall(out, event, method);
 
-    out << "#ifdef __ANDROID_DEBUGGABLE__\n";
-    out << "if (UNLIKELY(mEnableInstrumentation)) {\n";
-    out.indent();
-    out << "std::vector<void *> _hidl_args;\n";
+    // Pointers to the arguments or results the callbacks receive.
+    std::vector<std::string> argPointers;
     std::string event_str = "";
     switch (event) {
         case SERVER_API_ENTRY:
         {
             event_str = "InstrumentationEvent::SERVER_API_ENTRY";
             for (const auto &arg : method->args()) {
-                out << "_hidl_args.push_back((void *)"
-                    << (arg->type().resultNeedsDeref() ? "" : "&")
-                    << arg->name()
-                    << ");\n";
+                argPointers.push_back(std::string("(void *)") +
+                                      (arg->type().resultNeedsDeref() ? "" : "&") + arg->name());
             }
             break;
         }
@@ -1950,9 +2692,7 @@ void AST::generateCppInstrumentationCall(
         {
             event_str = "InstrumentationEvent::SERVER_API_EXIT";
             for (const auto &arg : method->results()) {
-                out << "_hidl_args.push_back((void *)&_hidl_out_"
-                    << arg->name()
-                    << ");\n";
+                argPointers.push_back("(void *)&_hidl_out_" + arg->name());
             }
             break;
         }
@@ -1960,9 +2700,7 @@ void AST::generateCppInstrumentationCall(
         {
             event_str = "InstrumentationEvent::CLIENT_API_ENTRY";
             for (const auto &arg : method->args()) {
-                out << "_hidl_args.push_back((void *)&"
-                    << arg->name()
-                    << ");\n";
+                argPointers.push_back("(void *)&" + arg->name());
             }
             break;
         }
@@ -1970,11 +2708,9 @@ void AST::generateCppInstrumentationCall(
         {
             event_str = "InstrumentationEvent::CLIENT_API_EXIT";
             for (const auto &arg : method->results()) {
-                out << "_hidl_args.push_back((void *)"
-                    << (arg->type().resultNeedsDeref() ? "" : "&")
-                    << "_hidl_out_"
-                    << arg->name()
-                    << ");\n";
+                argPointers.push_back(std::string("(void *)") +
+                                      (arg->type().resultNeedsDeref() ? "" : "&") + "_hidl_out_" +
+                                      arg->name());
             }
             break;
         }
@@ -1982,9 +2718,7 @@ void AST::generateCppInstrumentationCall(
         {
             event_str = "InstrumentationEvent::PASSTHROUGH_ENTRY";
             for (const auto &arg : method->args()) {
-                out << "_hidl_args.push_back((void *)&"
-                    << arg->name()
-                    << ");\n";
+                argPointers.push_back("(void *)&" + arg->name());
             }
             break;
         }
@@ -1992,9 +2726,7 @@ void AST::generateCppInstrumentationCall(
         {
             event_str = "InstrumentationEvent::PASSTHROUGH_EXIT";
             for (const auto &arg : method->results()) {
-                out << "_hidl_args.push_back((void *)&_hidl_out_"
-                    << arg->name()
-                    << ");\n";
+                argPointers.push_back("(void *)&_hidl_out_" + arg->name());
             }
             break;
         }
@@ -2004,6 +2736,23 @@ void AST::generateCppInstrumentationCall(
         }
     }
 
+    out << "#ifdef __ANDROID_DEBUGGABLE__\n";
+    out << "if (UNLIKELY(mEnableInstrumentation)) {\n";
+    out.indent();
+    // The pointers are gathered on the stack. InstrumentationCallback takes a
+    // std::vector, which is built from them with at most one allocation, and
+    // none for events without arguments.
+    if (argPointers.empty()) {
+        out << "std::vector<void *> _hidl_args;\n";
+    } else {
+        out << "void *_hidl_arg_pointers[] = {";
+        out.join(argPointers.begin(), argPointers.end(), ", ",
+                 [&](const std::string& pointer) { out << pointer; });
+        out << "};\n";
+        out << "std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + "
+            << argPointers.size() << ");\n";
+    }
+
     out << "for (const auto &callback: mInstrumentationCallbacks) {\n";
     out.indent();
     out << "callback("
@@ -2024,4 +2773,134 @@ void AST::generateCppInstrumentationCall(
     out << "#endif // __ANDROID_DEBUGGABLE__\n\n";
 }
 
+// Histograms have one bucket per power of two nanoseconds, up to ~9 minutes.
+static constexpr size_t kLatencyBuckets = 40;
+static const char* const kLatencySides[] = {"client", "server", "passthrough"};
+
+size_t AST::getLatencyHistogramCount() const {
+    const Interface* iface = getInterface();
+    if (!mCoordinator->emitLatencyHistograms() || iface == nullptr || iface->isIBase()) {
+        return 0;
+    }
+
+    size_t count = 0;
+    for (const auto& tuple : iface->allMethodsFromRoot()) {
+        if (!tuple.method()->isHidlReserved()) count++;
+    }
+    return count;
+}
+
+void AST::generateLatencyHistogramDeclarations(Formatter& out) const {
+    const size_t count = getLatencyHistogramCount();
+    if (count == 0) return;
+
+    DocComment("Latency histogram of one method: bucket i counts the calls which took [2^i, "
+               "2^(i+1)) nanoseconds. Recorded without locks or allocations.")
+            .emit(out);
+    out << "struct _hidl_MethodLatency {\n";
+    out.indent([&] {
+        out << "std::atomic<uint64_t> buckets[" << kLatencyBuckets << "];\n\n";
+        out << "void record(std::chrono::steady_clock::time_point start) {\n";
+        out.indent([&] {
+            out << "const uint64_t nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(\n";
+            out.indent(2, [&] { out << "std::chrono::steady_clock::now() - start).count();\n"; });
+            out << "const size_t bucket = nanos == 0 ? 0 : 63 - __builtin_clzll(nanos);\n";
+            out << "buckets[bucket < " << kLatencyBuckets << " ? bucket : " << kLatencyBuckets - 1
+                << "].fetch_add(1, std::memory_order_relaxed);\n";
+        });
+        out << "}\n";
+    });
+    out << "};\n\n";
+
+    DocComment("Latencies of the methods of this interface and its parents, by serial ID - 1, as "
+               "seen by proxies, stubs and passthrough wrappers. Printed by debug().")
+            .emit(out);
+    for (const char* side : kLatencySides) {
+        out << "static _hidl_MethodLatency _hidl_" << side << "Latency[" << count << "];\n";
+    }
+    out << "static void _hidl_dumpLatency(int fd);\n\n";
+}
+
+void AST::generateLatencyHistogramSource(Formatter& out) const {
+    const size_t count = getLatencyHistogramCount();
+    if (count == 0) return;
+
+    const Interface* iface = getInterface();
+    const std::string klassName = iface->localName();
+
+    for (const char* side : kLatencySides) {
+        out << klassName << "::_hidl_MethodLatency " << klassName << "::_hidl_" << side
+            << "Latency[" << count << "];\n";
+    }
+    out << "\n";
+
+    out << "void " << klassName << "::_hidl_dumpLatency(int fd) {\n";
+    out.indent([&] {
+        out << "static constexpr const char* kMethodNames[] = {\n";
+        out.indent([&] {
+            for (const auto& tuple : iface->allMethodsFromRoot()) {
+                if (tuple.method()->isHidlReserved()) continue;
+                out << "\"" << tuple.interface()->localName() << "::" << tuple.method()->name()
+                    << "\",\n";
+            }
+        });
+        out << "};\n";
+        out << "static const struct { const char* name; const _hidl_MethodLatency* latencies; } "
+               "kSides[] = {\n";
+        out.indent([&] {
+            for (const char* side : kLatencySides) {
+                out << "{\"" << side << "\", _hidl_" << side << "Latency},\n";
+            }
+        });
+        out << "};\n\n";
+
+        out << "dprintf(fd, \"%-12s %-40s %12s %12s %12s\\n\", \"side\", \"method\", \"calls\", "
+               "\"p50 (us)\", \"p99 (us)\");\n";
+        out << "for (const auto& side : kSides) {\n";
+        out.indent([&] {
+            out << "for (size_t i = 0; i < " << count << "; i++) {\n";
+            out.indent([&] {
+                out << "uint64_t buckets[" << kLatencyBuckets << "];\n";
+                out << "uint64_t calls = 0;\n";
+                out << "for (size_t b = 0; b < " << kLatencyBuckets << "; b++) {\n";
+                out.indent([&] {
+                    out << "buckets[b] = side.latencies[i].buckets[b].load("
+                           "std::memory_order_relaxed);\n";
+                    out << "calls += buckets[b];\n";
+                });
+                out << "}\n";
+                out << "if (calls == 0) continue;\n\n";
+                out << "// upper bound of the bucket holding the given fraction of the calls\n";
+                out << "auto percentile = [&](uint64_t permille) {\n";
+                out.indent([&] {
+                    out << "const uint64_t rank = (calls * permille + 999) / 1000;\n";
+                    out << "uint64_t seen = 0;\n";
+                    out << "size_t b = 0;\n";
+                    out << "while ((seen += buckets[b]) < rank) b++;\n";
+                    out << "return static_cast<double>(2ull << b) / 1000;\n";
+                });
+                out << "};\n";
+                out << "dprintf(fd, \"%-12s %-40s %12\" PRIu64 \" %12.1f %12.1f\\n\", side.name, "
+                       "kMethodNames[i], calls,\n";
+                out.indent(2, [&] { out << "percentile(500), percentile(990));\n"; });
+            });
+            out << "}\n";
+        });
+        out << "}\n";
+    });
+    out << "}\n\n";
+}
+
+void AST::generateLatencyStart(Formatter& out) const {
+    if (getLatencyHistogramCount() == 0) return;
+    out << "const auto _hidl_latency_start = std::chrono::steady_clock::now();\n";
+}
+
+void AST::generateLatencyRecord(Formatter& out, const std::string& side,
+                                const std::string& index) const {
+    if (getLatencyHistogramCount() == 0) return;
+    out << getInterface()->localName() << "::_hidl_" << side << "Latency[" << index
+        << "].record(_hidl_latency_start);\n";
+}
+
 }  // namespace android
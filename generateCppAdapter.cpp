@@ -34,6 +34,23 @@
 
 namespace android {
 
+// Whether any method of the interface passes interfaces, which then need adapters.
+static bool passesInterfaces(const Interface* iface) {
+    for (const auto& tuple : iface->allMethodsFromRoot()) {
+        const Method* method = tuple.method();
+        if (method->isHidlReserved()) {
+            continue;
+        }
+        for (const auto* args : {&method->args(), &method->results()}) {
+            if (std::any_of(args->begin(), args->end(),
+                            [](const auto* arg) { return arg->get()->isInterface(); })) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 void AST::generateCppAdapterHeader(Formatter& out) const {
     const std::string klassName = AST::isInterface() ? getInterface()->getAdapterName() : "Atypes";
     const std::string guard = makeHeaderGuard(klassName, true /* indicateGenerated */);
@@ -43,6 +60,14 @@ void AST::generateCppAdapterHeader(Formatter& out) const {
 
     if (AST::isInterface()) {
         generateCppPackageInclude(out, mPackage, getInterface()->localName());
+        if (passesInterfaces(getInterface())) {
+            out.endl();
+            out << "#include <algorithm>\n";
+            out << "#include <map>\n";
+            out << "#include <mutex>\n";
+            out << "#include <utility>\n";
+            out.endl();
+        }
 
         enterLeaveNamespace(out, true /* enter */);
         out.endl();
@@ -66,7 +91,30 @@ void AST::generateCppAdapterHeader(Formatter& out) const {
                 out << " override;\n";
             });
             out << "private:\n";
+            if (!passesInterfaces(getInterface())) {
+                out << "::android::sp<" << mockName << "> mImpl;\n";
+                return;
+            }
+
+            out << "// Returns the adapter of impl, reusing it while anyone holds it. Only weak\n"
+                << "// references are cached, so objects the implementation does not keep get a\n"
+                << "// new adapter on every call, after a lookup and an insert in the cache.\n";
+            out << "template <typename Interface, typename MakeAdapter>\n";
+            out << "::android::sp<Interface> _hidl_adapt(const ::android::sp<Interface>& impl, "
+                   "const MakeAdapter& makeAdapter);\n\n";
+
+            out << "struct AdapterEntry {\n";
+            out.indent([&] {
+                out << "::android::wp<::android::RefBase> impl;\n";
+                out << "::android::wp<::android::hidl::base::V1_0::IBase> adapter;\n";
+            });
+            out << "};\n\n";
+
             out << "::android::sp<" << mockName << "> mImpl;\n";
+            out << "// adapters of the interfaces passed through this one, by object and type\n";
+            out << "std::mutex mAdaptersLock;\n";
+            out << "std::map<std::pair<const void*, const char*>, AdapterEntry> mAdapters;\n";
+            out << "size_t mAdaptersSweepSize = 16;\n";
 
         }) << ";\n\n";
 
@@ -78,12 +126,74 @@ void AST::generateCppAdapterHeader(Formatter& out) const {
     out << "#endif // " << guard << "\n";
 }
 
+static void generateAdapterCache(Formatter& out, const std::string& klassName) {
+    out << "\n\n";
+    out << "template <typename Interface, typename MakeAdapter>\n";
+    out << "::android::sp<Interface> " << klassName << "::_hidl_adapt(\n";
+    out.indent(2, [&] {
+        out << "const ::android::sp<Interface>& impl, const MakeAdapter& makeAdapter) ";
+    });
+    out.block([&] {
+        out.sIf("impl == nullptr", [&] { out << "return nullptr;\n"; }).endl().endl();
+
+        out << "// Remote objects are identified by their binder, since every transaction\n"
+            << "// which passes one may create a new proxy for it.\n";
+        out << "const ::android::sp<::android::RefBase> identity = impl->isRemote()\n";
+        out.indent(2, [&] {
+            out << "? ::android::sp<::android::RefBase>(::android::hardware::toBinder<Interface>(impl))\n";
+            out << ": ::android::sp<::android::RefBase>(impl);\n";
+        });
+        out << "const auto key = std::make_pair(static_cast<const void*>(identity.get()), "
+               "Interface::descriptor);\n\n";
+
+        const auto lookup = [&] {
+            out << "auto it = mAdapters.find(key);\n";
+            out.sIf("it != mAdapters.end() && it->second.impl.promote() == identity", [&] {
+                out << "::android::sp<::android::hidl::base::V1_0::IBase> cached = "
+                       "it->second.adapter.promote();\n";
+                out.sIf("cached != nullptr", [&] {
+                    out << "return static_cast<Interface*>(cached.get());\n";
+                }).endl();
+            }).endl();
+        };
+
+        out.block([&] {
+            out << "std::lock_guard<std::mutex> lock(mAdaptersLock);\n";
+            lookup();
+        }).endl().endl();
+
+        out << "// Not under the lock, as adapting a remote object calls into it.\n";
+        out << "::android::sp<Interface> adapter = makeAdapter();\n";
+        out.sIf("adapter == nullptr", [&] { out << "return adapter;\n"; }).endl().endl();
+
+        out << "std::lock_guard<std::mutex> lock(mAdaptersLock);\n";
+        out << "// another thread may have adapted the same object meanwhile\n";
+        lookup();
+        out.endl();
+        out.sIf("mAdapters.size() >= mAdaptersSweepSize", [&] {
+            out << "// drop the entries of destroyed adapters\n";
+            out << "for (auto entry = mAdapters.begin(); entry != mAdapters.end();) {\n";
+            out.indent([&] {
+                out << "entry = entry->second.adapter.promote() == nullptr "
+                       "? mAdapters.erase(entry) : std::next(entry);\n";
+            });
+            out << "}\n";
+            out << "mAdaptersSweepSize = 2 * std::max<size_t>(mAdapters.size(), 16);\n";
+        }).endl();
+        out << "mAdapters[key] = {identity, adapter};\n";
+        out << "return adapter;\n";
+    }).endl().endl();
+}
+
 void AST::generateCppAdapterSource(Formatter& out) const {
     const std::string klassName = AST::isInterface() ? getInterface()->getAdapterName() : "Atypes";
 
     generateCppPackageInclude(out, mPackage, klassName);
 
     if (AST::isInterface()) {
+        if (passesInterfaces(getInterface())) {
+            out << "#include <hidl/HidlBinderSupport.h>\n";
+        }
         out << "#include <hidladapter/HidlBinderAdapter.h>\n";
         generateCppPackageInclude(out, mPackage, getInterface()->localName());
 
@@ -106,6 +216,10 @@ void AST::generateCppAdapterSource(Formatter& out) const {
         out << klassName << "::" << klassName << "(const ::android::sp<" << mockName
             << ">& impl) : mImpl(impl) {}";
 
+        if (passesInterfaces(getInterface())) {
+            generateAdapterCache(out, klassName);
+        }
+
         generateMethods(out, [&](const Method* method, const Interface* /* interface */) {
             generateAdapterMethod(out, method);
         });
@@ -129,12 +243,13 @@ void AST::generateAdapterMethod(Formatter& out, const Method* method) const {
         }
 
         const Interface* interface = static_cast<const Interface*>(type);
-        out << "static_cast<::android::sp<" << interface->fqName().cppName() << ">>("
+        out << "_hidl_adapt<" << interface->fqName().cppName() << ">(" << var << ", [&] { "
+            << "return static_cast<::android::sp<" << interface->fqName().cppName() << ">>("
             << interface->fqName().cppName() << "::castFrom("
             << "::android::hardware::details::adaptWithDefault("
             << "static_cast<::android::sp<" << interface->fqName().cppName() << ">>(" << var
             << "), [&] { return new " << interface->fqName().getInterfaceAdapterFqName().cppName()
-            << "(" << var << "); })))";
+            << "(" << var << "); }))); })";
     };
 
     const std::string klassName = getInterface()->getAdapterName();
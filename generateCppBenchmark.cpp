@@ -0,0 +1,433 @@
+/*
+ * Copyright (C) 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "AST.h"
+
+#include "CompoundType.h"
+#include "Coordinator.h"
+#include "Interface.h"
+#include "Method.h"
+#include "Reference.h"
+
+#include <android-base/logging.h>
+#include <hidl-util/Formatter.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace android {
+
+// Adds the structs and safe unions in type whose vectors and strings need to
+// be filled, i.e. which need their own _hidl_fill.
+static void addFilledTypes(const Type* type, std::vector<const CompoundType*>* types,
+                           bool* fillsStrings) {
+    if (!type->needsEmbeddedReadWrite()) {
+        return;
+    }
+
+    if (type->isString()) {
+        *fillsStrings = true;
+    } else if (type->isCompoundType()) {
+        const auto* compoundType = static_cast<const CompoundType*>(type);
+        if (std::find(types->begin(), types->end(), compoundType) != types->end()) {
+            return;
+        }
+        types->push_back(compoundType);
+    } else if (type->isNamedType()) {
+        return;
+    }
+
+    for (const auto* ref : type->getReferences()) {
+        addFilledTypes(ref->get(), types, fillsStrings);
+    }
+}
+
+// Whether the sizes of the vectors and strings matter for method.
+static bool usesSizes(const Method* method) {
+    for (const auto* args : {&method->args(), &method->results()}) {
+        if (std::any_of(args->begin(), args->end(), [](const auto* arg) {
+                return arg->type().needsEmbeddedReadWrite();
+            })) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// The names of args with the given prefix, separated by commas.
+static std::string joinNames(const std::vector<NamedReference<Type>*>& args,
+                             const std::string& prefix) {
+    std::string names;
+    for (const auto* arg : args) {
+        if (!names.empty()) {
+            names += ", ";
+        }
+        names += prefix + arg->name();
+    }
+    return names;
+}
+
+static void generateFillFunctions(Formatter& out, const Interface* iface) {
+    std::vector<const CompoundType*> types;
+    bool fillsStrings = false;
+    for (const Method* method : iface->userDefinedMethods()) {
+        for (const auto* args : {&method->args(), &method->results()}) {
+            for (const auto* arg : *args) {
+                addFilledTypes(arg->get(), &types, &fillsStrings);
+            }
+        }
+    }
+
+    // All declared first, since the templates find the overloads for the
+    // package types by ordinary lookup, not by ADL.
+    out << "template <typename T>\n";
+    out << "static void _hidl_fill(T* o, size_t vectorSize, size_t stringSize);\n";
+    if (fillsStrings) {
+        out << "static void _hidl_fill(::android::hardware::hidl_string* o, size_t vectorSize, "
+               "size_t stringSize);\n";
+    }
+    out << "template <typename T>\n";
+    out << "static void _hidl_fill(::android::hardware::hidl_vec<T>* o, size_t vectorSize, "
+           "size_t stringSize);\n";
+    out << "template <typename T, size_t SIZE1, size_t... SIZES>\n";
+    out << "static void _hidl_fill(::android::hardware::hidl_array<T, SIZE1, SIZES...>* o, "
+           "size_t vectorSize, size_t stringSize);\n";
+    for (const CompoundType* type : types) {
+        out << "static void _hidl_fill(" << type->fullName()
+            << "* o, size_t vectorSize, size_t stringSize);\n";
+    }
+    out << "\n";
+
+    out << "// Scalars, enums, interfaces and handles keep their default values.\n";
+    out << "template <typename T>\n";
+    out << "static void _hidl_fill(T* /* o */, size_t /* vectorSize */, "
+           "size_t /* stringSize */) {}\n\n";
+
+    if (fillsStrings) {
+        out << "static void _hidl_fill(::android::hardware::hidl_string* o, "
+               "size_t /* vectorSize */, size_t stringSize) ";
+        out.block([&] { out << "*o = std::string(stringSize, 'x');\n"; }).endl().endl();
+    }
+
+    out << "template <typename T>\n";
+    out << "static void _hidl_fill(::android::hardware::hidl_vec<T>* o, size_t vectorSize, "
+           "size_t stringSize) ";
+    out.block([&] {
+        out << "o->resize(vectorSize);\n";
+        out.sFor("size_t i = 0; i < vectorSize; ++i", [&] {
+            out << "_hidl_fill(&(*o)[i], vectorSize, stringSize);\n";
+        }).endl();
+    }).endl().endl();
+
+    out << "template <typename T, size_t SIZE1, size_t... SIZES>\n";
+    out << "static void _hidl_fill(::android::hardware::hidl_array<T, SIZE1, SIZES...>* o, "
+           "size_t vectorSize, size_t stringSize) ";
+    out.block([&] {
+        out.sFor("size_t i = 0; i < sizeof(*o) / sizeof(T); ++i", [&] {
+            out << "_hidl_fill(&o->data()[i], vectorSize, stringSize);\n";
+        }).endl();
+    }).endl().endl();
+
+    for (const CompoundType* type : types) {
+        type->emitBenchmarkFill(out);
+    }
+}
+
+void AST::generateCppBenchmarkSource(Formatter& out) const {
+    const Interface* iface = getInterface();
+    CHECK(iface != nullptr);
+
+    out << "// This file is autogenerated by hidl-gen -Lbenchmark.\n";
+    out << "// Measures marshalling the arguments and results of the methods of\n";
+    out << "// " << iface->fqName().string()
+        << " the way its proxy and stub do, without transacting.\n\n";
+
+    generateCppPackageInclude(out, mPackage, iface->getHwName());
+    out << "\n";
+
+    out << "#include <benchmark/benchmark.h>\n";
+    out << "#include <hidl/HidlBinderSupport.h>\n";
+    out << "#include <hwbinder/Parcel.h>\n\n";
+
+    const std::vector<Method*>& methods = iface->userDefinedMethods();
+    if (std::any_of(methods.begin(), methods.end(),
+                    [](const Method* method) { return method->numPackedArgs() > 0; })) {
+        out << "#include <cstring>\n";
+    }
+    out << "#include <string>\n";
+    out << "#include <utility>\n\n";
+
+    const bool anyUsesSizes = std::any_of(methods.begin(), methods.end(), usesSizes);
+
+    if (anyUsesSizes) {
+        out << "// The sizes of the vectors and of the strings in the values of the\n";
+        out << "// arguments and results. Every benchmark runs with each combination.\n";
+        out << "#ifndef HIDL_BENCHMARK_VECTOR_SIZES\n";
+        out << "#define HIDL_BENCHMARK_VECTOR_SIZES 1, 16, 256\n";
+        out << "#endif\n";
+        out << "#ifndef HIDL_BENCHMARK_STRING_SIZES\n";
+        out << "#define HIDL_BENCHMARK_STRING_SIZES 16, 256\n";
+        out << "#endif\n\n";
+    }
+
+    enterLeaveNamespace(out, true /* enter */);
+    out << "\n";
+
+    if (anyUsesSizes) {
+        out << "static void _hidl_sizes(::benchmark::internal::Benchmark* b) ";
+        out.block([&] {
+            out.sFor("int64_t vectorSize : {HIDL_BENCHMARK_VECTOR_SIZES}", [&] {
+                out.sFor("int64_t stringSize : {HIDL_BENCHMARK_STRING_SIZES}", [&] {
+                    out << "b->Args({vectorSize, stringSize});\n";
+                }).endl();
+            }).endl();
+        }).endl().endl();
+
+        generateFillFunctions(out, iface);
+    }
+
+    if (mCoordinator->optimizeSize()) {
+        generateParcelHelpers(out, iface);
+    }
+
+    for (const Method* method : methods) {
+        generateBenchmarkMethod(out, method);
+    }
+
+    enterLeaveNamespace(out, false /* enter */);
+    out << "\n";
+
+    out << "BENCHMARK_MAIN();\n";
+}
+
+void AST::generateBenchmarkMethod(Formatter& out, const Method* method) const {
+    const Interface* iface = getInterface();
+    const std::string& name = method->name();
+    const size_t numPackedArgs = method->numPackedArgs();
+
+    // What the proxy writes, from generateStaticProxyMethodSource.
+    out << "static ::android::status_t _hidl_writeArgs_" << name
+        << "(::android::hardware::Parcel& _hidl_data";
+    // only the arguments, emitCppArgSignature would add the callback
+    for (const auto* arg : method->args()) {
+        out << ", " << arg->type().getCppArgumentType() << " " << arg->name();
+    }
+    out << ") ";
+    out.block([&] {
+        if (numPackedArgs > 0) {
+            declarePackedArgsStruct(out, method);
+            out << "_hidl_packed_args_t _hidl_packed_args;\n";
+            out << "size_t _hidl_packed_args_parent;\n\n";
+        }
+
+        out << "::android::status_t _hidl_err = _hidl_data.writeInterfaceToken("
+            << iface->fullName() << "::descriptor);\n";
+        out << "if (_hidl_err != ::android::OK) { return _hidl_err; }\n\n";
+
+        if (numPackedArgs > 0) {
+            out << "::std::memset(&_hidl_packed_args, 0, sizeof(_hidl_packed_args));\n";
+            for (size_t i = 0; i < numPackedArgs; i++) {
+                const std::string& argName = method->args()[i]->name();
+                out << "_hidl_packed_args." << argName << " = " << argName << ";\n";
+            }
+            out << "_hidl_err = _hidl_data.writeBuffer(&_hidl_packed_args, "
+                   "sizeof(_hidl_packed_args), &_hidl_packed_args_parent);\n";
+            out << "if (_hidl_err != ::android::OK) { return _hidl_err; }\n\n";
+        }
+
+        for (size_t i = numPackedArgs; i < method->args().size(); i++) {
+            emitCppReaderWriter(out, "_hidl_data", false /* parcelObjIsPointer */,
+                                method->args()[i], false /* reader */, Type::ErrorMode_Return,
+                                false /* addPrefixToName */);
+        }
+        for (const auto* arg : method->args()) {
+            emitCppResolveReferences(out, "_hidl_data", false /* parcelObjIsPointer */, arg,
+                                     false /* reader */, Type::ErrorMode_Return,
+                                     false /* addPrefixToName */);
+        }
+
+        out << "return _hidl_err;\n";
+    }).endl().endl();
+
+    // What the stub reads, from generateStaticStubMethodSource.
+    out << "static ::android::status_t _hidl_readArgs_" << name
+        << "(const ::android::hardware::Parcel& _hidl_data) ";
+    out.block([&] {
+        out << "if (!_hidl_data.enforceInterface(" << iface->fullName() << "::descriptor)) ";
+        out.block([&] { out << "return ::android::BAD_TYPE;\n"; }).endl().endl();
+
+        out << "::android::status_t _hidl_err = ::android::OK;\n";
+        declareCppReaderLocals(out, method->args(), false /* forResults */);
+
+        if (numPackedArgs > 0) {
+            declarePackedArgsStruct(out, method);
+            out << "const _hidl_packed_args_t* _hidl_packed_args;\n";
+            out << "size_t _hidl_packed_args_parent;\n\n";
+            out << "_hidl_err = _hidl_data.readBuffer(sizeof(*_hidl_packed_args), "
+                   "&_hidl_packed_args_parent, "
+                   "reinterpret_cast<const void**>(&_hidl_packed_args));\n";
+            out << "if (_hidl_err != ::android::OK) { return _hidl_err; }\n\n";
+            for (size_t i = 0; i < numPackedArgs; i++) {
+                const std::string& argName = method->args()[i]->name();
+                out << argName << " = _hidl_packed_args->" << argName << ";\n";
+            }
+            out << "\n";
+        }
+
+        for (size_t i = numPackedArgs; i < method->args().size(); i++) {
+            emitCppReaderWriter(out, "_hidl_data", false /* parcelObjIsPointer */,
+                                method->args()[i], true /* reader */, Type::ErrorMode_Return,
+                                false /* addPrefixToName */);
+        }
+        for (const auto* arg : method->args()) {
+            emitCppResolveReferences(out, "_hidl_data", false /* parcelObjIsPointer */, arg,
+                                     true /* reader */, Type::ErrorMode_Return,
+                                     false /* addPrefixToName */);
+        }
+
+        for (const auto* arg : method->args()) {
+            out << "::benchmark::DoNotOptimize(" << arg->name() << ");\n";
+        }
+        out << "return _hidl_err;\n";
+    }).endl().endl();
+
+    if (!method->isOneway()) {
+        // What the stub writes and the proxy reads back.
+        out << "static ::android::status_t _hidl_writeResults_" << name
+            << "(::android::hardware::Parcel* _hidl_reply";
+        if (!method->results().empty()) {
+            out << ", ";
+            method->emitCppResultSignature(out);
+        }
+        out << ") ";
+        out.block([&] {
+            out << "::android::status_t _hidl_err = ::android::hardware::writeToParcel("
+                   "::android::hardware::Status::ok(), _hidl_reply);\n";
+            out << "if (_hidl_err != ::android::OK) { return _hidl_err; }\n\n";
+
+            for (const auto* arg : method->results()) {
+                emitCppReaderWriter(out, "_hidl_reply", true /* parcelObjIsPointer */, arg,
+                                    false /* reader */, Type::ErrorMode_Return,
+                                    false /* addPrefixToName */);
+            }
+            for (const auto* arg : method->results()) {
+                emitCppResolveReferences(out, "_hidl_reply", true /* parcelObjIsPointer */, arg,
+                                         false /* reader */, Type::ErrorMode_Return,
+                                         false /* addPrefixToName */);
+            }
+
+            out << "return _hidl_err;\n";
+        }).endl().endl();
+
+        out << "static ::android::status_t _hidl_readResults_" << name
+            << "(const ::android::hardware::Parcel& _hidl_reply) ";
+        out.block([&] {
+            out << "::android::hardware::Status _hidl_status;\n";
+            out << "::android::status_t _hidl_err = "
+                   "::android::hardware::readFromParcel(&_hidl_status, _hidl_reply);\n";
+            out << "if (_hidl_err != ::android::OK) { return _hidl_err; }\n\n";
+
+            declareCppReaderLocals(out, method->results(), true /* forResults */);
+
+            for (const auto* arg : method->results()) {
+                emitCppReaderWriter(out, "_hidl_reply", false /* parcelObjIsPointer */, arg,
+                                    true /* reader */, Type::ErrorMode_Return,
+                                    true /* addPrefixToName */);
+            }
+            for (const auto* arg : method->results()) {
+                emitCppResolveReferences(out, "_hidl_reply", false /* parcelObjIsPointer */, arg,
+                                         true /* reader */, Type::ErrorMode_Return,
+                                         true /* addPrefixToName */);
+            }
+
+            for (const auto* arg : method->results()) {
+                out << "::benchmark::DoNotOptimize(_hidl_out_" << arg->name() << ");\n";
+            }
+            out << "return _hidl_err;\n";
+        }).endl().endl();
+    }
+
+    const bool sized = usesSizes(method);
+
+    // Reports the time and the bytes a call takes to marshal, where bytes/op
+    // is what the kernel copies, i.e. the Parcel data and its buffers.
+    out << "static void BM_" << name << "(::benchmark::State& _hidl_state) ";
+    out.block([&] {
+        if (sized) {
+            out << "const size_t _hidl_vectorSize = _hidl_state.range(0);\n";
+            out << "const size_t _hidl_stringSize = _hidl_state.range(1);\n\n";
+        }
+
+        for (const auto* arg : method->args()) {
+            out << arg->type().getCppStackType() << " " << arg->name() << "{};\n";
+            if (arg->type().needsEmbeddedReadWrite()) {
+                out << "_hidl_fill(&" << arg->name() << ", _hidl_vectorSize, _hidl_stringSize);\n";
+            }
+        }
+        if (!method->isOneway()) {
+            for (const auto* arg : method->results()) {
+                out << arg->type().getCppStackType() << " _hidl_out_" << arg->name() << "{};\n";
+                if (arg->type().needsEmbeddedReadWrite()) {
+                    out << "_hidl_fill(&_hidl_out_" << arg->name()
+                        << ", _hidl_vectorSize, _hidl_stringSize);\n";
+                }
+            }
+        }
+        out << "size_t _hidl_bytes = 0;\n\n";
+
+        out.sWhile("_hidl_state.KeepRunning()", [&] {
+            out << "::android::hardware::Parcel _hidl_data;\n";
+            out.sIf("_hidl_writeArgs_" + name + "(_hidl_data" +
+                            (method->args().empty() ? "" : ", ") +
+                            joinNames(method->args(), "") + ") != ::android::OK",
+                    [&] {
+                        out << "_hidl_state.SkipWithError(\"writing the arguments failed\");\n";
+                        out << "break;\n";
+                    }).endl();
+            out << "_hidl_data.setDataPosition(0);\n";
+            out.sIf("_hidl_readArgs_" + name + "(_hidl_data) != ::android::OK", [&] {
+                out << "_hidl_state.SkipWithError(\"reading the arguments failed\");\n";
+                out << "break;\n";
+            }).endl();
+            out << "_hidl_bytes = _hidl_data.ipcDataSize() + _hidl_data.ipcBufferSize();\n";
+
+            if (!method->isOneway()) {
+                out << "\n::android::hardware::Parcel _hidl_reply;\n";
+                out.sIf("_hidl_writeResults_" + name + "(&_hidl_reply" +
+                                (method->results().empty() ? "" : ", ") +
+                                joinNames(method->results(), "_hidl_out_") +
+                                ") != ::android::OK",
+                        [&] {
+                            out << "_hidl_state.SkipWithError(\"writing the results failed\");\n";
+                            out << "break;\n";
+                        }).endl();
+                out << "_hidl_reply.setDataPosition(0);\n";
+                out.sIf("_hidl_readResults_" + name + "(_hidl_reply) != ::android::OK", [&] {
+                    out << "_hidl_state.SkipWithError(\"reading the results failed\");\n";
+                    out << "break;\n";
+                }).endl();
+                out << "_hidl_bytes += _hidl_reply.ipcDataSize() + "
+                       "_hidl_reply.ipcBufferSize();\n";
+            }
+        }).endl().endl();
+
+        out << "_hidl_state.counters[\"bytes/op\"] = _hidl_bytes;\n";
+    }).endl();
+
+    out << "BENCHMARK(BM_" << name << ")" << (sized ? "->Apply(_hidl_sizes)" : "") << ";\n\n";
+}
+
+}  // namespace android
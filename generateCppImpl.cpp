@@ -82,6 +82,12 @@ void AST::generateCppImplHeader(Formatter& out) const {
 
     generateCppPackageInclude(out, mPackage, iface->localName());
 
+    std::set<FQName> forwardDeclaredNames;
+    getForwardDeclaredNames(&forwardDeclaredNames);
+    for (const auto& item : forwardDeclaredNames) {
+        generateCppPackageInclude(out, item, item.name());
+    }
+
     out << "#include <hidl/MQDescriptor.h>\n";
     out << "#include <hidl/Status.h>\n\n";
 
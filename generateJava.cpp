@@ -43,6 +43,37 @@ void AST::emitJavaReaderWriter(Formatter& out, const std::string& parcelObj,
             isReader);
 }
 
+// Same layout as the struct the C++ backend declares for them.
+void AST::emitJavaPackedArgs(Formatter& out, const Method* method, bool isReader) const {
+    std::vector<size_t> offsets;
+    const size_t size = method->getPackedArgsLayout(&offsets);
+
+    if (isReader) {
+        out << "android.os.HwBlob _hidl_packed_args = _hidl_request.readBuffer(" << size
+            << " /* size */);\n";
+    } else {
+        out << "android.os.HwBlob _hidl_packed_args = new android.os.HwBlob(" << size
+            << " /* size */);\n";
+    }
+
+    for (size_t i = 0; i < offsets.size(); i++) {
+        const NamedReference<Type>* arg = method->args()[i];
+        if (isReader) {
+            out << arg->type().getJavaType() << " ";
+        }
+        arg->type().emitJavaFieldReaderWriter(out, 0 /* depth */, "_hidl_request",
+                                              "_hidl_packed_args", arg->name(),
+                                              std::to_string(offsets[i]), isReader);
+    }
+
+    if (!isReader) {
+        out << "_hidl_request.writeBuffer(_hidl_packed_args);\n";
+    }
+    if (offsets.size() < method->args().size()) {
+        out << "\n";
+    }
+}
+
 void AST::generateJavaTypes(Formatter& out, const std::string& limitToType) const {
     // Splits types.hal up into one java file per declared type.
     CHECK(!limitToType.empty()) << getFilename();
@@ -294,6 +325,16 @@ void AST::generateJava(Formatter& out, const std::string& limitToType) const {
     out.indent();
 
     out << "private android.os.IHwBinder mRemote;\n\n";
+
+    const bool reuseParcels = mCoordinator->reuseJavaParcels();
+    if (reuseParcels) {
+        out << "// Each thread reuses a reply parcel across calls; the next transaction\n"
+            << "// replaces the data it holds. A call takes it out while in use, so that\n"
+            << "// nested calls on the same thread allocate their own. Between calls, the\n"
+            << "// parcel keeps the binder buffer of the last reply.\n"
+            << "private static final ThreadLocal<android.os.HwParcel> sReplyParcel =\n"
+            << "        new ThreadLocal<android.os.HwParcel>();\n\n";
+    }
     out << "public Proxy(android.os.IHwBinder remote) {\n";
     out.indent();
     out << "mRemote = java.util.Objects.requireNonNull(remote);\n";
@@ -382,7 +423,13 @@ void AST::generateJava(Formatter& out, const std::string& limitToType) const {
             << superInterface->fullJavaName()
             << ".kInterfaceName);\n";
 
-        for (const auto &arg : method->args()) {
+        const size_t numPackedArgs = method->numPackedArgs();
+        if (numPackedArgs > 0) {
+            emitJavaPackedArgs(out, method, false /* isReader */);
+        }
+
+        for (size_t i = numPackedArgs; i < method->args().size(); i++) {
+            const NamedReference<Type>* arg = method->args()[i];
             emitJavaReaderWriter(
                     out,
                     "_hidl_request",
@@ -391,7 +438,16 @@ void AST::generateJava(Formatter& out, const std::string& limitToType) const {
                     false /* addPrefixToName */);
         }
 
-        out << "\nandroid.os.HwParcel _hidl_reply = new android.os.HwParcel();\n";
+        if (reuseParcels) {
+            out << "\nandroid.os.HwParcel _hidl_reply = sReplyParcel.get();\n";
+            out.sIf("_hidl_reply == null", [&] {
+                out << "_hidl_reply = new android.os.HwParcel();\n";
+            }).sElse([&] {
+                out << "sReplyParcel.set(null);\n";
+            }).endl();
+        } else {
+            out << "\nandroid.os.HwParcel _hidl_reply = new android.os.HwParcel();\n";
+        }
 
         out.sTry([&] {
             out << "mRemote.transact("
@@ -448,7 +504,11 @@ void AST::generateJava(Formatter& out, const std::string& limitToType) const {
                 }
             }
         }).sFinally([&] {
-            out << "_hidl_reply.release();\n";
+            if (reuseParcels) {
+                out << "sReplyParcel.set(_hidl_reply);\n";
+            } else {
+                out << "_hidl_reply.release();\n";
+            }
         }).endl();
 
         out.unindent();
@@ -570,7 +630,13 @@ void AST::generateJava(Formatter& out, const std::string& limitToType) const {
             << superInterface->fullJavaName()
             << ".kInterfaceName);\n\n";
 
-        for (const auto &arg : method->args()) {
+        const size_t numPackedArgs = method->numPackedArgs();
+        if (numPackedArgs > 0) {
+            emitJavaPackedArgs(out, method, true /* isReader */);
+        }
+
+        for (size_t i = numPackedArgs; i < method->args().size(); i++) {
+            const NamedReference<Type>* arg = method->args()[i];
             emitJavaReaderWriter(
                     out,
                     "_hidl_request",
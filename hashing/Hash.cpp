@@ -30,24 +30,22 @@ namespace android {
 
 const std::vector<uint8_t> Hash::kEmptyHash = std::vector<uint8_t>(SHA256_DIGEST_LENGTH, 0);
 
-Hash& Hash::getMutableHash(const std::string& path) {
-    static std::map<std::string, Hash> hashes;
-
-    auto it = hashes.find(path);
-
-    if (hashes.find(path) == hashes.end()) {
-        it = hashes.insert(it, {path, Hash(path)});
-    }
-
-    return it->second;
+static HashCache& defaultCache() {
+    static HashCache cache;
+    return cache;
 }
 
 const Hash& Hash::getHash(const std::string& path) {
-    return getMutableHash(path);
+    return defaultCache().getHash(path);
 }
 
 void Hash::clearHash(const std::string& path) {
-    getMutableHash(path).mHash = kEmptyHash;
+    defaultCache().clearHash(path);
+}
+
+std::vector<std::string> Hash::lookupHash(const std::string& path, const std::string& interfaceName,
+                                          std::string* err, bool* fileExists) {
+    return defaultCache().lookupHash(path, interfaceName, err, fileExists);
 }
 
 static std::vector<uint8_t> sha256File(const std::string& path) {
@@ -95,17 +93,6 @@ static const std::regex kHashLine("(?:" MAYBE_SPACES HASH SPACES FQNAME MAYBE_SP
                                   ")?" OPTIONAL_COMMENT);
 
 struct HashFile {
-    static const HashFile* parse(const std::string& path, std::string* err) {
-        static std::map<std::string, HashFile*> hashfiles;
-        auto it = hashfiles.find(path);
-
-        if (it == hashfiles.end()) {
-            it = hashfiles.insert(it, {path, readHashFile(path, err)});
-        }
-
-        return it->second;
-    }
-
     std::vector<std::string> lookup(const std::string& fqName) const {
         auto it = hashes.find(fqName);
 
@@ -116,7 +103,6 @@ struct HashFile {
         return it->second;
     }
 
-   private:
     static HashFile* readHashFile(const std::string& path, std::string* err) {
         std::ifstream stream(path);
         if (!stream) {
@@ -157,14 +143,53 @@ struct HashFile {
         return file;
     }
 
+   private:
     std::string path;
     std::map<std::string, std::vector<std::string>> hashes;
 };
 
-std::vector<std::string> Hash::lookupHash(const std::string& path, const std::string& interfaceName,
-                                          std::string* err, bool* fileExists) {
+HashCache::HashCache() {}
+
+HashCache::~HashCache() {}
+
+Hash& HashCache::getMutableHash(const std::string& path) {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto it = mHashes.find(path);
+        if (it != mHashes.end()) return it->second;
+    }
+
+    // Hash the file without holding the lock. If another thread got there
+    // first, its result is kept.
+    Hash hash(path);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mHashes.emplace(path, std::move(hash)).first->second;
+}
+
+const Hash& HashCache::getHash(const std::string& path) {
+    return getMutableHash(path);
+}
+
+void HashCache::clearHash(const std::string& path) {
+    Hash& hash = getMutableHash(path);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    hash.mHash = Hash::kEmptyHash;
+}
+
+std::vector<std::string> HashCache::lookupHash(const std::string& path,
+                                               const std::string& interfaceName, std::string* err,
+                                               bool* fileExists) {
     *err = "";
-    const HashFile* file = HashFile::parse(path, err);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto it = mHashFiles.find(path);
+    if (it == mHashFiles.end()) {
+        it = mHashFiles.emplace(path, std::unique_ptr<HashFile>(HashFile::readHashFile(path, err)))
+                 .first;
+    }
+    const HashFile* file = it->second.get();
 
     if (file == nullptr || err->size() > 0) {
         if (fileExists != nullptr) *fileExists = false;
@@ -16,21 +16,22 @@
 
 #pragma once
 
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
 namespace android {
 
+struct HashFile;
+
 struct Hash {
     static const std::vector<uint8_t> kEmptyHash;
 
-    // path to .hal file
+    // Same as the HashCache methods below, using a process-wide HashCache.
     static const Hash& getHash(const std::string& path);
     static void clearHash(const std::string& path);
-
-    // returns matching hashes of interfaceName in path
-    // path is something like hardware/interfaces/current.txt
-    // interfaceName is something like android.hardware.foo@1.0::IFoo
     static std::vector<std::string> lookupHash(const std::string& path,
                                                const std::string& interfaceName, std::string* err,
                                                bool* fileExists = nullptr);
@@ -42,12 +43,41 @@ struct Hash {
     const std::string& getPath() const;
 
    private:
-    Hash(const std::string& path);
+    friend struct HashCache;
 
-    static Hash& getMutableHash(const std::string& path);
+    Hash(const std::string& path);
 
     const std::string mPath;
     std::vector<uint8_t> mHash;
 };
 
+// Caches the hashes of .hal files and the contents of hash files. Each
+// Coordinator owns one, so that independent instances don't share state.
+// All methods may be called concurrently.
+struct HashCache {
+    HashCache();
+    ~HashCache();
+
+    // path to .hal file
+    // The returned reference stays valid for the lifetime of the cache.
+    const Hash& getHash(const std::string& path);
+    void clearHash(const std::string& path);
+
+    // returns matching hashes of interfaceName in path
+    // path is something like hardware/interfaces/current.txt
+    // interfaceName is something like android.hardware.foo@1.0::IFoo
+    std::vector<std::string> lookupHash(const std::string& path, const std::string& interfaceName,
+                                        std::string* err, bool* fileExists = nullptr);
+
+   private:
+    Hash& getMutableHash(const std::string& path);
+
+    std::mutex mMutex;
+    std::map<std::string, Hash> mHashes;
+    std::map<std::string, std::unique_ptr<HashFile>> mHashFiles;
+
+    HashCache(const HashCache&) = delete;
+    void operator=(const HashCache&) = delete;
+};
+
 }  // namespace android
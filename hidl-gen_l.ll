@@ -55,8 +55,6 @@ FQNAME              ({COMPONENT}|{VERSION})(({DOT}|":"+){COMPONENT}|{VERSION})*
 using namespace android;
 using token = yy::parser::token;
 
-static std::string gCurrentComment;
-
 #define SCALAR_TYPE(kind)                                        \
     {                                                            \
         yylval->type = new ScalarType(ScalarType::kind, *scope); \
@@ -77,21 +75,22 @@ static std::string gCurrentComment;
 %option reentrant
 %option bison-bridge
 %option bison-locations
+%option extra-type="std::string*"
 
 %x COMMENT_STATE
 %x DOC_COMMENT_STATE
 
 %%
 
-"/**"                       { gCurrentComment.clear(); BEGIN(DOC_COMMENT_STATE); }
+"/**"                       { yyextra->clear(); BEGIN(DOC_COMMENT_STATE); }
 <DOC_COMMENT_STATE>"*/"     {
                                 BEGIN(INITIAL);
-                                yylval->docComment = new DocComment(gCurrentComment);
+                                yylval->docComment = new DocComment(*yyextra);
                                 return token::DOC_COMMENT;
                             }
-<DOC_COMMENT_STATE>[^*\n]*                          { gCurrentComment += yytext; }
-<DOC_COMMENT_STATE>[\n]                             { gCurrentComment += yytext; yylloc->lines(); }
-<DOC_COMMENT_STATE>[*]                              { gCurrentComment += yytext; }
+<DOC_COMMENT_STATE>[^*\n]*                          { *yyextra += yytext; }
+<DOC_COMMENT_STATE>[\n]                             { *yyextra += yytext; yylloc->lines(); }
+<DOC_COMMENT_STATE>[*]                              { *yyextra += yytext; }
 
 "/*"                        { BEGIN(COMMENT_STATE); }
 <COMMENT_STATE>"*/"         { BEGIN(INITIAL); }
@@ -193,8 +192,12 @@ L?\"(\\.|[^\\"])*\" { yylval->str = strdup(yytext); return token::STRING_LITERAL
 namespace android {
 
 status_t parseFile(AST* ast, std::unique_ptr<FILE, std::function<void(FILE *)>> file) {
+    // Text of the doc comment being scanned (yyextra). Kept per scanner
+    // so that files can be parsed concurrently.
+    std::string currentComment;
+
     yyscan_t scanner;
-    yylex_init(&scanner);
+    yylex_init_extra(&currentComment, &scanner);
 
     yyset_in(file.get(), scanner);
 
@@ -716,7 +716,11 @@ interface_declaration
           CHECK((*scope)->isInterface());
 
           Interface *iface = static_cast<Interface *>(*scope);
-          CHECK(iface->addAllReservedMethods());
+
+          // IBase was imported when entering the interface.
+          const Type* ibase = iface->isIBase() ? iface : ast->lookupType(gIBaseFqName, *scope);
+          CHECK(ibase != nullptr && ibase->isInterface());
+          CHECK(iface->addAllReservedMethods(*static_cast<const Interface*>(ibase)));
 
           leaveScope(ast, scope);
           ast->addScopedType(iface, *scope);
@@ -0,0 +1,536 @@
+/*
+ * Copyright (C) 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "LanguageServer.h"
+
+#include <android-base/logging.h>
+#include <android-base/parseint.h>
+#include <hidl-util/StringHelper.h>
+#include <limits.h>
+#include <unistd.h>
+
+#include <iostream>
+#include <regex>
+#include <set>
+#include <sstream>
+#include <vector>
+
+#include "AST.h"
+#include "Coordinator.h"
+#include "Location.h"
+#include "NamedType.h"
+#include "Scope.h"
+
+namespace android {
+
+// JSON-RPC error codes
+static const int kMethodNotFound = -32601;
+static const int kInvalidRequest = -32600;
+
+// Collects everything libhidl-gen reports through std::cerr while in scope.
+struct ErrorCapture {
+    ErrorCapture() : mOld(std::cerr.rdbuf(mStream.rdbuf())) {}
+    ~ErrorCapture() { std::cerr.rdbuf(mOld); }
+
+    std::string str() const { return mStream.str(); }
+
+   private:
+    std::ostringstream mStream;
+    std::streambuf* const mOld;
+
+    DISALLOW_COPY_AND_ASSIGN(ErrorCapture);
+};
+
+// Returns false, after reporting it, if the URI has a malformed %-escape.
+static bool uriToPath(const std::string& uri, std::string* path) {
+    const std::string encoded = StringHelper::LTrim(uri, "file://");
+    path->clear();
+    for (size_t i = 0; i < encoded.size(); i++) {
+        if (encoded[i] != '%') {
+            *path += encoded[i];
+            continue;
+        }
+
+        unsigned int c;
+        if (i + 2 >= encoded.size() || !base::ParseUint("0x" + encoded.substr(i + 1, 2), &c)) {
+            std::cerr << "ERROR: Malformed URI: " << uri << std::endl;
+            return false;
+        }
+        *path += static_cast<char>(c);
+        i += 2;
+    }
+    return true;
+}
+
+static std::string pathToUri(const std::string& path) {
+    std::string ret = "file://";
+    for (char c : path) {
+        if (c == '%' || c == ' ') {
+            static const char kHex[] = "0123456789ABCDEF";
+            ret += '%';
+            ret += kHex[(c >> 4) & 0xf];
+            ret += kHex[c & 0xf];
+        } else {
+            ret += c;
+        }
+    }
+    return ret;
+}
+
+static Json::Value makePosition(size_t line, size_t character) {
+    Json::Value ret;
+    ret["line"] = static_cast<Json::UInt>(line);
+    ret["character"] = static_cast<Json::UInt>(character);
+    return ret;
+}
+
+// hidl-gen positions are 1-based, LSP positions are 0-based.
+static Json::Value makeRange(size_t line, size_t column, size_t endLine, size_t endColumn) {
+    Json::Value ret;
+    ret["start"] = makePosition(line > 0 ? line - 1 : 0, column > 0 ? column - 1 : 0);
+    ret["end"] = makePosition(endLine > 0 ? endLine - 1 : 0, endColumn > 0 ? endColumn - 1 : 0);
+    return ret;
+}
+
+static Json::Value makeRange(const Location& location) {
+    return makeRange(location.begin().line(), location.begin().column(), location.end().line(),
+                     location.end().column());
+}
+
+// Splits hidl-gen error output into LSP diagnostics for the file at path.
+// Messages pointing into other files are reported at the top of this one.
+static Json::Value makeDiagnostics(const std::string& path, const std::string& output) {
+    static const std::regex kLocation("(\\S+\\.hal):(\\d+)\\.(\\d+)(?:-(?:(\\d+)\\.)?(\\d+))?");
+
+    struct Message {
+        int severity;
+        std::string text;
+    };
+    std::vector<Message> messages;
+
+    std::istringstream stream(output);
+    std::string line;
+    while (std::getline(stream, line)) {
+        if (StringHelper::StartsWith(line, "ERROR: ")) {
+            messages.push_back({1 /* Error */, StringHelper::LTrim(line, "ERROR: ")});
+        } else if (StringHelper::StartsWith(line, "WARNING: ")) {
+            messages.push_back({2 /* Warning */, StringHelper::LTrim(line, "WARNING: ")});
+        } else if (!messages.empty() && !line.empty()) {
+            messages.back().text += "\n" + line;
+        }
+    }
+
+    Json::Value ret(Json::arrayValue);
+    for (const Message& message : messages) {
+        Json::Value diagnostic;
+        diagnostic["severity"] = message.severity;
+        diagnostic["source"] = "hidl-gen";
+        diagnostic["message"] = message.text;
+        diagnostic["range"] = makeRange(1, 1, 1, 1);
+
+        std::smatch match;
+        if (std::regex_search(message.text, match, kLocation) && match.str(1) == path) {
+            size_t beginLine = std::stoul(match.str(2));
+            size_t beginColumn = std::stoul(match.str(3));
+            size_t endLine = match[4].matched ? std::stoul(match.str(4)) : beginLine;
+            // hidl-gen prints the last column, LSP ranges exclude their end.
+            size_t endColumn = (match[5].matched ? std::stoul(match.str(5)) : beginColumn) + 1;
+            diagnostic["range"] = makeRange(beginLine, beginColumn, endLine, endColumn);
+        }
+
+        ret.append(diagnostic);
+    }
+    return ret;
+}
+
+// Offset of the 1-based line and column in text, or text.size().
+static size_t toOffset(const std::string& text, size_t line, size_t column) {
+    size_t offset = 0;
+    for (size_t i = 1; i < line; i++) {
+        offset = text.find('\n', offset);
+        if (offset == std::string::npos) return text.size();
+        offset++;
+    }
+    return std::min(offset + (column > 0 ? column - 1 : 0), text.size());
+}
+
+// Given the offset of a scope's name, returns the offset of the brace closing
+// its body, or std::string::npos.
+static size_t findScopeEnd(const std::string& text, size_t offset) {
+    size_t depth = 0;
+    for (size_t i = offset; i < text.size(); i++) {
+        if (text.compare(i, 2, "//") == 0) {
+            i = text.find('\n', i);
+            if (i == std::string::npos) break;
+        } else if (text.compare(i, 2, "/*") == 0) {
+            i = text.find("*/", i + 2);
+            if (i == std::string::npos) break;
+            i++;
+        } else if (text[i] == '{') {
+            depth++;
+        } else if (text[i] == '}') {
+            if (depth <= 1) return i;
+            depth--;
+        }
+    }
+    return std::string::npos;
+}
+
+// Finds the innermost scope declared in the file at path which encloses
+// offset, or the root scope.
+static Scope* findEnclosingScope(Scope* scope, const std::string& path, const std::string& text,
+                                 size_t offset) {
+    for (NamedType* type : scope->getSubTypes()) {
+        if (!type->isScope()) continue;
+
+        const Location& location = type->location();
+        if (location.begin().filename() != path) continue;
+
+        size_t begin = toOffset(text, location.begin().line(), location.begin().column());
+        size_t end = findScopeEnd(text, begin);
+        if (begin <= offset && offset <= end) {
+            return findEnclosingScope(static_cast<Scope*>(type), path, text, offset);
+        }
+    }
+    return scope;
+}
+
+static bool isNameCharacter(char c) {
+    return isalnum(c) || c == '_' || c == '.' || c == ':' || c == '@';
+}
+
+// Types for which getAlignmentAndSize is meaningful.
+static bool hasWireSize(const Type* type) {
+    return type->isCompoundType() || type->isEnum() || type->isInterface() || type->isScalar() ||
+           type->isString() || type->isVector() || type->isArray() || type->isHandle() ||
+           type->isMemory();
+}
+
+LanguageServer::LanguageServer(Coordinator* coordinator, FILE* in, FILE* out)
+    : mCoordinator(coordinator), mIn(in), mOut(out) {}
+
+int LanguageServer::run() {
+    Json::Value message;
+    while (readMessage(&message)) {
+        if (message["method"].asString() == "exit") {
+            return mShutdown ? 0 : 1;
+        }
+        handleMessage(message);
+    }
+    return 1;
+}
+
+bool LanguageServer::readMessage(Json::Value* message) {
+    size_t length = 0;
+    char line[256];
+    while (fgets(line, sizeof(line), mIn) != nullptr) {
+        std::string header = StringHelper::RTrim(StringHelper::RTrim(line, "\n"), "\r");
+        if (header.empty()) {
+            if (length == 0) continue;
+
+            std::string content(length, '\0');
+            if (fread(&content[0], 1, length, mIn) != length) return false;
+
+            std::string error;
+            std::unique_ptr<Json::CharReader> reader(Json::CharReaderBuilder().newCharReader());
+            if (!reader->parse(content.data(), content.data() + content.size(), message,
+                               &error)) {
+                std::cerr << "ERROR: Malformed message: " << error << std::endl;
+                length = 0;
+                continue;
+            }
+            return true;
+        }
+
+        static const std::string kContentLength = "Content-Length: ";
+        if (StringHelper::StartsWith(header, kContentLength) &&
+            !base::ParseUint(StringHelper::LTrim(header, kContentLength), &length)) {
+            std::cerr << "ERROR: Malformed header: " << header << std::endl;
+            length = 0;
+        }
+    }
+    return false;
+}
+
+void LanguageServer::writeMessage(const Json::Value& message) {
+    Json::StreamWriterBuilder builder;
+    builder["indentation"] = "";
+    const std::string content = Json::writeString(builder, message);
+
+    fprintf(mOut, "Content-Length: %zu\r\n\r\n%s", content.size(), content.c_str());
+    fflush(mOut);
+}
+
+void LanguageServer::sendResult(const Json::Value& id, const Json::Value& result) {
+    Json::Value message;
+    message["jsonrpc"] = "2.0";
+    message["id"] = id;
+    message["result"] = result;
+    writeMessage(message);
+}
+
+void LanguageServer::sendError(const Json::Value& id, int code, const std::string& text) {
+    Json::Value message;
+    message["jsonrpc"] = "2.0";
+    message["id"] = id;
+    message["error"]["code"] = code;
+    message["error"]["message"] = text;
+    writeMessage(message);
+}
+
+void LanguageServer::sendNotification(const std::string& method, const Json::Value& params) {
+    Json::Value message;
+    message["jsonrpc"] = "2.0";
+    message["method"] = method;
+    message["params"] = params;
+    writeMessage(message);
+}
+
+void LanguageServer::handleMessage(const Json::Value& message) {
+    const std::string method = message["method"].asString();
+    const Json::Value& params = message["params"];
+
+    if (!message.isMember("id")) {
+        if (method == "textDocument/didOpen") {
+            didOpen(params);
+        } else if (method == "textDocument/didChange") {
+            didChange(params);
+        } else if (method == "textDocument/didClose") {
+            didClose(params);
+        }
+        // other notifications are ignored
+        return;
+    }
+
+    const Json::Value& id = message["id"];
+
+    if (mShutdown) {
+        sendError(id, kInvalidRequest, "Server is shutting down");
+    } else if (method == "initialize") {
+        sendResult(id, initialize(params));
+    } else if (method == "shutdown") {
+        mShutdown = true;
+        sendResult(id, Json::Value());
+    } else if (method == "textDocument/definition") {
+        sendResult(id, definition(params));
+    } else if (method == "textDocument/hover") {
+        sendResult(id, hover(params));
+    } else {
+        sendError(id, kMethodNotFound, "Unsupported method " + method);
+    }
+}
+
+Json::Value LanguageServer::initialize(const Json::Value& params) {
+    if (mCoordinator->getRootPath().empty()) {
+        std::string rootPath;
+        if (params["rootUri"].isString() && uriToPath(params["rootUri"].asString(), &rootPath)) {
+            mCoordinator->setRootPath(rootPath);
+        } else {
+            char cwd[PATH_MAX];
+            if (getcwd(cwd, sizeof(cwd)) != nullptr) mCoordinator->setRootPath(cwd);
+        }
+    }
+
+    Json::Value capabilities;
+    capabilities["textDocumentSync"]["openClose"] = true;
+    capabilities["textDocumentSync"]["change"] = 1;  // Full
+    capabilities["definitionProvider"] = true;
+    capabilities["hoverProvider"] = true;
+
+    Json::Value ret;
+    ret["capabilities"] = capabilities;
+    ret["serverInfo"]["name"] = "hidl-lsp";
+    return ret;
+}
+
+void LanguageServer::didOpen(const Json::Value& params) {
+    std::string path;
+    if (!uriToPath(params["textDocument"]["uri"].asString(), &path)) return;
+
+    Document& document = mDocuments[path];
+    document.text = params["textDocument"]["text"].asString();
+    document.hasFqName = mCoordinator->getFQNameForPath(path, &document.fqName) == OK;
+
+    update(path);
+}
+
+void LanguageServer::didChange(const Json::Value& params) {
+    std::string path;
+    if (!uriToPath(params["textDocument"]["uri"].asString(), &path)) return;
+
+    auto it = mDocuments.find(path);
+    if (it == mDocuments.end()) return;
+
+    // Only full document synchronization is advertised.
+    const Json::Value& changes = params["contentChanges"];
+    if (changes.empty()) return;
+    it->second.text = changes[changes.size() - 1]["text"].asString();
+
+    update(path);
+}
+
+void LanguageServer::didClose(const Json::Value& params) {
+    std::string path;
+    if (!uriToPath(params["textDocument"]["uri"].asString(), &path)) return;
+
+    auto it = mDocuments.find(path);
+    if (it == mDocuments.end()) return;
+
+    const Document document = it->second;
+    mDocuments.erase(it);
+
+    // Go back to the contents on disk.
+    mCoordinator->clearFileContents(path);
+    if (document.hasFqName) {
+        mCoordinator->invalidate(document.fqName);
+    }
+
+    Json::Value diagnostics;
+    diagnostics["uri"] = pathToUri(path);
+    diagnostics["diagnostics"] = Json::Value(Json::arrayValue);
+    sendNotification("textDocument/publishDiagnostics", diagnostics);
+}
+
+void LanguageServer::update(const std::string& path) {
+    const Document& document = mDocuments.at(path);
+    mCoordinator->setFileContents(path, document.text);
+
+    if (!document.hasFqName) {
+        publishDiagnostics(path);
+        return;
+    }
+
+    std::set<FQName> invalidated;
+    mCoordinator->invalidate(document.fqName, &invalidated);
+
+    publishDiagnostics(path);
+
+    for (const auto& entry : mDocuments) {
+        if (entry.first == path || !entry.second.hasFqName) continue;
+        if (invalidated.find(entry.second.fqName) == invalidated.end()) continue;
+
+        publishDiagnostics(entry.first);
+    }
+}
+
+void LanguageServer::publishDiagnostics(const std::string& path) {
+    const Document& document = mDocuments.at(path);
+
+    Json::Value params;
+    params["uri"] = pathToUri(path);
+
+    if (!document.hasFqName) {
+        params["diagnostics"] = makeDiagnostics(
+            path, "ERROR: " + path + " is not in any package root (see -r).\n");
+        sendNotification("textDocument/publishDiagnostics", params);
+        return;
+    }
+
+    std::string output;
+    {
+        ErrorCapture capture;
+        // Hashes are computed from the files on disk, not from unsaved buffers.
+        AST* ast = mCoordinator->parse(document.fqName, nullptr /* parsedASTs */,
+                                       Coordinator::Enforce::NO_HASH);
+        output = capture.str();
+
+        // Errors in imports are only reported the first time they are parsed.
+        if (ast == nullptr && output.empty()) {
+            output = "ERROR: Could not parse " + document.fqName.string() +
+                     " or one of its imports.\n";
+        }
+    }
+
+    params["diagnostics"] = makeDiagnostics(path, output);
+    sendNotification("textDocument/publishDiagnostics", params);
+}
+
+const Type* LanguageServer::lookupTypeAt(const Json::Value& params) {
+    std::string path;
+    if (!uriToPath(params["textDocument"]["uri"].asString(), &path)) return nullptr;
+
+    auto it = mDocuments.find(path);
+    if (it == mDocuments.end() || !it->second.hasFqName) return nullptr;
+    const Document& document = it->second;
+
+    const std::string& text = document.text;
+    const size_t offset = toOffset(text, params["position"]["line"].asUInt() + 1,
+                                   params["position"]["character"].asUInt() + 1);
+
+    size_t begin = offset;
+    while (begin > 0 && isNameCharacter(text[begin - 1])) begin--;
+    size_t end = offset;
+    while (end < text.size() && isNameCharacter(text[end])) end++;
+    if (begin == end) return nullptr;
+
+    ErrorCapture capture;  // failed lookups are expected, don't report them
+
+    FQName fqName;
+    if (!FQName::parse(StringHelper::RTrimAll(text.substr(begin, end - begin), "."), &fqName)) {
+        return nullptr;
+    }
+    // For enum values, e.x. "Foo:BAR", go to the enum.
+    if (!fqName.valueName().empty()) {
+        if (fqName.name().empty()) return nullptr;
+        fqName = fqName.typeName();
+    }
+
+    AST* ast = mCoordinator->parse(document.fqName, nullptr /* parsedASTs */,
+                                   Coordinator::Enforce::NO_HASH);
+    if (ast == nullptr) return nullptr;
+
+    Scope* scope = findEnclosingScope(ast->getRootScope(), path, text, offset);
+    return ast->lookupType(fqName, scope);
+}
+
+Json::Value LanguageServer::definition(const Json::Value& params) {
+    const Type* type = lookupTypeAt(params);
+    if (type == nullptr || !type->isNamedType()) return Json::Value();
+
+    const Location& location = static_cast<const NamedType*>(type)->location();
+    if (!location.isValid()) return Json::Value();
+
+    Json::Value ret;
+    ret["uri"] = pathToUri(location.begin().filename());
+    ret["range"] = makeRange(location);
+    return ret;
+}
+
+Json::Value LanguageServer::hover(const Json::Value& params) {
+    const Type* type = lookupTypeAt(params);
+    if (type == nullptr) return Json::Value();
+
+    std::ostringstream contents;
+    contents << "```\n" << type->typeName() << "\n```\n";
+
+    if (type->isNamedType()) {
+        contents << "`" << static_cast<const NamedType*>(type)->fqName().string() << "`\n\n";
+    }
+
+    const Type* resolved = type->resolve();
+    if (hasWireSize(resolved)) {
+        size_t align, size;
+        resolved->getAlignmentAndSize(&align, &size);
+        contents << "Wire size: " << size << " bytes, alignment: " << align << " bytes\n";
+    }
+
+    Json::Value ret;
+    ret["contents"]["kind"] = "markdown";
+    ret["contents"]["value"] = contents.str();
+    return ret;
+}
+
+}  // namespace android
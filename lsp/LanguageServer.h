@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HIDL_LANGUAGE_SERVER_H_
+
+#define HIDL_LANGUAGE_SERVER_H_
+
+#include <android-base/macros.h>
+#include <hidl-util/FQName.h>
+#include <json/json.h>
+#include <stdio.h>
+
+#include <map>
+#include <string>
+
+namespace android {
+
+struct Coordinator;
+struct Type;
+
+// Language Server Protocol front-end for .hal files.
+//
+// The Coordinator is kept warm across requests: when a document changes,
+// only its own AST and the cached ASTs which import it are dropped and
+// parsed again; everything else stays in the Coordinator's cache.
+struct LanguageServer {
+    LanguageServer(Coordinator* coordinator, FILE* in, FILE* out);
+
+    // Serves requests until the client sends "exit".
+    // Returns the process exit code mandated by the protocol.
+    int run();
+
+   private:
+    struct Document {
+        std::string text;
+        // Only valid if hasFqName.
+        FQName fqName;
+        bool hasFqName = false;
+    };
+
+    Coordinator* const mCoordinator;
+    FILE* const mIn;
+    FILE* const mOut;
+
+    bool mShutdown = false;
+
+    // open documents, by absolute path
+    std::map<std::string, Document> mDocuments;
+
+    bool readMessage(Json::Value* message);
+    void writeMessage(const Json::Value& message);
+
+    void sendResult(const Json::Value& id, const Json::Value& result);
+    void sendError(const Json::Value& id, int code, const std::string& message);
+    void sendNotification(const std::string& method, const Json::Value& params);
+
+    void handleMessage(const Json::Value& message);
+
+    Json::Value initialize(const Json::Value& params);
+    void didOpen(const Json::Value& params);
+    void didChange(const Json::Value& params);
+    void didClose(const Json::Value& params);
+    Json::Value definition(const Json::Value& params);
+    Json::Value hover(const Json::Value& params);
+
+    // Reparses the document at path and the open documents depending on it,
+    // and publishes their diagnostics.
+    void update(const std::string& path);
+    void publishDiagnostics(const std::string& path);
+
+    // Resolves the type name under the cursor of a TextDocumentPositionParams.
+    const Type* lookupTypeAt(const Json::Value& params);
+
+    DISALLOW_COPY_AND_ASSIGN(LanguageServer);
+};
+
+}  // namespace android
+
+#endif  // HIDL_LANGUAGE_SERVER_H_
@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <string>
+
+#include "Coordinator.h"
+#include "LanguageServer.h"
+
+using namespace android;
+
+static void usage(const char* me) {
+    fprintf(stderr, "usage: %s [-p <root path>] (-r <interface root>)* [-R]\n\n", me);
+
+    fprintf(stderr,
+            "Serves the Language Server Protocol for .hal files over stdin/stdout.\n\n");
+
+    fprintf(stderr, "         -h: Prints this menu.\n");
+    fprintf(stderr,
+            "         -p <root path>: Android build root, defaults to $ANDROID_BUILD_TOP or the "
+            "workspace root.\n");
+    fprintf(stderr, "         -R: Do not add default package roots if not specified in -r.\n");
+    fprintf(stderr,
+            "         -r <package:path root>: E.g., android.hardware:hardware/interfaces.\n");
+}
+
+// hidl is intentionally leaky. Turn off LeakSanitizer by default.
+extern "C" const char *__asan_default_options() {
+    return "detect_leaks=0";
+}
+
+int main(int argc, char** argv) {
+    const char* me = argv[0];
+
+    Coordinator coordinator;
+    bool suppressDefaultPackagePaths = false;
+
+    int res;
+    while ((res = getopt(argc, argv, "hp:r:R")) >= 0) {
+        switch (res) {
+            case 'p': {
+                if (!coordinator.getRootPath().empty()) {
+                    fprintf(stderr, "ERROR: -p <root path> can only be specified once.\n");
+                    exit(1);
+                }
+                // Editors send absolute paths, so the root must be absolute too.
+                char rootPath[PATH_MAX];
+                if (realpath(optarg, rootPath) == nullptr) {
+                    fprintf(stderr, "ERROR: Could not find root path %s.\n", optarg);
+                    exit(1);
+                }
+                coordinator.setRootPath(rootPath);
+                break;
+            }
+
+            case 'r': {
+                std::string val(optarg);
+                auto index = val.find_first_of(':');
+                if (index == std::string::npos) {
+                    fprintf(stderr, "ERROR: -r option must contain ':': %s\n", val.c_str());
+                    exit(1);
+                }
+
+                auto root = val.substr(0, index);
+                auto path = val.substr(index + 1);
+
+                std::string error;
+                status_t err = coordinator.addPackagePath(root, path, &error);
+                if (err != OK) {
+                    fprintf(stderr, "%s\n", error.c_str());
+                    exit(1);
+                }
+
+                break;
+            }
+
+            case 'R': {
+                suppressDefaultPackagePaths = true;
+                break;
+            }
+
+            case '?':
+            case 'h':
+            default: {
+                usage(me);
+                exit(1);
+                break;
+            }
+        }
+    }
+
+    if (optind != argc) {
+        usage(me);
+        exit(1);
+    }
+
+    // Otherwise, the root path is taken from the client's workspace root.
+    if (coordinator.getRootPath().empty()) {
+        const char* ANDROID_BUILD_TOP = getenv("ANDROID_BUILD_TOP");
+        if (ANDROID_BUILD_TOP != nullptr) {
+            coordinator.setRootPath(ANDROID_BUILD_TOP);
+        }
+    }
+
+    if (!suppressDefaultPackagePaths) {
+        coordinator.addDefaultPackagePath("android.hardware", "hardware/interfaces");
+        coordinator.addDefaultPackagePath("android.hidl", "system/libhidl/transport");
+        coordinator.addDefaultPackagePath("android.frameworks", "frameworks/hardware/interfaces");
+        coordinator.addDefaultPackagePath("android.system", "system/hardware/interfaces");
+    }
+
+    // stdout carries the protocol. Anything else libhidl-gen prints there
+    // would corrupt it, so point STDOUT_FILENO at stderr instead.
+    int outFd = dup(STDOUT_FILENO);
+    FILE* out = outFd < 0 ? nullptr : fdopen(outFd, "w");
+    if (out == nullptr || dup2(STDERR_FILENO, STDOUT_FILENO) < 0) {
+        fprintf(stderr, "ERROR: Could not set up stdout.\n");
+        exit(1);
+    }
+
+    LanguageServer server(&coordinator, stdin, out);
+    return server.run();
+}
@@ -718,6 +718,80 @@ static status_t generateAndroidBpImplForPackage(Formatter& out, const FQName& pa
     return OK;
 }
 
+static status_t generateAndroidBpBenchmarkForPackage(Formatter& out,
+                                                     const FQName& packageFQName,
+                                                     const Coordinator* coordinator) {
+    const std::string libraryName = makeLibraryName(packageFQName);
+    const std::string defaultsName = libraryName + "-benchmark-defaults";
+
+    std::vector<FQName> packageInterfaces;
+
+    status_t err =
+        coordinator->appendPackageInterfacesToVector(packageFQName,
+                                                     &packageInterfaces);
+
+    if (err != OK) {
+        return err;
+    }
+
+    std::set<FQName> importedPackages;
+
+    for (const auto &fqName : packageInterfaces) {
+        AST *ast = coordinator->parse(fqName);
+
+        if (ast == nullptr) {
+            fprintf(stderr,
+                    "ERROR: Could not parse %s. Aborting.\n",
+                    fqName.string().c_str());
+
+            return UNKNOWN_ERROR;
+        }
+
+        ast->getImportedPackages(&importedPackages);
+    }
+
+    out << "// This file is autogenerated by hidl-gen -Landroidbp-benchmark.\n\n";
+
+    out << "cc_defaults ";
+    out.block([&] {
+        out << "name: \"" << defaultsName << "\",\n";
+        if (!coordinator->getOwner().empty()) {
+            out << "owner: \"" << coordinator->getOwner() << "\",\n";
+        }
+        out << "host_supported: true,\n";
+        out << "shared_libs: [\n";
+        out.indent([&] {
+            out << "\"libhidlbase\",\n"
+                << "\"libutils\",\n"
+                << "\"" << libraryName << "\",\n";
+
+            for (const auto &importedPackage : importedPackages) {
+                if (isHidlTransportPackage(importedPackage)) {
+                    continue;
+                }
+
+                out << "\"" << makeLibraryName(importedPackage) << "\",\n";
+            }
+        });
+        out << "],\n";
+    }).endl();
+
+    for (const auto &fqName : packageInterfaces) {
+        if (fqName.name() == "types") {
+            continue;
+        }
+
+        out << "\ncc_benchmark ";
+        out.block([&] {
+            out << "name: \"" << libraryName << "-" << fqName.name() << "-benchmark\",\n";
+            out << "defaults: [\"" << defaultsName << "\"],\n";
+            out << "srcs: [\"" << fqName.name() << "Benchmark.cpp\"],\n";
+        }).endl();
+    }
+
+    return OK;
+}
+
 bool validateForSource(const FQName& fqName, const Coordinator* coordinator,
                        const std::string& language) {
     if (fqName.package().empty()) {
@@ -865,7 +939,7 @@ static status_t generateHashOutput(Formatter& out, const FQName& fqName,
         return UNKNOWN_ERROR;
     }
 
-    out << Hash::getHash(ast->getFilename()).hexString() << " " << fqName.string() << "\n";
+    out << ast->getFileHash()->hexString() << " " << fqName.string() << "\n";
 
     return OK;
 }
@@ -911,6 +985,11 @@ static const std::vector<FileGenerator> kCppHeaderFormats = {
         [](const FQName& fqName) { return fqName.name() + ".h"; },
         astGenerationFunction(&AST::generateInterfaceHeader),
     },
+    {
+        FileGenerator::generateForInterfaces,
+        [](const FQName& fqName) { return fqName.name() + "Fwd.h"; },
+        astGenerationFunction(&AST::generateInterfaceForwardHeader),
+    },
     {
         FileGenerator::alwaysGenerate,
         [](const FQName& fqName) {
@@ -961,6 +1040,14 @@ static const std::vector<FileGenerator> kCppImplSourceFormats = {
     },
 };
 
+static const std::vector<FileGenerator> kCppBenchmarkFormats = {
+    {
+        FileGenerator::generateForInterfaces,
+        [](const FQName& fqName) { return fqName.name() + "Benchmark.cpp"; },
+        astGenerationFunction(&AST::generateCppBenchmarkSource),
+    },
+};
+
 static const std::vector<FileGenerator> kCppAdapterHeaderFormats = {
     {
         FileGenerator::alwaysGenerate,
@@ -1060,6 +1147,16 @@ static const std::vector<OutputHandler> kFormats = {
         validateForSource,
         kCppImplSourceFormats,
     },
+    {
+        "benchmark",
+        "Generates google-benchmark sources measuring the marshalling of the methods of "
+        "interfaces.",
+        OutputMode::NEEDS_DIR,
+        Coordinator::Location::DIRECT,
+        GenerationGranularity::PER_FILE,
+        validateForSource,
+        kCppBenchmarkFormats,
+    },
     {
         "c++-adapter",
         "Takes a x.(y+n) interface and mocks an x.y interface.",
@@ -1169,6 +1266,15 @@ static const std::vector<OutputHandler> kFormats = {
         validateIsPackage,
         {singleFileGenerator("Android.bp", generateAndroidBpImplForPackage)},
     },
+    {
+        "androidbp-benchmark",
+        "Generates bp files for benchmarks created with -Lbenchmark.",
+        OutputMode::NEEDS_DIR,
+        Coordinator::Location::DIRECT,
+        GenerationGranularity::PER_PACKAGE,
+        validateIsPackage,
+        {singleFileGenerator("Android.bp", generateAndroidBpBenchmarkForPackage)},
+    },
     {
         "hash",
         "Prints hashes of interface in `current.txt` format to standard out.",
@@ -1220,7 +1326,7 @@ static const std::vector<OutputHandler> kFormats = {
 static void usage(const char *me) {
     fprintf(stderr,
             "usage: %s [-p <root path>] -o <output path> -L <language> [-O <owner>] (-r <interface "
-            "root>)+ [-R] [-v] [-d <depfile>] FQNAME...\n\n",
+            "root>)+ [-R] [-v] [-d <depfile>] [-J] [-H] [-S] [-T] [-F] FQNAME...\n\n",
             me);
 
     fprintf(stderr,
@@ -1238,6 +1344,17 @@ static void usage(const char *me) {
     fprintf(stderr, "         -r <package:path root>: E.g., android.hardware:hardware/interfaces.\n");
     fprintf(stderr, "         -v: verbose output.\n");
     fprintf(stderr, "         -d <depfile>: location of depfile to write to.\n");
+    fprintf(stderr, "         -J: Reuse reply parcels in Java proxies. A reused parcel keeps the\n");
+    fprintf(stderr, "             binder buffer of its last reply until the same thread calls\n");
+    fprintf(stderr, "             the interface again, so this holds on to buffer space.\n");
+    fprintf(stderr, "         -H: Record per-method latency histograms in C++ proxies, stubs\n");
+    fprintf(stderr, "             and passthrough wrappers, and print them from debug().\n");
+    fprintf(stderr, "         -S: Optimize C++ proxies and stubs for size, sharing the marshalling\n");
+    fprintf(stderr, "             code of each struct passed more than once between its methods.\n");
+    fprintf(stderr, "         -T: Define toString, operator== and std::hash of types in the C++\n");
+    fprintf(stderr, "             sources instead of inline in the headers.\n");
+    fprintf(stderr, "         -F: Only forward declare imported interfaces in interface headers\n");
+    fprintf(stderr, "             when they are only passed to or returned from methods.\n");
 }
 
 // hidl is intentionally leaky. Turn off LeakSanitizer by default.
@@ -1258,7 +1375,7 @@ int main(int argc, char **argv) {
     bool suppressDefaultPackagePaths = false;
 
     int res;
-    while ((res = getopt(argc, argv, "hp:o:O:r:L:vd:R")) >= 0) {
+    while ((res = getopt(argc, argv, "hp:o:O:r:L:vd:RJHSTF")) >= 0) {
         switch (res) {
             case 'p': {
                 if (!coordinator.getRootPath().empty()) {
@@ -1279,6 +1396,31 @@ int main(int argc, char **argv) {
                 break;
             }
 
+            case 'J': {
+                coordinator.setReuseJavaParcels(true);
+                break;
+            }
+
+            case 'H': {
+                coordinator.setEmitLatencyHistograms(true);
+                break;
+            }
+
+            case 'S': {
+                coordinator.setOptimizeSize(true);
+                break;
+            }
+
+            case 'T': {
+                coordinator.setOutOfLineTypeDefinitions(true);
+                break;
+            }
+
+            case 'F': {
+                coordinator.setForwardDeclareInterfaces(true);
+                break;
+            }
+
             case 'o': {
                 if (!outputPath.empty()) {
                     fprintf(stderr, "ERROR: -o <output path> can only be specified once.\n");
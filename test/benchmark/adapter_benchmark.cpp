@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <hidl/tests/benchmark/1.0/AEventSource.h>
+
+using ::android::sp;
+using ::android::hardware::Return;
+using ::android::hardware::Void;
+using ::hidl::tests::benchmark::V1_0::AEventSource;
+using ::hidl::tests::benchmark::V1_0::ICallback;
+using ::hidl::tests::benchmark::V1_0::IEventSource;
+
+struct Callback : public ICallback {
+    Return<void> onEvent(int32_t value) {
+        benchmark::DoNotOptimize(value);
+        return Void();
+    }
+};
+
+// Keeps the last callback it was given, as HALs which register callbacks do.
+struct EventSource : public IEventSource {
+    Return<void> post(const sp<ICallback>& callback, int32_t value) {
+        mCallback = callback;
+        return mCallback->onEvent(value);
+    }
+
+    sp<ICallback> mCallback;
+};
+
+// Posts to an implementation directly, as the baseline for the adapted case.
+static void BM_PostDirect(benchmark::State& state) {
+    sp<IEventSource> source = new EventSource();
+    sp<ICallback> callback = new Callback();
+
+    int32_t value = 0;
+    while (state.KeepRunning()) {
+        source->post(callback, value++);
+    }
+}
+BENCHMARK(BM_PostDirect);
+
+// Posts the same callback over and over through an adapter. The callback is
+// adapted on every call, but since the implementation keeps it, its adapter
+// is only created once and then found in the adapter's cache.
+static void BM_PostAdapted(benchmark::State& state) {
+    sp<IEventSource> source = new AEventSource(new EventSource());
+    sp<ICallback> callback = new Callback();
+
+    int32_t value = 0;
+    while (state.KeepRunning()) {
+        source->post(callback, value++);
+    }
+}
+BENCHMARK(BM_PostAdapted);
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <hidl/tests/benchmark/1.0/BnHwChain1.h>
+#include <hidl/tests/benchmark/1.0/BnHwChain2.h>
+#include <hidl/tests/benchmark/1.0/BnHwChain4.h>
+#include <hidl/tests/benchmark/1.0/BnHwChain8.h>
+
+using ::android::sp;
+using ::android::hardware::Parcel;
+using ::android::hardware::Return;
+using ::android::hardware::Void;
+using ::hidl::tests::benchmark::V1_0::BnHwChain1;
+using ::hidl::tests::benchmark::V1_0::BnHwChain2;
+using ::hidl::tests::benchmark::V1_0::BnHwChain4;
+using ::hidl::tests::benchmark::V1_0::BnHwChain8;
+
+#define CHAIN_METHODS(depth)                          \
+    Return<void> call##depth##_0() { return Void(); } \
+    Return<void> call##depth##_1() { return Void(); } \
+    Return<void> call##depth##_2() { return Void(); } \
+    Return<void> call##depth##_3() { return Void(); }
+
+// Implements every method of IChain8, and so those of any IChain.
+template <typename Interface>
+struct Chain : public Interface {
+    CHAIN_METHODS(1)
+    CHAIN_METHODS(2)
+    CHAIN_METHODS(3)
+    CHAIN_METHODS(4)
+    CHAIN_METHODS(5)
+    CHAIN_METHODS(6)
+    CHAIN_METHODS(7)
+    CHAIN_METHODS(8)
+};
+
+// Dispatches the last method of an interface at the given depth of the
+// chain, i.e. the one with the highest serial ID.
+template <typename Stub, size_t kDepth>
+static void BM_StubDispatch(benchmark::State& state) {
+    using Interface = typename Stub::Pure;
+    sp<Stub> stub = new Stub(new Chain<Interface>());
+    const uint32_t code = kDepth * 4;
+
+    Parcel data;
+    data.writeInterfaceToken(Interface::descriptor);
+    Parcel reply;
+    while (state.KeepRunning()) {
+        data.setDataPosition(0);
+        reply.setDataSize(0);
+        benchmark::DoNotOptimize(stub->onTransact(code, data, &reply, 0, [](Parcel&) {}));
+    }
+}
+BENCHMARK_TEMPLATE(BM_StubDispatch, BnHwChain1, 1);
+BENCHMARK_TEMPLATE(BM_StubDispatch, BnHwChain2, 2);
+BENCHMARK_TEMPLATE(BM_StubDispatch, BnHwChain4, 4);
+BENCHMARK_TEMPLATE(BM_StubDispatch, BnHwChain8, 8);
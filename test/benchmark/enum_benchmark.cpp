@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <hidl/tests/benchmark/1.0/types.h>
+
+#include <string>
+#include <vector>
+
+using ::android::hardware::hidl_enum_range;
+using ::android::hardware::details::toHexString;
+using ::hidl::tests::benchmark::V1_0::Big;
+using ::hidl::tests::benchmark::V1_0::Flags;
+
+// Same work as the toString functions hidl-gen used to emit: one comparison
+// per value, in declaration order.
+template <typename Enum>
+struct Legacy {
+    using Scalar = std::underlying_type_t<Enum>;
+
+    Legacy() {
+        for (Enum value : hidl_enum_range<Enum>()) {
+            values.push_back(value);
+            names.push_back(::hidl::tests::benchmark::V1_0::toString(value));
+        }
+    }
+
+    std::string toString(Enum o) const {
+        for (size_t i = 0; i < values.size(); i++) {
+            if (o == values[i]) return names[i];
+        }
+        std::string os;
+        os += toHexString(static_cast<Scalar>(o));
+        return os;
+    }
+
+    std::string toString(Scalar o) const {
+        std::string os;
+        Scalar flipped = 0;
+        bool first = true;
+        for (size_t i = 0; i < values.size(); i++) {
+            const Scalar value = static_cast<Scalar>(values[i]);
+            if ((o & value) == value) {
+                os += (first ? "" : " | ");
+                os += names[i];
+                first = false;
+                flipped |= value;
+            }
+        }
+        if (o != flipped) {
+            os += (first ? "" : " | ");
+            os += toHexString(o & (~flipped));
+        }
+        os += " (";
+        os += toHexString(o);
+        os += ")";
+        return os;
+    }
+
+    std::vector<Enum> values;
+    std::vector<std::string> names;
+};
+
+static void BM_EnumToString_Legacy(benchmark::State& state) {
+    const Legacy<Big> legacy;
+    while (state.KeepRunning()) {
+        for (Big value : hidl_enum_range<Big>()) {
+            benchmark::DoNotOptimize(legacy.toString(value));
+        }
+    }
+}
+BENCHMARK(BM_EnumToString_Legacy);
+
+static void BM_EnumToString(benchmark::State& state) {
+    while (state.KeepRunning()) {
+        for (Big value : hidl_enum_range<Big>()) {
+            benchmark::DoNotOptimize(::hidl::tests::benchmark::V1_0::toString(value));
+        }
+    }
+}
+BENCHMARK(BM_EnumToString);
+
+// a few bits, as in typical capability masks
+static const uint32_t kFlags = static_cast<uint32_t>(Flags::FLAG_0 | Flags::FLAG_5) |
+                               static_cast<uint32_t>(Flags::FLAG_17 | Flags::FLAG_30);
+
+static void BM_BitfieldToString_Legacy(benchmark::State& state) {
+    const Legacy<Flags> legacy;
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(legacy.toString(kFlags));
+    }
+}
+BENCHMARK(BM_BitfieldToString_Legacy);
+
+static void BM_BitfieldToString(benchmark::State& state) {
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(::hidl::tests::benchmark::V1_0::toString<Flags>(kFlags));
+    }
+}
+BENCHMARK(BM_BitfieldToString);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <android/hidl/manager/1.2/IServiceManager.h>
+#include <hidl/Static.h>
+#include <hidl/tests/benchmark/1.0/ICachedService.h>
+#include <hidl/tests/benchmark/1.0/IService.h>
+
+using ::android::sp;
+using ::android::hardware::hidl_string;
+using ::android::hardware::hidl_vec;
+using ::android::hardware::Return;
+using ::android::hardware::Void;
+using ::android::hidl::base::V1_0::IBase;
+using ::android::hidl::manager::V1_0::IServiceNotification;
+using ::android::hidl::manager::V1_2::IClientCallback;
+using ::android::hidl::manager::V1_2::IServiceManager;
+using ::hidl::tests::benchmark::V1_0::ICachedService;
+using ::hidl::tests::benchmark::V1_0::IService;
+
+template <typename Interface>
+struct Service : public Interface {
+    Return<void> call() { return Void(); }
+};
+
+// Stands in for hwservicemanager: every lookup succeeds with the same
+// in-process object, so only the per-lookup overhead of getService is
+// measured and not that of a binder transaction.
+struct LocalServiceManager : public IServiceManager {
+    explicit LocalServiceManager(const sp<IBase>& service) : mService(service) {}
+
+    Return<sp<IBase>> get(const hidl_string&, const hidl_string&) { return mService; }
+    Return<bool> add(const hidl_string&, const sp<IBase>&) { return false; }
+    Return<Transport> getTransport(const hidl_string&, const hidl_string&) {
+        return Transport::HWBINDER;
+    }
+    Return<void> list(list_cb _hidl_cb) {
+        _hidl_cb({});
+        return Void();
+    }
+    Return<void> listByInterface(const hidl_string&, listByInterface_cb _hidl_cb) {
+        _hidl_cb({});
+        return Void();
+    }
+    Return<bool> registerForNotifications(const hidl_string&, const hidl_string&,
+                                          const sp<IServiceNotification>&) {
+        return false;
+    }
+    Return<void> debugDump(debugDump_cb _hidl_cb) {
+        _hidl_cb({});
+        return Void();
+    }
+    Return<void> registerPassthroughClient(const hidl_string&, const hidl_string&) {
+        return Void();
+    }
+    Return<bool> unregisterForNotifications(const hidl_string&, const hidl_string&,
+                                            const sp<IServiceNotification>&) {
+        return false;
+    }
+    Return<bool> registerClientCallback(const hidl_string&, const hidl_string&,
+                                        const sp<IBase>&, const sp<IClientCallback>&) {
+        return false;
+    }
+    Return<bool> unregisterClientCallback(const sp<IBase>&, const sp<IClientCallback>&) {
+        return false;
+    }
+    Return<bool> addWithChain(const hidl_string&, const sp<IBase>&,
+                              const hidl_vec<hidl_string>&) {
+        return false;
+    }
+    Return<void> listManifestByInterface(const hidl_string&,
+                                         listManifestByInterface_cb _hidl_cb) {
+        _hidl_cb({});
+        return Void();
+    }
+    Return<bool> tryUnregister(const hidl_string&, const hidl_string&, const sp<IBase>&) {
+        return false;
+    }
+
+  private:
+    const sp<IBase> mService;
+};
+
+static void setServiceManager(const sp<IServiceManager>& manager) {
+    using namespace ::android::hardware::details;
+    std::lock_guard<std::mutex> lock(gDefaultServiceManagerLock);
+    gDefaultServiceManager = manager;
+}
+
+// Looks up the same instance over and over, which for an interface with
+// @cachedService hits the generated cache after the first iteration.
+template <typename Interface>
+static void BM_GetService(benchmark::State& state) {
+    setServiceManager(new LocalServiceManager(new Service<Interface>()));
+
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(Interface::getService());
+    }
+
+    setServiceManager(nullptr);
+}
+BENCHMARK_TEMPLATE(BM_GetService, IService);
+BENCHMARK_TEMPLATE(BM_GetService, ICachedService);
@@ -0,0 +1,56 @@
+package golden.V1_0;
+
+
+public final class Access {
+    public static final byte NO_ACCESS = 0;
+    public static final byte READ = 1 /* (1 << 0) */;
+    public static final byte WRITE = 2 /* (1 << 1) */;
+    public static final byte EXECUTE = 8 /* (1 << 3) */;
+    public static final byte SETUID = -128 /* (1 << 7) */;
+    public static final String toString(byte o) {
+        if (o == NO_ACCESS) {
+            return "NO_ACCESS";
+        }
+        if (o == READ) {
+            return "READ";
+        }
+        if (o == WRITE) {
+            return "WRITE";
+        }
+        if (o == EXECUTE) {
+            return "EXECUTE";
+        }
+        if (o == SETUID) {
+            return "SETUID";
+        }
+        return "0x" + Integer.toHexString(Byte.toUnsignedInt((byte)(o)));
+    }
+
+    public static final String dumpBitfield(byte o) {
+        java.util.ArrayList<String> list = new java.util.ArrayList<>();
+        byte flipped = 0;
+        list.add("NO_ACCESS"); // NO_ACCESS == 0
+        if ((o & READ) == READ) {
+            list.add("READ");
+            flipped |= READ;
+        }
+        if ((o & WRITE) == WRITE) {
+            list.add("WRITE");
+            flipped |= WRITE;
+        }
+        if ((o & EXECUTE) == EXECUTE) {
+            list.add("EXECUTE");
+            flipped |= EXECUTE;
+        }
+        if ((o & SETUID) == SETUID) {
+            list.add("SETUID");
+            flipped |= SETUID;
+        }
+        if (o != flipped) {
+            list.add("0x" + Integer.toHexString(Byte.toUnsignedInt((byte)(o & (~flipped)))));
+        }
+        return String.join(" | ", list);
+    }
+
+};
+
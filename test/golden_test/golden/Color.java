@@ -0,0 +1,45 @@
+package golden.V1_0;
+
+
+public final class Color {
+    public static final int RED = 0;
+    public static final int GREEN = 5;
+    public static final int BLUE = 6 /* (::golden::V1_0::Color.GREEN implicitly + 1) */;
+    public static final int CRIMSON = 0 /* RED */;
+    public static final String toString(int o) {
+        if (o == RED) {
+            return "RED";
+        }
+        if (o == GREEN) {
+            return "GREEN";
+        }
+        if (o == BLUE) {
+            return "BLUE";
+        }
+        if (o == CRIMSON) {
+            return "CRIMSON";
+        }
+        return "0x" + Integer.toHexString(o);
+    }
+
+    public static final String dumpBitfield(int o) {
+        java.util.ArrayList<String> list = new java.util.ArrayList<>();
+        int flipped = 0;
+        list.add("RED"); // RED == 0
+        if ((o & GREEN) == GREEN) {
+            list.add("GREEN");
+            flipped |= GREEN;
+        }
+        if ((o & BLUE) == BLUE) {
+            list.add("BLUE");
+            flipped |= BLUE;
+        }
+        list.add("CRIMSON"); // CRIMSON == 0
+        if (o != flipped) {
+            list.add("0x" + Integer.toHexString(o & (~flipped)));
+        }
+        return String.join(" | ", list);
+    }
+
+};
+
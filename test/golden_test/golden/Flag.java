@@ -0,0 +1,48 @@
+package golden.V1_0;
+
+
+public final class Flag {
+    public static final byte NONE = 0;
+    public static final byte A = 1 /* (1 << 0) */;
+    public static final byte B = 2 /* (1 << 1) */;
+    public static final byte AB = 3 /* (A | B) */;
+    public static final String toString(byte o) {
+        if (o == NONE) {
+            return "NONE";
+        }
+        if (o == A) {
+            return "A";
+        }
+        if (o == B) {
+            return "B";
+        }
+        if (o == AB) {
+            return "AB";
+        }
+        return "0x" + Integer.toHexString(Byte.toUnsignedInt((byte)(o)));
+    }
+
+    public static final String dumpBitfield(byte o) {
+        java.util.ArrayList<String> list = new java.util.ArrayList<>();
+        byte flipped = 0;
+        list.add("NONE"); // NONE == 0
+        if ((o & A) == A) {
+            list.add("A");
+            flipped |= A;
+        }
+        if ((o & B) == B) {
+            list.add("B");
+            flipped |= B;
+        }
+        if ((o & AB) == AB) {
+            list.add("AB");
+            flipped |= AB;
+        }
+        if (o != flipped) {
+            list.add("0x" + Integer.toHexString(Byte.toUnsignedInt((byte)(o & (~flipped)))));
+        }
+        return String.join(" | ", list);
+    }
+
+};
+
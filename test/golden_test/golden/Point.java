@@ -0,0 +1,109 @@
+package golden.V1_0;
+
+
+public final class Point {
+    public int x;
+    public int y;
+
+    @Override
+    public final boolean equals(Object otherObject) {
+        if (this == otherObject) {
+            return true;
+        }
+        if (otherObject == null) {
+            return false;
+        }
+        if (otherObject.getClass() != golden.V1_0.Point.class) {
+            return false;
+        }
+        golden.V1_0.Point other = (golden.V1_0.Point)otherObject;
+        if (this.x != other.x) {
+            return false;
+        }
+        if (this.y != other.y) {
+            return false;
+        }
+        return true;
+    }
+
+    @Override
+    public final int hashCode() {
+        return java.util.Objects.hash(
+                android.os.HidlSupport.deepHashCode(this.x), 
+                android.os.HidlSupport.deepHashCode(this.y));
+    }
+
+    @Override
+    public final String toString() {
+        java.lang.StringBuilder builder = new java.lang.StringBuilder();
+        builder.append("{");
+        builder.append(".x = ");
+        builder.append(this.x);
+        builder.append(", .y = ");
+        builder.append(this.y);
+        builder.append("}");
+        return builder.toString();
+    }
+
+    public final void readFromParcel(android.os.HwParcel parcel) {
+        android.os.HwBlob blob = parcel.readBuffer(8 /* size */);
+        readEmbeddedFromParcel(parcel, blob, 0 /* parentOffset */);
+    }
+
+    public static final java.util.ArrayList<Point> readVectorFromParcel(android.os.HwParcel parcel) {
+        java.util.ArrayList<Point> _hidl_vec = new java.util.ArrayList();
+        android.os.HwBlob _hidl_blob = parcel.readBuffer(16 /* sizeof hidl_vec<T> */);
+
+        {
+            int _hidl_vec_size = _hidl_blob.getInt32(0 + 8 /* offsetof(hidl_vec<T>, mSize) */);
+            android.os.HwBlob childBlob = parcel.readEmbeddedBuffer(
+                    _hidl_vec_size * 8,_hidl_blob.handle(),
+                    0 + 0 /* offsetof(hidl_vec<T>, mBuffer) */,true /* nullable */);
+
+            _hidl_vec.clear();
+            for (int _hidl_index_0 = 0; _hidl_index_0 < _hidl_vec_size; ++_hidl_index_0) {
+                golden.V1_0.Point _hidl_vec_element = new golden.V1_0.Point();
+                ((golden.V1_0.Point) _hidl_vec_element).readEmbeddedFromParcel(parcel, childBlob, _hidl_index_0 * 8);
+                _hidl_vec.add(_hidl_vec_element);
+            }
+        }
+
+        return _hidl_vec;
+    }
+
+    public final void readEmbeddedFromParcel(
+            android.os.HwParcel parcel, android.os.HwBlob _hidl_blob, long _hidl_offset) {
+        x = _hidl_blob.getInt32(_hidl_offset + 0);
+        y = _hidl_blob.getInt32(_hidl_offset + 4);
+    }
+
+    public final void writeToParcel(android.os.HwParcel parcel) {
+        android.os.HwBlob _hidl_blob = new android.os.HwBlob(8 /* size */);
+        writeEmbeddedToBlob(_hidl_blob, 0 /* parentOffset */);
+        parcel.writeBuffer(_hidl_blob);
+    }
+
+    public static final void writeVectorToParcel(
+            android.os.HwParcel parcel, java.util.ArrayList<Point> _hidl_vec) {
+        android.os.HwBlob _hidl_blob = new android.os.HwBlob(16 /* sizeof(hidl_vec<T>) */);
+        {
+            int _hidl_vec_size = _hidl_vec.size();
+            _hidl_blob.putInt32(0 + 8 /* offsetof(hidl_vec<T>, mSize) */, _hidl_vec_size);
+            _hidl_blob.putBool(0 + 12 /* offsetof(hidl_vec<T>, mOwnsBuffer) */, false);
+            android.os.HwBlob childBlob = new android.os.HwBlob((int)(_hidl_vec_size * 8));
+            for (int _hidl_index_0 = 0; _hidl_index_0 < _hidl_vec_size; ++_hidl_index_0) {
+                _hidl_vec.get(_hidl_index_0).writeEmbeddedToBlob(childBlob, _hidl_index_0 * 8);
+            }
+            _hidl_blob.putBlob(0 + 0 /* offsetof(hidl_vec<T>, mBuffer) */, childBlob);
+        }
+
+        parcel.writeBuffer(_hidl_blob);
+    }
+
+    public final void writeEmbeddedToBlob(
+            android.os.HwBlob _hidl_blob, long _hidl_offset) {
+        _hidl_blob.putInt32(_hidl_offset + 0, x);
+        _hidl_blob.putInt32(_hidl_offset + 4, y);
+    }
+};
+
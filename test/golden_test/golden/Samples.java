@@ -0,0 +1,184 @@
+package golden.V1_0;
+
+
+public final class Samples {
+    public int rate;
+    public short[] values = new short[0];
+    public int[] colors = new int[0];
+    public java.util.ArrayList<String> labels = new java.util.ArrayList<String>();
+
+    @Override
+    public final boolean equals(Object otherObject) {
+        if (this == otherObject) {
+            return true;
+        }
+        if (otherObject == null) {
+            return false;
+        }
+        if (otherObject.getClass() != golden.V1_0.Samples.class) {
+            return false;
+        }
+        golden.V1_0.Samples other = (golden.V1_0.Samples)otherObject;
+        if (this.rate != other.rate) {
+            return false;
+        }
+        if (!android.os.HidlSupport.deepEquals(this.values, other.values)) {
+            return false;
+        }
+        if (!android.os.HidlSupport.deepEquals(this.colors, other.colors)) {
+            return false;
+        }
+        if (!android.os.HidlSupport.deepEquals(this.labels, other.labels)) {
+            return false;
+        }
+        return true;
+    }
+
+    @Override
+    public final int hashCode() {
+        return java.util.Objects.hash(
+                android.os.HidlSupport.deepHashCode(this.rate), 
+                android.os.HidlSupport.deepHashCode(this.values), 
+                android.os.HidlSupport.deepHashCode(this.colors), 
+                android.os.HidlSupport.deepHashCode(this.labels));
+    }
+
+    @Override
+    public final String toString() {
+        java.lang.StringBuilder builder = new java.lang.StringBuilder();
+        builder.append("{");
+        builder.append(".rate = ");
+        builder.append(this.rate);
+        builder.append(", .values = ");
+        builder.append(java.util.Arrays.toString(this.values));
+        builder.append(", .colors = ");
+        builder.append(java.util.Arrays.toString(this.colors));
+        builder.append(", .labels = ");
+        builder.append(this.labels);
+        builder.append("}");
+        return builder.toString();
+    }
+
+    public final void readFromParcel(android.os.HwParcel parcel) {
+        android.os.HwBlob blob = parcel.readBuffer(56 /* size */);
+        readEmbeddedFromParcel(parcel, blob, 0 /* parentOffset */);
+    }
+
+    public static final java.util.ArrayList<Samples> readVectorFromParcel(android.os.HwParcel parcel) {
+        java.util.ArrayList<Samples> _hidl_vec = new java.util.ArrayList();
+        android.os.HwBlob _hidl_blob = parcel.readBuffer(16 /* sizeof hidl_vec<T> */);
+
+        {
+            int _hidl_vec_size = _hidl_blob.getInt32(0 + 8 /* offsetof(hidl_vec<T>, mSize) */);
+            android.os.HwBlob childBlob = parcel.readEmbeddedBuffer(
+                    _hidl_vec_size * 56,_hidl_blob.handle(),
+                    0 + 0 /* offsetof(hidl_vec<T>, mBuffer) */,true /* nullable */);
+
+            _hidl_vec.clear();
+            for (int _hidl_index_0 = 0; _hidl_index_0 < _hidl_vec_size; ++_hidl_index_0) {
+                golden.V1_0.Samples _hidl_vec_element = new golden.V1_0.Samples();
+                ((golden.V1_0.Samples) _hidl_vec_element).readEmbeddedFromParcel(parcel, childBlob, _hidl_index_0 * 56);
+                _hidl_vec.add(_hidl_vec_element);
+            }
+        }
+
+        return _hidl_vec;
+    }
+
+    public final void readEmbeddedFromParcel(
+            android.os.HwParcel parcel, android.os.HwBlob _hidl_blob, long _hidl_offset) {
+        rate = _hidl_blob.getInt32(_hidl_offset + 0);
+        {
+            int _hidl_vec_size = _hidl_blob.getInt32(_hidl_offset + 8 + 8 /* offsetof(hidl_vec<T>, mSize) */);
+            android.os.HwBlob childBlob = parcel.readEmbeddedBuffer(
+                    _hidl_vec_size * 2,_hidl_blob.handle(),
+                    _hidl_offset + 8 + 0 /* offsetof(hidl_vec<T>, mBuffer) */,true /* nullable */);
+
+            values = new short[_hidl_vec_size];
+            childBlob.copyToInt16Array(0 /* offset */, values, _hidl_vec_size);
+        }
+        {
+            int _hidl_vec_size = _hidl_blob.getInt32(_hidl_offset + 24 + 8 /* offsetof(hidl_vec<T>, mSize) */);
+            android.os.HwBlob childBlob = parcel.readEmbeddedBuffer(
+                    _hidl_vec_size * 4,_hidl_blob.handle(),
+                    _hidl_offset + 24 + 0 /* offsetof(hidl_vec<T>, mBuffer) */,true /* nullable */);
+
+            colors = new int[_hidl_vec_size];
+            childBlob.copyToInt32Array(0 /* offset */, colors, _hidl_vec_size);
+        }
+        {
+            int _hidl_vec_size = _hidl_blob.getInt32(_hidl_offset + 40 + 8 /* offsetof(hidl_vec<T>, mSize) */);
+            android.os.HwBlob childBlob = parcel.readEmbeddedBuffer(
+                    _hidl_vec_size * 16,_hidl_blob.handle(),
+                    _hidl_offset + 40 + 0 /* offsetof(hidl_vec<T>, mBuffer) */,true /* nullable */);
+
+            ((java.util.ArrayList<String>) labels).clear();
+            for (int _hidl_index_0 = 0; _hidl_index_0 < _hidl_vec_size; ++_hidl_index_0) {
+                String _hidl_vec_element;
+                _hidl_vec_element = childBlob.getString(_hidl_index_0 * 16);
+
+                parcel.readEmbeddedBuffer(
+                        ((String) _hidl_vec_element).getBytes().length + 1,
+                        childBlob.handle(),
+                        _hidl_index_0 * 16 + 0 /* offsetof(hidl_string, mBuffer) */,false /* nullable */);
+
+                ((java.util.ArrayList<String>) labels).add(_hidl_vec_element);
+            }
+        }
+    }
+
+    public final void writeToParcel(android.os.HwParcel parcel) {
+        android.os.HwBlob _hidl_blob = new android.os.HwBlob(56 /* size */);
+        writeEmbeddedToBlob(_hidl_blob, 0 /* parentOffset */);
+        parcel.writeBuffer(_hidl_blob);
+    }
+
+    public static final void writeVectorToParcel(
+            android.os.HwParcel parcel, java.util.ArrayList<Samples> _hidl_vec) {
+        android.os.HwBlob _hidl_blob = new android.os.HwBlob(16 /* sizeof(hidl_vec<T>) */);
+        {
+            int _hidl_vec_size = _hidl_vec.size();
+            _hidl_blob.putInt32(0 + 8 /* offsetof(hidl_vec<T>, mSize) */, _hidl_vec_size);
+            _hidl_blob.putBool(0 + 12 /* offsetof(hidl_vec<T>, mOwnsBuffer) */, false);
+            android.os.HwBlob childBlob = new android.os.HwBlob((int)(_hidl_vec_size * 56));
+            for (int _hidl_index_0 = 0; _hidl_index_0 < _hidl_vec_size; ++_hidl_index_0) {
+                _hidl_vec.get(_hidl_index_0).writeEmbeddedToBlob(childBlob, _hidl_index_0 * 56);
+            }
+            _hidl_blob.putBlob(0 + 0 /* offsetof(hidl_vec<T>, mBuffer) */, childBlob);
+        }
+
+        parcel.writeBuffer(_hidl_blob);
+    }
+
+    public final void writeEmbeddedToBlob(
+            android.os.HwBlob _hidl_blob, long _hidl_offset) {
+        _hidl_blob.putInt32(_hidl_offset + 0, rate);
+        {
+            int _hidl_vec_size = values.length;
+            _hidl_blob.putInt32(_hidl_offset + 8 + 8 /* offsetof(hidl_vec<T>, mSize) */, _hidl_vec_size);
+            _hidl_blob.putBool(_hidl_offset + 8 + 12 /* offsetof(hidl_vec<T>, mOwnsBuffer) */, false);
+            android.os.HwBlob childBlob = new android.os.HwBlob((int)(_hidl_vec_size * 2));
+            childBlob.putInt16Array(0 /* offset */, values);
+            _hidl_blob.putBlob(_hidl_offset + 8 + 0 /* offsetof(hidl_vec<T>, mBuffer) */, childBlob);
+        }
+        {
+            int _hidl_vec_size = colors.length;
+            _hidl_blob.putInt32(_hidl_offset + 24 + 8 /* offsetof(hidl_vec<T>, mSize) */, _hidl_vec_size);
+            _hidl_blob.putBool(_hidl_offset + 24 + 12 /* offsetof(hidl_vec<T>, mOwnsBuffer) */, false);
+            android.os.HwBlob childBlob = new android.os.HwBlob((int)(_hidl_vec_size * 4));
+            childBlob.putInt32Array(0 /* offset */, colors);
+            _hidl_blob.putBlob(_hidl_offset + 24 + 0 /* offsetof(hidl_vec<T>, mBuffer) */, childBlob);
+        }
+        {
+            int _hidl_vec_size = labels.size();
+            _hidl_blob.putInt32(_hidl_offset + 40 + 8 /* offsetof(hidl_vec<T>, mSize) */, _hidl_vec_size);
+            _hidl_blob.putBool(_hidl_offset + 40 + 12 /* offsetof(hidl_vec<T>, mOwnsBuffer) */, false);
+            android.os.HwBlob childBlob = new android.os.HwBlob((int)(_hidl_vec_size * 16));
+            for (int _hidl_index_0 = 0; _hidl_index_0 < _hidl_vec_size; ++_hidl_index_0) {
+                childBlob.putString(_hidl_index_0 * 16, labels.get(_hidl_index_0));
+            }
+            _hidl_blob.putBlob(_hidl_offset + 40 + 0 /* offsetof(hidl_vec<T>, mBuffer) */, childBlob);
+        }
+    }
+};
+
@@ -0,0 +1,154 @@
+package golden.V1_0;
+
+
+public final class Scene {
+    public java.util.ArrayList<golden.V1_0.Shape> shapes = new java.util.ArrayList<golden.V1_0.Shape>();
+    public java.util.ArrayList<Integer> ids = new java.util.ArrayList<Integer>();
+
+    @Override
+    public final boolean equals(Object otherObject) {
+        if (this == otherObject) {
+            return true;
+        }
+        if (otherObject == null) {
+            return false;
+        }
+        if (otherObject.getClass() != golden.V1_0.Scene.class) {
+            return false;
+        }
+        golden.V1_0.Scene other = (golden.V1_0.Scene)otherObject;
+        if (!android.os.HidlSupport.deepEquals(this.shapes, other.shapes)) {
+            return false;
+        }
+        if (!android.os.HidlSupport.deepEquals(this.ids, other.ids)) {
+            return false;
+        }
+        return true;
+    }
+
+    @Override
+    public final int hashCode() {
+        return java.util.Objects.hash(
+                android.os.HidlSupport.deepHashCode(this.shapes), 
+                android.os.HidlSupport.deepHashCode(this.ids));
+    }
+
+    @Override
+    public final String toString() {
+        java.lang.StringBuilder builder = new java.lang.StringBuilder();
+        builder.append("{");
+        builder.append(".shapes = ");
+        builder.append(this.shapes);
+        builder.append(", .ids = ");
+        builder.append(this.ids);
+        builder.append("}");
+        return builder.toString();
+    }
+
+    public final void readFromParcel(android.os.HwParcel parcel) {
+        android.os.HwBlob blob = parcel.readBuffer(32 /* size */);
+        readEmbeddedFromParcel(parcel, blob, 0 /* parentOffset */);
+    }
+
+    public static final java.util.ArrayList<Scene> readVectorFromParcel(android.os.HwParcel parcel) {
+        java.util.ArrayList<Scene> _hidl_vec = new java.util.ArrayList();
+        android.os.HwBlob _hidl_blob = parcel.readBuffer(16 /* sizeof hidl_vec<T> */);
+
+        {
+            int _hidl_vec_size = _hidl_blob.getInt32(0 + 8 /* offsetof(hidl_vec<T>, mSize) */);
+            android.os.HwBlob childBlob = parcel.readEmbeddedBuffer(
+                    _hidl_vec_size * 32,_hidl_blob.handle(),
+                    0 + 0 /* offsetof(hidl_vec<T>, mBuffer) */,true /* nullable */);
+
+            _hidl_vec.clear();
+            for (int _hidl_index_0 = 0; _hidl_index_0 < _hidl_vec_size; ++_hidl_index_0) {
+                golden.V1_0.Scene _hidl_vec_element = new golden.V1_0.Scene();
+                ((golden.V1_0.Scene) _hidl_vec_element).readEmbeddedFromParcel(parcel, childBlob, _hidl_index_0 * 32);
+                _hidl_vec.add(_hidl_vec_element);
+            }
+        }
+
+        return _hidl_vec;
+    }
+
+    public final void readEmbeddedFromParcel(
+            android.os.HwParcel parcel, android.os.HwBlob _hidl_blob, long _hidl_offset) {
+        {
+            int _hidl_vec_size = _hidl_blob.getInt32(_hidl_offset + 0 + 8 /* offsetof(hidl_vec<T>, mSize) */);
+            android.os.HwBlob childBlob = parcel.readEmbeddedBuffer(
+                    _hidl_vec_size * 104,_hidl_blob.handle(),
+                    _hidl_offset + 0 + 0 /* offsetof(hidl_vec<T>, mBuffer) */,true /* nullable */);
+
+            ((java.util.ArrayList<golden.V1_0.Shape>) shapes).clear();
+            for (int _hidl_index_0 = 0; _hidl_index_0 < _hidl_vec_size; ++_hidl_index_0) {
+                golden.V1_0.Shape _hidl_vec_element = new golden.V1_0.Shape();
+                ((golden.V1_0.Shape) _hidl_vec_element).readEmbeddedFromParcel(parcel, childBlob, _hidl_index_0 * 104);
+                ((java.util.ArrayList<golden.V1_0.Shape>) shapes).add(_hidl_vec_element);
+            }
+        }
+        {
+            int _hidl_vec_size = _hidl_blob.getInt32(_hidl_offset + 16 + 8 /* offsetof(hidl_vec<T>, mSize) */);
+            android.os.HwBlob childBlob = parcel.readEmbeddedBuffer(
+                    _hidl_vec_size * 4,_hidl_blob.handle(),
+                    _hidl_offset + 16 + 0 /* offsetof(hidl_vec<T>, mBuffer) */,true /* nullable */);
+
+            ((java.util.ArrayList<Integer>) ids).clear();
+            int[] _hidl_vec_array_0 = new int[_hidl_vec_size];
+            childBlob.copyToInt32Array(0 /* offset */, _hidl_vec_array_0, _hidl_vec_size);
+            ((java.util.ArrayList<Integer>) ids).ensureCapacity(_hidl_vec_size);
+            for (int _hidl_vec_element : _hidl_vec_array_0) {
+                ((java.util.ArrayList<Integer>) ids).add(_hidl_vec_element);
+            }
+        }
+    }
+
+    public final void writeToParcel(android.os.HwParcel parcel) {
+        android.os.HwBlob _hidl_blob = new android.os.HwBlob(32 /* size */);
+        writeEmbeddedToBlob(_hidl_blob, 0 /* parentOffset */);
+        parcel.writeBuffer(_hidl_blob);
+    }
+
+    public static final void writeVectorToParcel(
+            android.os.HwParcel parcel, java.util.ArrayList<Scene> _hidl_vec) {
+        android.os.HwBlob _hidl_blob = new android.os.HwBlob(16 /* sizeof(hidl_vec<T>) */);
+        {
+            int _hidl_vec_size = _hidl_vec.size();
+            _hidl_blob.putInt32(0 + 8 /* offsetof(hidl_vec<T>, mSize) */, _hidl_vec_size);
+            _hidl_blob.putBool(0 + 12 /* offsetof(hidl_vec<T>, mOwnsBuffer) */, false);
+            android.os.HwBlob childBlob = new android.os.HwBlob((int)(_hidl_vec_size * 32));
+            for (int _hidl_index_0 = 0; _hidl_index_0 < _hidl_vec_size; ++_hidl_index_0) {
+                _hidl_vec.get(_hidl_index_0).writeEmbeddedToBlob(childBlob, _hidl_index_0 * 32);
+            }
+            _hidl_blob.putBlob(0 + 0 /* offsetof(hidl_vec<T>, mBuffer) */, childBlob);
+        }
+
+        parcel.writeBuffer(_hidl_blob);
+    }
+
+    public final void writeEmbeddedToBlob(
+            android.os.HwBlob _hidl_blob, long _hidl_offset) {
+        {
+            int _hidl_vec_size = shapes.size();
+            _hidl_blob.putInt32(_hidl_offset + 0 + 8 /* offsetof(hidl_vec<T>, mSize) */, _hidl_vec_size);
+            _hidl_blob.putBool(_hidl_offset + 0 + 12 /* offsetof(hidl_vec<T>, mOwnsBuffer) */, false);
+            android.os.HwBlob childBlob = new android.os.HwBlob((int)(_hidl_vec_size * 104));
+            for (int _hidl_index_0 = 0; _hidl_index_0 < _hidl_vec_size; ++_hidl_index_0) {
+                shapes.get(_hidl_index_0).writeEmbeddedToBlob(childBlob, _hidl_index_0 * 104);
+            }
+            _hidl_blob.putBlob(_hidl_offset + 0 + 0 /* offsetof(hidl_vec<T>, mBuffer) */, childBlob);
+        }
+        {
+            int _hidl_vec_size = ids.size();
+            _hidl_blob.putInt32(_hidl_offset + 16 + 8 /* offsetof(hidl_vec<T>, mSize) */, _hidl_vec_size);
+            _hidl_blob.putBool(_hidl_offset + 16 + 12 /* offsetof(hidl_vec<T>, mOwnsBuffer) */, false);
+            android.os.HwBlob childBlob = new android.os.HwBlob((int)(_hidl_vec_size * 4));
+            int[] _hidl_vec_array_0 = new int[_hidl_vec_size];
+            for (int _hidl_index_0 = 0; _hidl_index_0 < _hidl_vec_size; ++_hidl_index_0) {
+                _hidl_vec_array_0[_hidl_index_0] = ids.get(_hidl_index_0);
+            }
+            childBlob.putInt32Array(0 /* offset */, _hidl_vec_array_0);
+            _hidl_blob.putBlob(_hidl_offset + 16 + 0 /* offsetof(hidl_vec<T>, mBuffer) */, childBlob);
+        }
+    }
+};
+
@@ -0,0 +1,360 @@
+package golden.V1_0;
+
+
+public final class Shape {
+    public final static class Nested {
+        public byte a;
+        public long b;
+
+        @Override
+        public final boolean equals(Object otherObject) {
+            if (this == otherObject) {
+                return true;
+            }
+            if (otherObject == null) {
+                return false;
+            }
+            if (otherObject.getClass() != golden.V1_0.Shape.Nested.class) {
+                return false;
+            }
+            golden.V1_0.Shape.Nested other = (golden.V1_0.Shape.Nested)otherObject;
+            if (this.a != other.a) {
+                return false;
+            }
+            if (this.b != other.b) {
+                return false;
+            }
+            return true;
+        }
+
+        @Override
+        public final int hashCode() {
+            return java.util.Objects.hash(
+                    android.os.HidlSupport.deepHashCode(this.a), 
+                    android.os.HidlSupport.deepHashCode(this.b));
+        }
+
+        @Override
+        public final String toString() {
+            java.lang.StringBuilder builder = new java.lang.StringBuilder();
+            builder.append("{");
+            builder.append(".a = ");
+            builder.append(this.a);
+            builder.append(", .b = ");
+            builder.append(this.b);
+            builder.append("}");
+            return builder.toString();
+        }
+
+        public final void readFromParcel(android.os.HwParcel parcel) {
+            android.os.HwBlob blob = parcel.readBuffer(16 /* size */);
+            readEmbeddedFromParcel(parcel, blob, 0 /* parentOffset */);
+        }
+
+        public static final java.util.ArrayList<Nested> readVectorFromParcel(android.os.HwParcel parcel) {
+            java.util.ArrayList<Nested> _hidl_vec = new java.util.ArrayList();
+            android.os.HwBlob _hidl_blob = parcel.readBuffer(16 /* sizeof hidl_vec<T> */);
+
+            {
+                int _hidl_vec_size = _hidl_blob.getInt32(0 + 8 /* offsetof(hidl_vec<T>, mSize) */);
+                android.os.HwBlob childBlob = parcel.readEmbeddedBuffer(
+                        _hidl_vec_size * 16,_hidl_blob.handle(),
+                        0 + 0 /* offsetof(hidl_vec<T>, mBuffer) */,true /* nullable */);
+
+                _hidl_vec.clear();
+                for (int _hidl_index_0 = 0; _hidl_index_0 < _hidl_vec_size; ++_hidl_index_0) {
+                    golden.V1_0.Shape.Nested _hidl_vec_element = new golden.V1_0.Shape.Nested();
+                    ((golden.V1_0.Shape.Nested) _hidl_vec_element).readEmbeddedFromParcel(parcel, childBlob, _hidl_index_0 * 16);
+                    _hidl_vec.add(_hidl_vec_element);
+                }
+            }
+
+            return _hidl_vec;
+        }
+
+        public final void readEmbeddedFromParcel(
+                android.os.HwParcel parcel, android.os.HwBlob _hidl_blob, long _hidl_offset) {
+            a = _hidl_blob.getInt8(_hidl_offset + 0);
+            b = _hidl_blob.getInt64(_hidl_offset + 8);
+        }
+
+        public final void writeToParcel(android.os.HwParcel parcel) {
+            android.os.HwBlob _hidl_blob = new android.os.HwBlob(16 /* size */);
+            writeEmbeddedToBlob(_hidl_blob, 0 /* parentOffset */);
+            parcel.writeBuffer(_hidl_blob);
+        }
+
+        public static final void writeVectorToParcel(
+                android.os.HwParcel parcel, java.util.ArrayList<Nested> _hidl_vec) {
+            android.os.HwBlob _hidl_blob = new android.os.HwBlob(16 /* sizeof(hidl_vec<T>) */);
+            {
+                int _hidl_vec_size = _hidl_vec.size();
+                _hidl_blob.putInt32(0 + 8 /* offsetof(hidl_vec<T>, mSize) */, _hidl_vec_size);
+                _hidl_blob.putBool(0 + 12 /* offsetof(hidl_vec<T>, mOwnsBuffer) */, false);
+                android.os.HwBlob childBlob = new android.os.HwBlob((int)(_hidl_vec_size * 16));
+                for (int _hidl_index_0 = 0; _hidl_index_0 < _hidl_vec_size; ++_hidl_index_0) {
+                    _hidl_vec.get(_hidl_index_0).writeEmbeddedToBlob(childBlob, _hidl_index_0 * 16);
+                }
+                _hidl_blob.putBlob(0 + 0 /* offsetof(hidl_vec<T>, mBuffer) */, childBlob);
+            }
+
+            parcel.writeBuffer(_hidl_blob);
+        }
+
+        public final void writeEmbeddedToBlob(
+                android.os.HwBlob _hidl_blob, long _hidl_offset) {
+            _hidl_blob.putInt8(_hidl_offset + 0, a);
+            _hidl_blob.putInt64(_hidl_offset + 8, b);
+        }
+    };
+
+    public String name = new String();
+    public int color;
+    public byte flags;
+    public golden.V1_0.Point[/* 2 */] corners = new golden.V1_0.Point[2];
+    public java.util.ArrayList<golden.V1_0.Point> points = new java.util.ArrayList<golden.V1_0.Point>();
+    public java.util.ArrayList<Byte> data = new java.util.ArrayList<Byte>();
+    public java.util.ArrayList<String> tags = new java.util.ArrayList<String>();
+    public golden.V1_0.Shape.Nested nested = new golden.V1_0.Shape.Nested();
+
+    @Override
+    public final boolean equals(Object otherObject) {
+        if (this == otherObject) {
+            return true;
+        }
+        if (otherObject == null) {
+            return false;
+        }
+        if (otherObject.getClass() != golden.V1_0.Shape.class) {
+            return false;
+        }
+        golden.V1_0.Shape other = (golden.V1_0.Shape)otherObject;
+        if (!android.os.HidlSupport.deepEquals(this.name, other.name)) {
+            return false;
+        }
+        if (this.color != other.color) {
+            return false;
+        }
+        if (!android.os.HidlSupport.deepEquals(this.flags, other.flags)) {
+            return false;
+        }
+        if (!android.os.HidlSupport.deepEquals(this.corners, other.corners)) {
+            return false;
+        }
+        if (!android.os.HidlSupport.deepEquals(this.points, other.points)) {
+            return false;
+        }
+        if (!android.os.HidlSupport.deepEquals(this.data, other.data)) {
+            return false;
+        }
+        if (!android.os.HidlSupport.deepEquals(this.tags, other.tags)) {
+            return false;
+        }
+        if (!android.os.HidlSupport.deepEquals(this.nested, other.nested)) {
+            return false;
+        }
+        return true;
+    }
+
+    @Override
+    public final int hashCode() {
+        return java.util.Objects.hash(
+                android.os.HidlSupport.deepHashCode(this.name), 
+                android.os.HidlSupport.deepHashCode(this.color), 
+                android.os.HidlSupport.deepHashCode(this.flags), 
+                android.os.HidlSupport.deepHashCode(this.corners), 
+                android.os.HidlSupport.deepHashCode(this.points), 
+                android.os.HidlSupport.deepHashCode(this.data), 
+                android.os.HidlSupport.deepHashCode(this.tags), 
+                android.os.HidlSupport.deepHashCode(this.nested));
+    }
+
+    @Override
+    public final String toString() {
+        java.lang.StringBuilder builder = new java.lang.StringBuilder();
+        builder.append("{");
+        builder.append(".name = ");
+        builder.append(this.name);
+        builder.append(", .color = ");
+        builder.append(golden.V1_0.Color.toString(this.color));
+        builder.append(", .flags = ");
+        builder.append(golden.V1_0.Flag.dumpBitfield(this.flags));
+        builder.append(", .corners = ");
+        builder.append(java.util.Arrays.toString(this.corners));
+        builder.append(", .points = ");
+        builder.append(this.points);
+        builder.append(", .data = ");
+        builder.append(this.data);
+        builder.append(", .tags = ");
+        builder.append(this.tags);
+        builder.append(", .nested = ");
+        builder.append(this.nested);
+        builder.append("}");
+        return builder.toString();
+    }
+
+    public final void readFromParcel(android.os.HwParcel parcel) {
+        android.os.HwBlob blob = parcel.readBuffer(104 /* size */);
+        readEmbeddedFromParcel(parcel, blob, 0 /* parentOffset */);
+    }
+
+    public static final java.util.ArrayList<Shape> readVectorFromParcel(android.os.HwParcel parcel) {
+        java.util.ArrayList<Shape> _hidl_vec = new java.util.ArrayList();
+        android.os.HwBlob _hidl_blob = parcel.readBuffer(16 /* sizeof hidl_vec<T> */);
+
+        {
+            int _hidl_vec_size = _hidl_blob.getInt32(0 + 8 /* offsetof(hidl_vec<T>, mSize) */);
+            android.os.HwBlob childBlob = parcel.readEmbeddedBuffer(
+                    _hidl_vec_size * 104,_hidl_blob.handle(),
+                    0 + 0 /* offsetof(hidl_vec<T>, mBuffer) */,true /* nullable */);
+
+            _hidl_vec.clear();
+            for (int _hidl_index_0 = 0; _hidl_index_0 < _hidl_vec_size; ++_hidl_index_0) {
+                golden.V1_0.Shape _hidl_vec_element = new golden.V1_0.Shape();
+                ((golden.V1_0.Shape) _hidl_vec_element).readEmbeddedFromParcel(parcel, childBlob, _hidl_index_0 * 104);
+                _hidl_vec.add(_hidl_vec_element);
+            }
+        }
+
+        return _hidl_vec;
+    }
+
+    public final void readEmbeddedFromParcel(
+            android.os.HwParcel parcel, android.os.HwBlob _hidl_blob, long _hidl_offset) {
+        name = _hidl_blob.getString(_hidl_offset + 0);
+
+        parcel.readEmbeddedBuffer(
+                ((String) name).getBytes().length + 1,
+                _hidl_blob.handle(),
+                _hidl_offset + 0 + 0 /* offsetof(hidl_string, mBuffer) */,false /* nullable */);
+
+        color = _hidl_blob.getInt32(_hidl_offset + 16);
+        flags = _hidl_blob.getInt8(_hidl_offset + 20);
+        {
+            long _hidl_array_offset_0 = _hidl_offset + 24;
+            for (int _hidl_index_0_0 = 0; _hidl_index_0_0 < 2; ++_hidl_index_0_0) {
+                ((golden.V1_0.Point[/* 2 */]) corners)[_hidl_index_0_0] = new golden.V1_0.Point();
+                ((golden.V1_0.Point) ((golden.V1_0.Point[/* 2 */]) corners)[_hidl_index_0_0]).readEmbeddedFromParcel(parcel, _hidl_blob, _hidl_array_offset_0);
+                _hidl_array_offset_0 += 8;
+            }
+        }
+        {
+            int _hidl_vec_size = _hidl_blob.getInt32(_hidl_offset + 40 + 8 /* offsetof(hidl_vec<T>, mSize) */);
+            android.os.HwBlob childBlob = parcel.readEmbeddedBuffer(
+                    _hidl_vec_size * 8,_hidl_blob.handle(),
+                    _hidl_offset + 40 + 0 /* offsetof(hidl_vec<T>, mBuffer) */,true /* nullable */);
+
+            ((java.util.ArrayList<golden.V1_0.Point>) points).clear();
+            for (int _hidl_index_0 = 0; _hidl_index_0 < _hidl_vec_size; ++_hidl_index_0) {
+                golden.V1_0.Point _hidl_vec_element = new golden.V1_0.Point();
+                ((golden.V1_0.Point) _hidl_vec_element).readEmbeddedFromParcel(parcel, childBlob, _hidl_index_0 * 8);
+                ((java.util.ArrayList<golden.V1_0.Point>) points).add(_hidl_vec_element);
+            }
+        }
+        {
+            int _hidl_vec_size = _hidl_blob.getInt32(_hidl_offset + 56 + 8 /* offsetof(hidl_vec<T>, mSize) */);
+            android.os.HwBlob childBlob = parcel.readEmbeddedBuffer(
+                    _hidl_vec_size * 1,_hidl_blob.handle(),
+                    _hidl_offset + 56 + 0 /* offsetof(hidl_vec<T>, mBuffer) */,true /* nullable */);
+
+            ((java.util.ArrayList<Byte>) data).clear();
+            byte[] _hidl_vec_array_0 = new byte[_hidl_vec_size];
+            childBlob.copyToInt8Array(0 /* offset */, _hidl_vec_array_0, _hidl_vec_size);
+            ((java.util.ArrayList<Byte>) data).ensureCapacity(_hidl_vec_size);
+            for (byte _hidl_vec_element : _hidl_vec_array_0) {
+                ((java.util.ArrayList<Byte>) data).add(_hidl_vec_element);
+            }
+        }
+        {
+            int _hidl_vec_size = _hidl_blob.getInt32(_hidl_offset + 72 + 8 /* offsetof(hidl_vec<T>, mSize) */);
+            android.os.HwBlob childBlob = parcel.readEmbeddedBuffer(
+                    _hidl_vec_size * 16,_hidl_blob.handle(),
+                    _hidl_offset + 72 + 0 /* offsetof(hidl_vec<T>, mBuffer) */,true /* nullable */);
+
+            ((java.util.ArrayList<String>) tags).clear();
+            for (int _hidl_index_0 = 0; _hidl_index_0 < _hidl_vec_size; ++_hidl_index_0) {
+                String _hidl_vec_element;
+                _hidl_vec_element = childBlob.getString(_hidl_index_0 * 16);
+
+                parcel.readEmbeddedBuffer(
+                        ((String) _hidl_vec_element).getBytes().length + 1,
+                        childBlob.handle(),
+                        _hidl_index_0 * 16 + 0 /* offsetof(hidl_string, mBuffer) */,false /* nullable */);
+
+                ((java.util.ArrayList<String>) tags).add(_hidl_vec_element);
+            }
+        }
+        ((golden.V1_0.Shape.Nested) nested).readEmbeddedFromParcel(parcel, _hidl_blob, _hidl_offset + 88);
+    }
+
+    public final void writeToParcel(android.os.HwParcel parcel) {
+        android.os.HwBlob _hidl_blob = new android.os.HwBlob(104 /* size */);
+        writeEmbeddedToBlob(_hidl_blob, 0 /* parentOffset */);
+        parcel.writeBuffer(_hidl_blob);
+    }
+
+    public static final void writeVectorToParcel(
+            android.os.HwParcel parcel, java.util.ArrayList<Shape> _hidl_vec) {
+        android.os.HwBlob _hidl_blob = new android.os.HwBlob(16 /* sizeof(hidl_vec<T>) */);
+        {
+            int _hidl_vec_size = _hidl_vec.size();
+            _hidl_blob.putInt32(0 + 8 /* offsetof(hidl_vec<T>, mSize) */, _hidl_vec_size);
+            _hidl_blob.putBool(0 + 12 /* offsetof(hidl_vec<T>, mOwnsBuffer) */, false);
+            android.os.HwBlob childBlob = new android.os.HwBlob((int)(_hidl_vec_size * 104));
+            for (int _hidl_index_0 = 0; _hidl_index_0 < _hidl_vec_size; ++_hidl_index_0) {
+                _hidl_vec.get(_hidl_index_0).writeEmbeddedToBlob(childBlob, _hidl_index_0 * 104);
+            }
+            _hidl_blob.putBlob(0 + 0 /* offsetof(hidl_vec<T>, mBuffer) */, childBlob);
+        }
+
+        parcel.writeBuffer(_hidl_blob);
+    }
+
+    public final void writeEmbeddedToBlob(
+            android.os.HwBlob _hidl_blob, long _hidl_offset) {
+        _hidl_blob.putString(_hidl_offset + 0, name);
+        _hidl_blob.putInt32(_hidl_offset + 16, color);
+        _hidl_blob.putInt8(_hidl_offset + 20, flags);
+        {
+            long _hidl_array_offset_0 = _hidl_offset + 24;
+            for (int _hidl_index_0_0 = 0; _hidl_index_0_0 < 2; ++_hidl_index_0_0) {
+                ((golden.V1_0.Point[/* 2 */]) corners)[_hidl_index_0_0].writeEmbeddedToBlob(_hidl_blob, _hidl_array_offset_0);
+                _hidl_array_offset_0 += 8;
+            }
+        }
+        {
+            int _hidl_vec_size = points.size();
+            _hidl_blob.putInt32(_hidl_offset + 40 + 8 /* offsetof(hidl_vec<T>, mSize) */, _hidl_vec_size);
+            _hidl_blob.putBool(_hidl_offset + 40 + 12 /* offsetof(hidl_vec<T>, mOwnsBuffer) */, false);
+            android.os.HwBlob childBlob = new android.os.HwBlob((int)(_hidl_vec_size * 8));
+            for (int _hidl_index_0 = 0; _hidl_index_0 < _hidl_vec_size; ++_hidl_index_0) {
+                points.get(_hidl_index_0).writeEmbeddedToBlob(childBlob, _hidl_index_0 * 8);
+            }
+            _hidl_blob.putBlob(_hidl_offset + 40 + 0 /* offsetof(hidl_vec<T>, mBuffer) */, childBlob);
+        }
+        {
+            int _hidl_vec_size = data.size();
+            _hidl_blob.putInt32(_hidl_offset + 56 + 8 /* offsetof(hidl_vec<T>, mSize) */, _hidl_vec_size);
+            _hidl_blob.putBool(_hidl_offset + 56 + 12 /* offsetof(hidl_vec<T>, mOwnsBuffer) */, false);
+            android.os.HwBlob childBlob = new android.os.HwBlob((int)(_hidl_vec_size * 1));
+            byte[] _hidl_vec_array_0 = new byte[_hidl_vec_size];
+            for (int _hidl_index_0 = 0; _hidl_index_0 < _hidl_vec_size; ++_hidl_index_0) {
+                _hidl_vec_array_0[_hidl_index_0] = data.get(_hidl_index_0);
+            }
+            childBlob.putInt8Array(0 /* offset */, _hidl_vec_array_0);
+            _hidl_blob.putBlob(_hidl_offset + 56 + 0 /* offsetof(hidl_vec<T>, mBuffer) */, childBlob);
+        }
+        {
+            int _hidl_vec_size = tags.size();
+            _hidl_blob.putInt32(_hidl_offset + 72 + 8 /* offsetof(hidl_vec<T>, mSize) */, _hidl_vec_size);
+            _hidl_blob.putBool(_hidl_offset + 72 + 12 /* offsetof(hidl_vec<T>, mOwnsBuffer) */, false);
+            android.os.HwBlob childBlob = new android.os.HwBlob((int)(_hidl_vec_size * 16));
+            for (int _hidl_index_0 = 0; _hidl_index_0 < _hidl_vec_size; ++_hidl_index_0) {
+                childBlob.putString(_hidl_index_0 * 16, tags.get(_hidl_index_0));
+            }
+            _hidl_blob.putBlob(_hidl_offset + 72 + 0 /* offsetof(hidl_vec<T>, mBuffer) */, childBlob);
+        }
+        nested.writeEmbeddedToBlob(_hidl_blob, _hidl_offset + 88);
+    }
+};
+
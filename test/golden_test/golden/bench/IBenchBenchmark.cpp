@@ -0,0 +1,579 @@
+// This file is autogenerated by hidl-gen -Lbenchmark.
+// Measures marshalling the arguments and results of the methods of
+// golden.bench@1.0::IBench the way its proxy and stub do, without transacting.
+
+#include <golden/bench/1.0/IHwBench.h>
+
+#include <benchmark/benchmark.h>
+#include <hidl/HidlBinderSupport.h>
+#include <hwbinder/Parcel.h>
+
+#include <string>
+#include <utility>
+
+// The sizes of the vectors and of the strings in the values of the
+// arguments and results. Every benchmark runs with each combination.
+#ifndef HIDL_BENCHMARK_VECTOR_SIZES
+#define HIDL_BENCHMARK_VECTOR_SIZES 1, 16, 256
+#endif
+#ifndef HIDL_BENCHMARK_STRING_SIZES
+#define HIDL_BENCHMARK_STRING_SIZES 16, 256
+#endif
+
+namespace golden {
+namespace bench {
+namespace V1_0 {
+
+static void _hidl_sizes(::benchmark::internal::Benchmark* b) {
+    for (int64_t vectorSize : {HIDL_BENCHMARK_VECTOR_SIZES}) {
+        for (int64_t stringSize : {HIDL_BENCHMARK_STRING_SIZES}) {
+            b->Args({vectorSize, stringSize});
+        }
+    }
+}
+
+template <typename T>
+static void _hidl_fill(T* o, size_t vectorSize, size_t stringSize);
+static void _hidl_fill(::android::hardware::hidl_string* o, size_t vectorSize, size_t stringSize);
+template <typename T>
+static void _hidl_fill(::android::hardware::hidl_vec<T>* o, size_t vectorSize, size_t stringSize);
+template <typename T, size_t SIZE1, size_t... SIZES>
+static void _hidl_fill(::android::hardware::hidl_array<T, SIZE1, SIZES...>* o, size_t vectorSize, size_t stringSize);
+static void _hidl_fill(::golden::V1_0::Shape* o, size_t vectorSize, size_t stringSize);
+static void _hidl_fill(::golden::bench::V1_0::IBench::Value* o, size_t vectorSize, size_t stringSize);
+
+// Scalars, enums, interfaces and handles keep their default values.
+template <typename T>
+static void _hidl_fill(T* /* o */, size_t /* vectorSize */, size_t /* stringSize */) {}
+
+static void _hidl_fill(::android::hardware::hidl_string* o, size_t /* vectorSize */, size_t stringSize) {
+    *o = std::string(stringSize, 'x');
+}
+
+template <typename T>
+static void _hidl_fill(::android::hardware::hidl_vec<T>* o, size_t vectorSize, size_t stringSize) {
+    o->resize(vectorSize);
+    for (size_t i = 0; i < vectorSize; ++i) {
+        _hidl_fill(&(*o)[i], vectorSize, stringSize);
+    }
+}
+
+template <typename T, size_t SIZE1, size_t... SIZES>
+static void _hidl_fill(::android::hardware::hidl_array<T, SIZE1, SIZES...>* o, size_t vectorSize, size_t stringSize) {
+    for (size_t i = 0; i < sizeof(*o) / sizeof(T); ++i) {
+        _hidl_fill(&o->data()[i], vectorSize, stringSize);
+    }
+}
+
+static void _hidl_fill(::golden::V1_0::Shape* o, size_t vectorSize, size_t stringSize) {
+    _hidl_fill(&o->name, vectorSize, stringSize);
+    _hidl_fill(&o->color, vectorSize, stringSize);
+    _hidl_fill(&o->flags, vectorSize, stringSize);
+    _hidl_fill(&o->corners, vectorSize, stringSize);
+    _hidl_fill(&o->points, vectorSize, stringSize);
+    _hidl_fill(&o->data, vectorSize, stringSize);
+    _hidl_fill(&o->tags, vectorSize, stringSize);
+    _hidl_fill(&o->nested, vectorSize, stringSize);
+}
+
+static void _hidl_fill(::golden::bench::V1_0::IBench::Value* o, size_t vectorSize, size_t stringSize) {
+    ::android::hardware::hidl_string value{};
+    _hidl_fill(&value, vectorSize, stringSize);
+    o->text(std::move(value));
+}
+
+static ::android::status_t _hidl_writeArgs_submit(::android::hardware::Parcel& _hidl_data, const ::android::hardware::hidl_string& name, const ::android::hardware::hidl_vec<int32_t>& values, const ::android::hardware::hidl_vec<::android::hardware::hidl_string>& tags) {
+    ::android::status_t _hidl_err = _hidl_data.writeInterfaceToken(::golden::bench::V1_0::IBench::descriptor);
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_name_parent;
+
+    _hidl_err = _hidl_data.writeBuffer(&name, sizeof(name), &_hidl_name_parent);
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+            name,
+            &_hidl_data,
+            _hidl_name_parent,
+            0 /* parentOffset */);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_values_parent;
+
+    _hidl_err = _hidl_data.writeBuffer(&values, sizeof(values), &_hidl_values_parent);
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_values_child;
+
+    _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+            values,
+            &_hidl_data,
+            _hidl_values_parent,
+            0 /* parentOffset */, &_hidl_values_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_tags_parent;
+
+    _hidl_err = _hidl_data.writeBuffer(&tags, sizeof(tags), &_hidl_tags_parent);
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_tags_child;
+
+    _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+            tags,
+            &_hidl_data,
+            _hidl_tags_parent,
+            0 /* parentOffset */, &_hidl_tags_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < tags.size(); ++_hidl_index_0) {
+        _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+                tags[_hidl_index_0],
+                &_hidl_data,
+                _hidl_tags_child,
+                _hidl_index_0 * sizeof(::android::hardware::hidl_string));
+
+        if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    }
+
+    return _hidl_err;
+}
+
+static ::android::status_t _hidl_readArgs_submit(const ::android::hardware::Parcel& _hidl_data) {
+    if (!_hidl_data.enforceInterface(::golden::bench::V1_0::IBench::descriptor)) {
+        return ::android::BAD_TYPE;
+    }
+
+    ::android::status_t _hidl_err = ::android::OK;
+    const ::android::hardware::hidl_string* name;
+    const ::android::hardware::hidl_vec<int32_t>* values;
+    const ::android::hardware::hidl_vec<::android::hardware::hidl_string>* tags;
+
+    size_t _hidl_name_parent;
+
+    _hidl_err = _hidl_data.readBuffer(sizeof(*name), &_hidl_name_parent,  reinterpret_cast<const void **>(&name));
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+            const_cast<::android::hardware::hidl_string &>(*name),
+            _hidl_data,
+            _hidl_name_parent,
+            0 /* parentOffset */);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_values_parent;
+
+    _hidl_err = _hidl_data.readBuffer(sizeof(*values), &_hidl_values_parent,  reinterpret_cast<const void **>(&values));
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_values_child;
+
+    _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+            const_cast<::android::hardware::hidl_vec<int32_t> &>(*values),
+            _hidl_data,
+            _hidl_values_parent,
+            0 /* parentOffset */, &_hidl_values_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_tags_parent;
+
+    _hidl_err = _hidl_data.readBuffer(sizeof(*tags), &_hidl_tags_parent,  reinterpret_cast<const void **>(&tags));
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_tags_child;
+
+    _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+            const_cast<::android::hardware::hidl_vec<::android::hardware::hidl_string> &>(*tags),
+            _hidl_data,
+            _hidl_tags_parent,
+            0 /* parentOffset */, &_hidl_tags_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < tags->size(); ++_hidl_index_0) {
+        _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+                const_cast<::android::hardware::hidl_string &>((*tags)[_hidl_index_0]),
+                _hidl_data,
+                _hidl_tags_child,
+                _hidl_index_0 * sizeof(::android::hardware::hidl_string));
+
+        if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    }
+
+    ::benchmark::DoNotOptimize(name);
+    ::benchmark::DoNotOptimize(values);
+    ::benchmark::DoNotOptimize(tags);
+    return _hidl_err;
+}
+
+static ::android::status_t _hidl_writeResults_submit(::android::hardware::Parcel* _hidl_reply, const ::android::hardware::hidl_vec<::golden::V1_0::Shape>& shapes, const ::android::hardware::hidl_string& status) {
+    ::android::status_t _hidl_err = ::android::hardware::writeToParcel(::android::hardware::Status::ok(), _hidl_reply);
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_shapes_parent;
+
+    _hidl_err = _hidl_reply->writeBuffer(&shapes, sizeof(shapes), &_hidl_shapes_parent);
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_shapes_child;
+
+    _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+            shapes,
+            _hidl_reply,
+            _hidl_shapes_parent,
+            0 /* parentOffset */, &_hidl_shapes_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < shapes.size(); ++_hidl_index_0) {
+        _hidl_err = writeEmbeddedToParcel(
+                shapes[_hidl_index_0],
+                _hidl_reply,
+                _hidl_shapes_child,
+                _hidl_index_0 * sizeof(::golden::V1_0::Shape));
+
+        if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    }
+
+    size_t _hidl_status_parent;
+
+    _hidl_err = _hidl_reply->writeBuffer(&status, sizeof(status), &_hidl_status_parent);
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+            status,
+            _hidl_reply,
+            _hidl_status_parent,
+            0 /* parentOffset */);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    return _hidl_err;
+}
+
+static ::android::status_t _hidl_readResults_submit(const ::android::hardware::Parcel& _hidl_reply) {
+    ::android::hardware::Status _hidl_status;
+    ::android::status_t _hidl_err = ::android::hardware::readFromParcel(&_hidl_status, _hidl_reply);
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    const ::android::hardware::hidl_vec<::golden::V1_0::Shape>* _hidl_out_shapes;
+    const ::android::hardware::hidl_string* _hidl_out_status;
+
+    size_t _hidl__hidl_out_shapes_parent;
+
+    _hidl_err = _hidl_reply.readBuffer(sizeof(*_hidl_out_shapes), &_hidl__hidl_out_shapes_parent,  reinterpret_cast<const void **>(&_hidl_out_shapes));
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl__hidl_out_shapes_child;
+
+    _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+            const_cast<::android::hardware::hidl_vec<::golden::V1_0::Shape> &>(*_hidl_out_shapes),
+            _hidl_reply,
+            _hidl__hidl_out_shapes_parent,
+            0 /* parentOffset */, &_hidl__hidl_out_shapes_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < _hidl_out_shapes->size(); ++_hidl_index_0) {
+        _hidl_err = readEmbeddedFromParcel(
+                const_cast<::golden::V1_0::Shape &>((*_hidl_out_shapes)[_hidl_index_0]),
+                _hidl_reply,
+                _hidl__hidl_out_shapes_child,
+                _hidl_index_0 * sizeof(::golden::V1_0::Shape));
+
+        if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    }
+
+    size_t _hidl__hidl_out_status_parent;
+
+    _hidl_err = _hidl_reply.readBuffer(sizeof(*_hidl_out_status), &_hidl__hidl_out_status_parent,  reinterpret_cast<const void **>(&_hidl_out_status));
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+            const_cast<::android::hardware::hidl_string &>(*_hidl_out_status),
+            _hidl_reply,
+            _hidl__hidl_out_status_parent,
+            0 /* parentOffset */);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    ::benchmark::DoNotOptimize(_hidl_out_shapes);
+    ::benchmark::DoNotOptimize(_hidl_out_status);
+    return _hidl_err;
+}
+
+static void BM_submit(::benchmark::State& _hidl_state) {
+    const size_t _hidl_vectorSize = _hidl_state.range(0);
+    const size_t _hidl_stringSize = _hidl_state.range(1);
+
+    ::android::hardware::hidl_string name{};
+    _hidl_fill(&name, _hidl_vectorSize, _hidl_stringSize);
+    ::android::hardware::hidl_vec<int32_t> values{};
+    _hidl_fill(&values, _hidl_vectorSize, _hidl_stringSize);
+    ::android::hardware::hidl_vec<::android::hardware::hidl_string> tags{};
+    _hidl_fill(&tags, _hidl_vectorSize, _hidl_stringSize);
+    ::android::hardware::hidl_vec<::golden::V1_0::Shape> _hidl_out_shapes{};
+    _hidl_fill(&_hidl_out_shapes, _hidl_vectorSize, _hidl_stringSize);
+    ::android::hardware::hidl_string _hidl_out_status{};
+    _hidl_fill(&_hidl_out_status, _hidl_vectorSize, _hidl_stringSize);
+    size_t _hidl_bytes = 0;
+
+    while (_hidl_state.KeepRunning()) {
+        ::android::hardware::Parcel _hidl_data;
+        if (_hidl_writeArgs_submit(_hidl_data, name, values, tags) != ::android::OK) {
+            _hidl_state.SkipWithError("writing the arguments failed");
+            break;
+        }
+        _hidl_data.setDataPosition(0);
+        if (_hidl_readArgs_submit(_hidl_data) != ::android::OK) {
+            _hidl_state.SkipWithError("reading the arguments failed");
+            break;
+        }
+        _hidl_bytes = _hidl_data.ipcDataSize() + _hidl_data.ipcBufferSize();
+
+        ::android::hardware::Parcel _hidl_reply;
+        if (_hidl_writeResults_submit(&_hidl_reply, _hidl_out_shapes, _hidl_out_status) != ::android::OK) {
+            _hidl_state.SkipWithError("writing the results failed");
+            break;
+        }
+        _hidl_reply.setDataPosition(0);
+        if (_hidl_readResults_submit(_hidl_reply) != ::android::OK) {
+            _hidl_state.SkipWithError("reading the results failed");
+            break;
+        }
+        _hidl_bytes += _hidl_reply.ipcDataSize() + _hidl_reply.ipcBufferSize();
+    }
+
+    _hidl_state.counters["bytes/op"] = _hidl_bytes;
+}
+BENCHMARK(BM_submit)->Apply(_hidl_sizes);
+
+static ::android::status_t _hidl_writeArgs_set(::android::hardware::Parcel& _hidl_data, const ::golden::bench::V1_0::IBench::Value& value) {
+    ::android::status_t _hidl_err = _hidl_data.writeInterfaceToken(::golden::bench::V1_0::IBench::descriptor);
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_value_parent;
+
+    _hidl_err = _hidl_data.writeBuffer(&value, sizeof(value), &_hidl_value_parent);
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    _hidl_err = writeEmbeddedToParcel(
+            value,
+            &_hidl_data,
+            _hidl_value_parent,
+            0 /* parentOffset */);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    return _hidl_err;
+}
+
+static ::android::status_t _hidl_readArgs_set(const ::android::hardware::Parcel& _hidl_data) {
+    if (!_hidl_data.enforceInterface(::golden::bench::V1_0::IBench::descriptor)) {
+        return ::android::BAD_TYPE;
+    }
+
+    ::android::status_t _hidl_err = ::android::OK;
+    ::golden::bench::V1_0::IBench::Value* value;
+
+    size_t _hidl_value_parent;
+
+    _hidl_err = _hidl_data.readBuffer(sizeof(*value), &_hidl_value_parent,  const_cast<const void**>(reinterpret_cast<void **>(&value)));
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    _hidl_err = readEmbeddedFromParcel(
+            const_cast<::golden::bench::V1_0::IBench::Value &>(*value),
+            _hidl_data,
+            _hidl_value_parent,
+            0 /* parentOffset */);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    ::benchmark::DoNotOptimize(value);
+    return _hidl_err;
+}
+
+static ::android::status_t _hidl_writeResults_set(::android::hardware::Parcel* _hidl_reply, const ::golden::bench::V1_0::IBench::Value& previous) {
+    ::android::status_t _hidl_err = ::android::hardware::writeToParcel(::android::hardware::Status::ok(), _hidl_reply);
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_previous_parent;
+
+    _hidl_err = _hidl_reply->writeBuffer(&previous, sizeof(previous), &_hidl_previous_parent);
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    _hidl_err = writeEmbeddedToParcel(
+            previous,
+            _hidl_reply,
+            _hidl_previous_parent,
+            0 /* parentOffset */);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    return _hidl_err;
+}
+
+static ::android::status_t _hidl_readResults_set(const ::android::hardware::Parcel& _hidl_reply) {
+    ::android::hardware::Status _hidl_status;
+    ::android::status_t _hidl_err = ::android::hardware::readFromParcel(&_hidl_status, _hidl_reply);
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    ::golden::bench::V1_0::IBench::Value* _hidl_out_previous;
+
+    size_t _hidl__hidl_out_previous_parent;
+
+    _hidl_err = _hidl_reply.readBuffer(sizeof(*_hidl_out_previous), &_hidl__hidl_out_previous_parent,  const_cast<const void**>(reinterpret_cast<void **>(&_hidl_out_previous)));
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    _hidl_err = readEmbeddedFromParcel(
+            const_cast<::golden::bench::V1_0::IBench::Value &>(*_hidl_out_previous),
+            _hidl_reply,
+            _hidl__hidl_out_previous_parent,
+            0 /* parentOffset */);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    ::benchmark::DoNotOptimize(_hidl_out_previous);
+    return _hidl_err;
+}
+
+static void BM_set(::benchmark::State& _hidl_state) {
+    const size_t _hidl_vectorSize = _hidl_state.range(0);
+    const size_t _hidl_stringSize = _hidl_state.range(1);
+
+    ::golden::bench::V1_0::IBench::Value value{};
+    _hidl_fill(&value, _hidl_vectorSize, _hidl_stringSize);
+    ::golden::bench::V1_0::IBench::Value _hidl_out_previous{};
+    _hidl_fill(&_hidl_out_previous, _hidl_vectorSize, _hidl_stringSize);
+    size_t _hidl_bytes = 0;
+
+    while (_hidl_state.KeepRunning()) {
+        ::android::hardware::Parcel _hidl_data;
+        if (_hidl_writeArgs_set(_hidl_data, value) != ::android::OK) {
+            _hidl_state.SkipWithError("writing the arguments failed");
+            break;
+        }
+        _hidl_data.setDataPosition(0);
+        if (_hidl_readArgs_set(_hidl_data) != ::android::OK) {
+            _hidl_state.SkipWithError("reading the arguments failed");
+            break;
+        }
+        _hidl_bytes = _hidl_data.ipcDataSize() + _hidl_data.ipcBufferSize();
+
+        ::android::hardware::Parcel _hidl_reply;
+        if (_hidl_writeResults_set(&_hidl_reply, _hidl_out_previous) != ::android::OK) {
+            _hidl_state.SkipWithError("writing the results failed");
+            break;
+        }
+        _hidl_reply.setDataPosition(0);
+        if (_hidl_readResults_set(_hidl_reply) != ::android::OK) {
+            _hidl_state.SkipWithError("reading the results failed");
+            break;
+        }
+        _hidl_bytes += _hidl_reply.ipcDataSize() + _hidl_reply.ipcBufferSize();
+    }
+
+    _hidl_state.counters["bytes/op"] = _hidl_bytes;
+}
+BENCHMARK(BM_set)->Apply(_hidl_sizes);
+
+static ::android::status_t _hidl_writeArgs_notify(::android::hardware::Parcel& _hidl_data, int32_t event, const ::android::hardware::hidl_string& message) {
+    ::android::status_t _hidl_err = _hidl_data.writeInterfaceToken(::golden::bench::V1_0::IBench::descriptor);
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    _hidl_err = _hidl_data.writeInt32(event);
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_message_parent;
+
+    _hidl_err = _hidl_data.writeBuffer(&message, sizeof(message), &_hidl_message_parent);
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+            message,
+            &_hidl_data,
+            _hidl_message_parent,
+            0 /* parentOffset */);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    return _hidl_err;
+}
+
+static ::android::status_t _hidl_readArgs_notify(const ::android::hardware::Parcel& _hidl_data) {
+    if (!_hidl_data.enforceInterface(::golden::bench::V1_0::IBench::descriptor)) {
+        return ::android::BAD_TYPE;
+    }
+
+    ::android::status_t _hidl_err = ::android::OK;
+    int32_t event;
+    const ::android::hardware::hidl_string* message;
+
+    _hidl_err = _hidl_data.readInt32(&event);
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_message_parent;
+
+    _hidl_err = _hidl_data.readBuffer(sizeof(*message), &_hidl_message_parent,  reinterpret_cast<const void **>(&message));
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+            const_cast<::android::hardware::hidl_string &>(*message),
+            _hidl_data,
+            _hidl_message_parent,
+            0 /* parentOffset */);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    ::benchmark::DoNotOptimize(event);
+    ::benchmark::DoNotOptimize(message);
+    return _hidl_err;
+}
+
+static void BM_notify(::benchmark::State& _hidl_state) {
+    const size_t _hidl_vectorSize = _hidl_state.range(0);
+    const size_t _hidl_stringSize = _hidl_state.range(1);
+
+    int32_t event{};
+    ::android::hardware::hidl_string message{};
+    _hidl_fill(&message, _hidl_vectorSize, _hidl_stringSize);
+    size_t _hidl_bytes = 0;
+
+    while (_hidl_state.KeepRunning()) {
+        ::android::hardware::Parcel _hidl_data;
+        if (_hidl_writeArgs_notify(_hidl_data, event, message) != ::android::OK) {
+            _hidl_state.SkipWithError("writing the arguments failed");
+            break;
+        }
+        _hidl_data.setDataPosition(0);
+        if (_hidl_readArgs_notify(_hidl_data) != ::android::OK) {
+            _hidl_state.SkipWithError("reading the arguments failed");
+            break;
+        }
+        _hidl_bytes = _hidl_data.ipcDataSize() + _hidl_data.ipcBufferSize();
+    }
+
+    _hidl_state.counters["bytes/op"] = _hidl_bytes;
+}
+BENCHMARK(BM_notify)->Apply(_hidl_sizes);
+
+}  // namespace V1_0
+}  // namespace bench
+}  // namespace golden
+
+BENCHMARK_MAIN();
@@ -0,0 +1,560 @@
+#ifndef HIDL_GENERATED_GOLDEN_FWD_V1_0_BSFOO_H
+#define HIDL_GENERATED_GOLDEN_FWD_V1_0_BSFOO_H
+
+#include <android-base/macros.h>
+#include <cutils/trace.h>
+#include <future>
+#include <golden/fwd/1.0/IFoo.h>
+#include <golden/fwd/1.0/IListener.h>
+#include <golden/fwd/1.0/ISource.h>
+
+#include <hidl/HidlPassthroughSupport.h>
+#include <functional>
+#include <memory>
+namespace golden {
+namespace fwd {
+namespace V1_0 {
+
+struct BsFoo : IFoo, ::android::hardware::details::HidlInstrumentor {
+    explicit BsFoo(const ::android::sp<IFoo> impl);
+    ~BsFoo();
+
+    /**
+     * The pure class is what this class wraps.
+     */
+    typedef IFoo Pure;
+
+    typedef android::hardware::details::bs_tag _hidl_tag;
+
+    /**
+     * Number of oneway calls queued and not yet started.
+     */
+    size_t getOnewayQueueDepth() const;
+
+    /**
+     * Number of oneway calls rejected because the queue was full.
+     */
+    uint64_t getOnewayDropCount() const;
+
+    // Methods from ::golden::fwd::V1_0::IParent follow.
+    ::android::hardware::Return<void> reset() override {
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IFoo::reset::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            std::vector<void *> _hidl_args;
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "golden.fwd", "1.0", "IParent", "reset", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        auto _hidl_return = mImpl->reset();
+
+        atrace_end(ATRACE_TAG_HAL);
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            std::vector<void *> _hidl_args;
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_EXIT, "golden.fwd", "1.0", "IParent", "reset", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        if (!_hidl_error.isOk()) return _hidl_error;
+        return _hidl_return;
+    }
+
+    // Methods from ::golden::fwd::V1_0::IFoo follow.
+    ::android::hardware::Return<void> setListener(const ::android::sp<::golden::fwd::V1_0::IListener>& listener) override {
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IFoo::setListener::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            void *_hidl_arg_pointers[] = {(void *)&listener};
+            std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "golden.fwd", "1.0", "IFoo", "setListener", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::sp<::golden::fwd::V1_0::IListener> _hidl_wrapped_listener;
+        if (listener != nullptr && !listener->isRemote()) {
+            _hidl_wrapped_listener = ::android::hardware::details::wrapPassthrough(listener);
+            if (_hidl_wrapped_listener == nullptr) {
+                return ::android::hardware::Status::fromExceptionCode(
+                        ::android::hardware::Status::EX_TRANSACTION_FAILED,
+                        "Cannot wrap passthrough interface.");
+            }
+        } else {
+            _hidl_wrapped_listener = listener;
+        }
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        auto _hidl_return = mImpl->setListener(_hidl_wrapped_listener);
+
+        atrace_end(ATRACE_TAG_HAL);
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            std::vector<void *> _hidl_args;
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_EXIT, "golden.fwd", "1.0", "IFoo", "setListener", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        if (!_hidl_error.isOk()) return _hidl_error;
+        return _hidl_return;
+    }
+    ::android::hardware::Return<::android::sp<::golden::fwd::V1_0::ISource>> getSource() override {
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IFoo::getSource::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            std::vector<void *> _hidl_args;
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "golden.fwd", "1.0", "IFoo", "getSource", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        auto _hidl_return = mImpl->getSource();
+
+        ::android::sp<::golden::fwd::V1_0::ISource> _hidl_out_source = _hidl_return;
+        (void) _hidl_out_source;
+        ::android::sp<::golden::fwd::V1_0::ISource> _hidl_wrapped__hidl_out_source;
+        if (_hidl_out_source != nullptr && !_hidl_out_source->isRemote()) {
+            _hidl_wrapped__hidl_out_source = ::android::hardware::details::wrapPassthrough(_hidl_out_source);
+            if (_hidl_wrapped__hidl_out_source == nullptr) {
+                _hidl_error = ::android::hardware::Status::fromExceptionCode(
+                        ::android::hardware::Status::EX_TRANSACTION_FAILED,
+                        "Cannot wrap passthrough interface.");
+            }
+        } else {
+            _hidl_wrapped__hidl_out_source = _hidl_out_source;
+        }
+
+        _hidl_out_source = _hidl_wrapped__hidl_out_source;
+
+        _hidl_return = _hidl_out_source
+        ;atrace_end(ATRACE_TAG_HAL);
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            void *_hidl_arg_pointers[] = {(void *)&_hidl_out_source};
+            std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_EXIT, "golden.fwd", "1.0", "IFoo", "getSource", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        if (!_hidl_error.isOk()) return _hidl_error;
+        return _hidl_return;
+    }
+    ::android::hardware::Return<void> getEntries(getEntries_cb _hidl_cb) override {
+        if (_hidl_cb == nullptr) {
+            return ::android::hardware::Status::fromExceptionCode(
+                    ::android::hardware::Status::EX_ILLEGAL_ARGUMENT,
+                    "Null synchronous callback passed.");
+        }
+
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IFoo::getEntries::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            std::vector<void *> _hidl_args;
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "golden.fwd", "1.0", "IFoo", "getEntries", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        auto _hidl_return = mImpl->getEntries([&](const auto &_hidl_out_entries) {
+            atrace_end(ATRACE_TAG_HAL);
+            #ifdef __ANDROID_DEBUGGABLE__
+            if (UNLIKELY(mEnableInstrumentation)) {
+                void *_hidl_arg_pointers[] = {(void *)&_hidl_out_entries};
+                std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+                for (const auto &callback: mInstrumentationCallbacks) {
+                    callback(InstrumentationEvent::PASSTHROUGH_EXIT, "golden.fwd", "1.0", "IFoo", "getEntries", &_hidl_args);
+                }
+            }
+            #endif // __ANDROID_DEBUGGABLE__
+
+            _hidl_cb(_hidl_out_entries);
+        });
+
+        if (!_hidl_error.isOk()) return _hidl_error;
+        return _hidl_return;
+    }
+    ::android::hardware::Return<void> apply(const ::golden::fwd::V1_0::IConfig::Setting& setting) override {
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IFoo::apply::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            void *_hidl_arg_pointers[] = {(void *)&setting};
+            std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "golden.fwd", "1.0", "IFoo", "apply", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        auto _hidl_return = mImpl->apply(setting);
+
+        atrace_end(ATRACE_TAG_HAL);
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            std::vector<void *> _hidl_args;
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_EXIT, "golden.fwd", "1.0", "IFoo", "apply", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        if (!_hidl_error.isOk()) return _hidl_error;
+        return _hidl_return;
+    }
+    ::android::hardware::Return<void> link(const ::golden::fwd::V1_0::IFoo::Link& link) override {
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IFoo::link::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            void *_hidl_arg_pointers[] = {(void *)&link};
+            std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "golden.fwd", "1.0", "IFoo", "link", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        auto _hidl_return = mImpl->link(link);
+
+        atrace_end(ATRACE_TAG_HAL);
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            std::vector<void *> _hidl_args;
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_EXIT, "golden.fwd", "1.0", "IFoo", "link", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        if (!_hidl_error.isOk()) return _hidl_error;
+        return _hidl_return;
+    }
+
+    // Methods from ::android::hidl::base::V1_0::IBase follow.
+    ::android::hardware::Return<void> interfaceChain(interfaceChain_cb _hidl_cb) override {
+        if (_hidl_cb == nullptr) {
+            return ::android::hardware::Status::fromExceptionCode(
+                    ::android::hardware::Status::EX_ILLEGAL_ARGUMENT,
+                    "Null synchronous callback passed.");
+        }
+
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IFoo::interfaceChain::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            std::vector<void *> _hidl_args;
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "android.hidl.base", "1.0", "IBase", "interfaceChain", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        auto _hidl_return = mImpl->interfaceChain([&](const auto &_hidl_out_descriptors) {
+            atrace_end(ATRACE_TAG_HAL);
+            #ifdef __ANDROID_DEBUGGABLE__
+            if (UNLIKELY(mEnableInstrumentation)) {
+                void *_hidl_arg_pointers[] = {(void *)&_hidl_out_descriptors};
+                std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+                for (const auto &callback: mInstrumentationCallbacks) {
+                    callback(InstrumentationEvent::PASSTHROUGH_EXIT, "android.hidl.base", "1.0", "IBase", "interfaceChain", &_hidl_args);
+                }
+            }
+            #endif // __ANDROID_DEBUGGABLE__
+
+            _hidl_cb(_hidl_out_descriptors);
+        });
+
+        if (!_hidl_error.isOk()) return _hidl_error;
+        return _hidl_return;
+    }
+    ::android::hardware::Return<void> debug(const ::android::hardware::hidl_handle& fd, const ::android::hardware::hidl_vec<::android::hardware::hidl_string>& options) override {
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IFoo::debug::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            void *_hidl_arg_pointers[] = {(void *)&fd, (void *)&options};
+            std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 2);
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "android.hidl.base", "1.0", "IBase", "debug", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        auto _hidl_return = mImpl->debug(fd, options);
+
+        atrace_end(ATRACE_TAG_HAL);
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            std::vector<void *> _hidl_args;
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_EXIT, "android.hidl.base", "1.0", "IBase", "debug", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        if (!_hidl_error.isOk()) return _hidl_error;
+        return _hidl_return;
+    }
+    ::android::hardware::Return<void> interfaceDescriptor(interfaceDescriptor_cb _hidl_cb) override {
+        if (_hidl_cb == nullptr) {
+            return ::android::hardware::Status::fromExceptionCode(
+                    ::android::hardware::Status::EX_ILLEGAL_ARGUMENT,
+                    "Null synchronous callback passed.");
+        }
+
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IFoo::interfaceDescriptor::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            std::vector<void *> _hidl_args;
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "android.hidl.base", "1.0", "IBase", "interfaceDescriptor", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        auto _hidl_return = mImpl->interfaceDescriptor([&](const auto &_hidl_out_descriptor) {
+            atrace_end(ATRACE_TAG_HAL);
+            #ifdef __ANDROID_DEBUGGABLE__
+            if (UNLIKELY(mEnableInstrumentation)) {
+                void *_hidl_arg_pointers[] = {(void *)&_hidl_out_descriptor};
+                std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+                for (const auto &callback: mInstrumentationCallbacks) {
+                    callback(InstrumentationEvent::PASSTHROUGH_EXIT, "android.hidl.base", "1.0", "IBase", "interfaceDescriptor", &_hidl_args);
+                }
+            }
+            #endif // __ANDROID_DEBUGGABLE__
+
+            _hidl_cb(_hidl_out_descriptor);
+        });
+
+        if (!_hidl_error.isOk()) return _hidl_error;
+        return _hidl_return;
+    }
+    ::android::hardware::Return<void> getHashChain(getHashChain_cb _hidl_cb) override {
+        if (_hidl_cb == nullptr) {
+            return ::android::hardware::Status::fromExceptionCode(
+                    ::android::hardware::Status::EX_ILLEGAL_ARGUMENT,
+                    "Null synchronous callback passed.");
+        }
+
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IFoo::getHashChain::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            std::vector<void *> _hidl_args;
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "android.hidl.base", "1.0", "IBase", "getHashChain", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        auto _hidl_return = mImpl->getHashChain([&](const auto &_hidl_out_hashchain) {
+            atrace_end(ATRACE_TAG_HAL);
+            #ifdef __ANDROID_DEBUGGABLE__
+            if (UNLIKELY(mEnableInstrumentation)) {
+                void *_hidl_arg_pointers[] = {(void *)&_hidl_out_hashchain};
+                std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+                for (const auto &callback: mInstrumentationCallbacks) {
+                    callback(InstrumentationEvent::PASSTHROUGH_EXIT, "android.hidl.base", "1.0", "IBase", "getHashChain", &_hidl_args);
+                }
+            }
+            #endif // __ANDROID_DEBUGGABLE__
+
+            _hidl_cb(_hidl_out_hashchain);
+        });
+
+        if (!_hidl_error.isOk()) return _hidl_error;
+        return _hidl_return;
+    }
+    ::android::hardware::Return<void> setHALInstrumentation() override {
+        configureInstrumentation();
+        return ::android::hardware::Void();
+    }
+
+    ::android::hardware::Return<bool> linkToDeath(const ::android::sp<::android::hardware::hidl_death_recipient>& recipient, uint64_t cookie) override {
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IFoo::linkToDeath::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            void *_hidl_arg_pointers[] = {(void *)&recipient, (void *)&cookie};
+            std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 2);
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "android.hidl.base", "1.0", "IBase", "linkToDeath", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        auto _hidl_return = mImpl->linkToDeath(recipient, cookie);
+
+        bool _hidl_out_success = _hidl_return;
+        (void) _hidl_out_success;
+        atrace_end(ATRACE_TAG_HAL);
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            void *_hidl_arg_pointers[] = {(void *)&_hidl_out_success};
+            std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_EXIT, "android.hidl.base", "1.0", "IBase", "linkToDeath", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        if (!_hidl_error.isOk()) return _hidl_error;
+        return _hidl_return;
+    }
+    ::android::hardware::Return<void> ping() override {
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IFoo::ping::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            std::vector<void *> _hidl_args;
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "android.hidl.base", "1.0", "IBase", "ping", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        auto _hidl_return = mImpl->ping();
+
+        atrace_end(ATRACE_TAG_HAL);
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            std::vector<void *> _hidl_args;
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_EXIT, "android.hidl.base", "1.0", "IBase", "ping", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        if (!_hidl_error.isOk()) return _hidl_error;
+        return _hidl_return;
+    }
+    ::android::hardware::Return<void> getDebugInfo(getDebugInfo_cb _hidl_cb) override {
+        if (_hidl_cb == nullptr) {
+            return ::android::hardware::Status::fromExceptionCode(
+                    ::android::hardware::Status::EX_ILLEGAL_ARGUMENT,
+                    "Null synchronous callback passed.");
+        }
+
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IFoo::getDebugInfo::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            std::vector<void *> _hidl_args;
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "android.hidl.base", "1.0", "IBase", "getDebugInfo", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        auto _hidl_return = mImpl->getDebugInfo([&](const auto &_hidl_out_info) {
+            atrace_end(ATRACE_TAG_HAL);
+            #ifdef __ANDROID_DEBUGGABLE__
+            if (UNLIKELY(mEnableInstrumentation)) {
+                void *_hidl_arg_pointers[] = {(void *)&_hidl_out_info};
+                std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+                for (const auto &callback: mInstrumentationCallbacks) {
+                    callback(InstrumentationEvent::PASSTHROUGH_EXIT, "android.hidl.base", "1.0", "IBase", "getDebugInfo", &_hidl_args);
+                }
+            }
+            #endif // __ANDROID_DEBUGGABLE__
+
+            _hidl_cb(_hidl_out_info);
+        });
+
+        if (!_hidl_error.isOk()) return _hidl_error;
+        return _hidl_return;
+    }
+    ::android::hardware::Return<void> notifySyspropsChanged() override {
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IFoo::notifySyspropsChanged::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            std::vector<void *> _hidl_args;
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "android.hidl.base", "1.0", "IBase", "notifySyspropsChanged", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        auto _hidl_return = addOnewayTask([mImpl = this->mImpl
+        #ifdef __ANDROID_DEBUGGABLE__
+        , mEnableInstrumentation = this->mEnableInstrumentation, mInstrumentationCallbacks = this->mInstrumentationCallbacks
+        #endif // __ANDROID_DEBUGGABLE__
+        ] {
+            mImpl->notifySyspropsChanged();
+
+            atrace_end(ATRACE_TAG_HAL);
+            #ifdef __ANDROID_DEBUGGABLE__
+            if (UNLIKELY(mEnableInstrumentation)) {
+                std::vector<void *> _hidl_args;
+                for (const auto &callback: mInstrumentationCallbacks) {
+                    callback(InstrumentationEvent::PASSTHROUGH_EXIT, "android.hidl.base", "1.0", "IBase", "notifySyspropsChanged", &_hidl_args);
+                }
+            }
+            #endif // __ANDROID_DEBUGGABLE__
+
+        });
+        return _hidl_return;
+    }
+    ::android::hardware::Return<bool> unlinkToDeath(const ::android::sp<::android::hardware::hidl_death_recipient>& recipient) override {
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IFoo::unlinkToDeath::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            void *_hidl_arg_pointers[] = {(void *)&recipient};
+            std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "android.hidl.base", "1.0", "IBase", "unlinkToDeath", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        auto _hidl_return = mImpl->unlinkToDeath(recipient);
+
+        bool _hidl_out_success = _hidl_return;
+        (void) _hidl_out_success;
+        atrace_end(ATRACE_TAG_HAL);
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            void *_hidl_arg_pointers[] = {(void *)&_hidl_out_success};
+            std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_EXIT, "android.hidl.base", "1.0", "IBase", "unlinkToDeath", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        if (!_hidl_error.isOk()) return _hidl_error;
+        return _hidl_return;
+    }
+
+private:
+    const ::android::sp<IFoo> mImpl;
+    struct OnewayQueue;
+    const std::shared_ptr<OnewayQueue> mOnewayQueue;
+
+    ::android::hardware::Return<void> addOnewayTask(std::function<void(void)>&& task);
+
+};
+
+}  // namespace V1_0
+}  // namespace fwd
+}  // namespace golden
+
+#endif  // HIDL_GENERATED_GOLDEN_FWD_V1_0_BSFOO_H
@@ -0,0 +1,45 @@
+// FIXME: your file license if you have one
+
+#pragma once
+
+#include <golden/fwd/1.0/IFoo.h>
+#include <golden/fwd/1.0/IListener.h>
+#include <golden/fwd/1.0/ISource.h>
+#include <hidl/MQDescriptor.h>
+#include <hidl/Status.h>
+
+namespace golden {
+namespace fwd {
+namespace V1_0 {
+namespace implementation {
+
+using ::android::hardware::hidl_array;
+using ::android::hardware::hidl_memory;
+using ::android::hardware::hidl_string;
+using ::android::hardware::hidl_vec;
+using ::android::hardware::Return;
+using ::android::hardware::Void;
+using ::android::sp;
+
+struct Foo : public IFoo {
+    // Methods from ::golden::fwd::V1_0::IParent follow.
+    Return<void> reset() override;
+
+    // Methods from ::golden::fwd::V1_0::IFoo follow.
+    Return<void> setListener(const sp<::golden::fwd::V1_0::IListener>& listener) override;
+    Return<sp<::golden::fwd::V1_0::ISource>> getSource() override;
+    Return<void> getEntries(getEntries_cb _hidl_cb) override;
+    Return<void> apply(const ::golden::fwd::V1_0::IConfig::Setting& setting) override;
+    Return<void> link(const ::golden::fwd::V1_0::IFoo::Link& link) override;
+
+    // Methods from ::android::hidl::base::V1_0::IBase follow.
+
+};
+
+// FIXME: most likely delete, this is only for passthrough implementations
+// extern "C" IFoo* HIDL_FETCH_IFoo(const char* name);
+
+}  // namespace implementation
+}  // namespace V1_0
+}  // namespace fwd
+}  // namespace golden
@@ -0,0 +1,238 @@
+#ifndef HIDL_GENERATED_GOLDEN_FWD_V1_0_IFOO_H
+#define HIDL_GENERATED_GOLDEN_FWD_V1_0_IFOO_H
+
+#include <android/hidl/base/1.0/IBase.h>
+#include <golden/fwd/1.0/IConfig.h>
+#include <golden/fwd/1.0/IEntry.h>
+#include <golden/fwd/1.0/IListenerFwd.h>
+#include <golden/fwd/1.0/INode.h>
+#include <golden/fwd/1.0/IParent.h>
+#include <golden/fwd/1.0/ISourceFwd.h>
+
+#include <android/hidl/manager/1.0/IServiceNotification.h>
+
+#include <hidl/HidlSupport.h>
+#include <hidl/MQDescriptor.h>
+#include <hidl/Status.h>
+#include <utils/NativeHandle.h>
+#include <utils/misc.h>
+
+namespace golden {
+namespace fwd {
+namespace V1_0 {
+
+/**
+ * With -F, IFoo.h only includes IListenerFwd.h and ISourceFwd.h, since those
+ * are just passed to and returned from methods. The other imports are the
+ * super type, used inside a vec, used through a nested type, or referenced
+ * by a nested type, so their full headers are included.
+ */
+struct IFoo : public ::golden::fwd::V1_0::IParent {
+    /**
+     * Type tag for use in template logic that indicates this is a 'pure' class.
+     */
+    typedef android::hardware::details::i_tag _hidl_tag;
+
+    /**
+     * Fully qualified interface name: "golden.fwd@1.0::IFoo"
+     */
+    static const char* descriptor;
+
+    // Forward declaration for forward reference support:
+    struct Link;
+
+    struct Link final {
+        ::android::sp<::golden::fwd::V1_0::INode> node __attribute__ ((aligned(8)));
+        int32_t weight __attribute__ ((aligned(4)));
+    };
+
+    static_assert(offsetof(::golden::fwd::V1_0::IFoo::Link, node) == 0, "wrong offset");
+    static_assert(offsetof(::golden::fwd::V1_0::IFoo::Link, weight) == 8, "wrong offset");
+    static_assert(sizeof(::golden::fwd::V1_0::IFoo::Link) == 16, "wrong size");
+    static_assert(__alignof(::golden::fwd::V1_0::IFoo::Link) == 8, "wrong alignment");
+
+    /**
+     * Returns whether this object's implementation is outside of the current process.
+     */
+    virtual bool isRemote() const override { return false; }
+
+    virtual ::android::hardware::Return<void> reset() = 0;
+
+    virtual ::android::hardware::Return<void> setListener(const ::android::sp<::golden::fwd::V1_0::IListener>& listener) = 0;
+
+    virtual ::android::hardware::Return<::android::sp<::golden::fwd::V1_0::ISource>> getSource() = 0;
+
+    /**
+     * Return callback for getEntries
+     */
+    using getEntries_cb = std::function<void(const ::android::hardware::hidl_vec<::android::sp<::golden::fwd::V1_0::IEntry>>& entries)>;
+    virtual ::android::hardware::Return<void> getEntries(getEntries_cb _hidl_cb) = 0;
+
+    virtual ::android::hardware::Return<void> apply(const ::golden::fwd::V1_0::IConfig::Setting& setting) = 0;
+
+    virtual ::android::hardware::Return<void> link(const ::golden::fwd::V1_0::IFoo::Link& link) = 0;
+
+    /**
+     * Return callback for interfaceChain
+     */
+    using interfaceChain_cb = std::function<void(const ::android::hardware::hidl_vec<::android::hardware::hidl_string>& descriptors)>;
+    virtual ::android::hardware::Return<void> interfaceChain(interfaceChain_cb _hidl_cb) override;
+
+    virtual ::android::hardware::Return<void> debug(const ::android::hardware::hidl_handle& fd, const ::android::hardware::hidl_vec<::android::hardware::hidl_string>& options) override;
+
+    /**
+     * Return callback for interfaceDescriptor
+     */
+    using interfaceDescriptor_cb = std::function<void(const ::android::hardware::hidl_string& descriptor)>;
+    virtual ::android::hardware::Return<void> interfaceDescriptor(interfaceDescriptor_cb _hidl_cb) override;
+
+    /**
+     * Return callback for getHashChain
+     */
+    using getHashChain_cb = std::function<void(const ::android::hardware::hidl_vec<::android::hardware::hidl_array<uint8_t, 32>>& hashchain)>;
+    virtual ::android::hardware::Return<void> getHashChain(getHashChain_cb _hidl_cb) override;
+
+    virtual ::android::hardware::Return<void> setHALInstrumentation() override;
+
+    virtual ::android::hardware::Return<bool> linkToDeath(const ::android::sp<::android::hardware::hidl_death_recipient>& recipient, uint64_t cookie) override;
+
+    virtual ::android::hardware::Return<void> ping() override;
+
+    /**
+     * Return callback for getDebugInfo
+     */
+    using getDebugInfo_cb = std::function<void(const ::android::hidl::base::V1_0::DebugInfo& info)>;
+    virtual ::android::hardware::Return<void> getDebugInfo(getDebugInfo_cb _hidl_cb) override;
+
+    virtual ::android::hardware::Return<void> notifySyspropsChanged() override;
+
+    virtual ::android::hardware::Return<bool> unlinkToDeath(const ::android::sp<::android::hardware::hidl_death_recipient>& recipient) override;
+
+    // cast static functions
+    /**
+     * This performs a checked cast based on what the underlying implementation actually is.
+     */
+    static ::android::hardware::Return<::android::sp<::golden::fwd::V1_0::IFoo>> castFrom(const ::android::sp<::golden::fwd::V1_0::IFoo>& parent, bool emitError = false);
+    /**
+     * This performs a checked cast based on what the underlying implementation actually is.
+     */
+    static ::android::hardware::Return<::android::sp<::golden::fwd::V1_0::IFoo>> castFrom(const ::android::sp<::golden::fwd::V1_0::IParent>& parent, bool emitError = false);
+    /**
+     * This performs a checked cast based on what the underlying implementation actually is.
+     */
+    static ::android::hardware::Return<::android::sp<::golden::fwd::V1_0::IFoo>> castFrom(const ::android::sp<::android::hidl::base::V1_0::IBase>& parent, bool emitError = false);
+
+    // helper methods for interactions with the hwservicemanager
+    /**
+     * This gets the service of this type with the specified instance name. If the
+     * service is currently not available or not in the VINTF manifest on a Trebilized
+     * device, this will return nullptr. This is useful when you don't want to block
+     * during device boot. If getStub is true, this will try to return an unwrapped
+     * passthrough implementation in the same process. This is useful when getting an
+     * implementation from the same partition/compilation group.
+     * 
+     * In general, prefer getService(std::string,bool)
+     */
+    static ::android::sp<IFoo> tryGetService(const std::string &serviceName="default", bool getStub=false);
+    /**
+     * Deprecated. See tryGetService(std::string, bool)
+     */
+    static ::android::sp<IFoo> tryGetService(const char serviceName[], bool getStub=false)  { std::string str(serviceName ? serviceName : "");      return tryGetService(str, getStub); }
+    /**
+     * Deprecated. See tryGetService(std::string, bool)
+     */
+    static ::android::sp<IFoo> tryGetService(const ::android::hardware::hidl_string& serviceName, bool getStub=false)  { std::string str(serviceName.c_str());      return tryGetService(str, getStub); }
+    /**
+     * Calls tryGetService("default", bool). This is the recommended instance name for singleton services.
+     */
+    static ::android::sp<IFoo> tryGetService(bool getStub) { return tryGetService("default", getStub); }
+    /**
+     * This gets the service of this type with the specified instance name. If the
+     * service is not in the VINTF manifest on a Trebilized device, this will return
+     * nullptr. If the service is not available, this will wait for the service to
+     * become available. If the service is a lazy service, this will start the service
+     * and return when it becomes available. If getStub is true, this will try to
+     * return an unwrapped passthrough implementation in the same process. This is
+     * useful when getting an implementation from the same partition/compilation group.
+     */
+    static ::android::sp<IFoo> getService(const std::string &serviceName="default", bool getStub=false);
+    /**
+     * Deprecated. See getService(std::string, bool)
+     */
+    static ::android::sp<IFoo> getService(const char serviceName[], bool getStub=false)  { std::string str(serviceName ? serviceName : "");      return getService(str, getStub); }
+    /**
+     * Deprecated. See getService(std::string, bool)
+     */
+    static ::android::sp<IFoo> getService(const ::android::hardware::hidl_string& serviceName, bool getStub=false)  { std::string str(serviceName.c_str());      return getService(str, getStub); }
+    /**
+     * Calls getService("default", bool). This is the recommended instance name for singleton services.
+     */
+    static ::android::sp<IFoo> getService(bool getStub) { return getService("default", getStub); }
+    /**
+     * Registers a service with the service manager. For Trebilized devices, the service
+     * must also be in the VINTF manifest.
+     */
+    __attribute__ ((warn_unused_result))::android::status_t registerAsService(const std::string &serviceName="default");
+    /**
+     * Registers for notifications for when a service is registered.
+     */
+    static bool registerForNotifications(
+            const std::string &serviceName,
+            const ::android::sp<::android::hidl::manager::V1_0::IServiceNotification> &notification);
+};
+
+//
+// type declarations for package
+//
+
+static inline void appendToString(std::string& os, const ::golden::fwd::V1_0::IFoo::Link& o);
+static inline std::string toString(const ::golden::fwd::V1_0::IFoo::Link& o);
+// operator== and operator!= are not generated for Link
+
+static inline std::string toString(const ::android::sp<::golden::fwd::V1_0::IFoo>& o);
+
+//
+// type header definitions for package
+//
+
+static inline void appendToString(std::string& os, const ::golden::fwd::V1_0::IFoo::Link& o) {
+    using ::android::hardware::toString;
+    os += "{";
+    os += ".node = ";
+    os += ::golden::fwd::V1_0::toString(o.node);
+    os += ", .weight = ";
+    os += ::android::hardware::toString(o.weight);
+    os += "}";
+}
+
+static inline std::string toString(const ::golden::fwd::V1_0::IFoo::Link& o) {
+    std::string os;
+    appendToString(os, o);
+    return os;
+}
+
+// operator== and operator!= are not generated for Link
+
+static inline std::string toString(const ::android::sp<::golden::fwd::V1_0::IFoo>& o) {
+    std::string os = "[class or subclass of ";
+    os += ::golden::fwd::V1_0::IFoo::descriptor;
+    os += "]";
+    os += o->isRemote() ? "@remote" : "@local";
+    return os;
+}
+
+
+}  // namespace V1_0
+}  // namespace fwd
+}  // namespace golden
+
+//
+// global type declarations for package
+//
+
+//
+// global type header definitions for package
+//
+
+
+#endif  // HIDL_GENERATED_GOLDEN_FWD_V1_0_IFOO_H
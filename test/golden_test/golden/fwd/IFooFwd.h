@@ -0,0 +1,14 @@
+#ifndef HIDL_GENERATED_GOLDEN_FWD_V1_0_IFOOFWD_H
+#define HIDL_GENERATED_GOLDEN_FWD_V1_0_IFOOFWD_H
+
+namespace golden {
+namespace fwd {
+namespace V1_0 {
+
+struct IFoo;
+
+}  // namespace V1_0
+}  // namespace fwd
+}  // namespace golden
+
+#endif  // HIDL_GENERATED_GOLDEN_FWD_V1_0_IFOOFWD_H
@@ -0,0 +1,52 @@
+#ifndef HIDL_GENERATED_GOLDEN_V1_0_HWTYPES_H
+#define HIDL_GENERATED_GOLDEN_V1_0_HWTYPES_H
+
+#include <golden/1.0/types.h>
+
+
+#include <hidl/Status.h>
+#include <hwbinder/IBinder.h>
+#include <hwbinder/Parcel.h>
+
+namespace golden {
+namespace V1_0 {
+::android::status_t readEmbeddedFromParcel(
+        const ::golden::V1_0::Shape &obj,
+        const ::android::hardware::Parcel &parcel,
+        size_t parentHandle,
+        size_t parentOffset);
+
+::android::status_t writeEmbeddedToParcel(
+        const ::golden::V1_0::Shape &obj,
+        ::android::hardware::Parcel *parcel,
+        size_t parentHandle,
+        size_t parentOffset);
+
+::android::status_t readEmbeddedFromParcel(
+        const ::golden::V1_0::Scene &obj,
+        const ::android::hardware::Parcel &parcel,
+        size_t parentHandle,
+        size_t parentOffset);
+
+::android::status_t writeEmbeddedToParcel(
+        const ::golden::V1_0::Scene &obj,
+        ::android::hardware::Parcel *parcel,
+        size_t parentHandle,
+        size_t parentOffset);
+
+::android::status_t readEmbeddedFromParcel(
+        const ::golden::V1_0::Samples &obj,
+        const ::android::hardware::Parcel &parcel,
+        size_t parentHandle,
+        size_t parentOffset);
+
+::android::status_t writeEmbeddedToParcel(
+        const ::golden::V1_0::Samples &obj,
+        ::android::hardware::Parcel *parcel,
+        size_t parentHandle,
+        size_t parentOffset);
+
+}  // namespace V1_0
+}  // namespace golden
+
+#endif  // HIDL_GENERATED_GOLDEN_V1_0_HWTYPES_H
@@ -0,0 +1,451 @@
+#ifndef HIDL_GENERATED_GOLDEN_LATENCY_V1_0_BSCHILD_H
+#define HIDL_GENERATED_GOLDEN_LATENCY_V1_0_BSCHILD_H
+
+#include <android-base/macros.h>
+#include <cutils/trace.h>
+#include <future>
+#include <golden/latency/1.0/IChild.h>
+
+#include <hidl/HidlPassthroughSupport.h>
+#include <functional>
+#include <memory>
+namespace golden {
+namespace latency {
+namespace V1_0 {
+
+struct BsChild : IChild, ::android::hardware::details::HidlInstrumentor {
+    explicit BsChild(const ::android::sp<IChild> impl);
+    ~BsChild();
+
+    /**
+     * The pure class is what this class wraps.
+     */
+    typedef IChild Pure;
+
+    typedef android::hardware::details::bs_tag _hidl_tag;
+
+    /**
+     * Number of oneway calls queued and not yet started.
+     */
+    size_t getOnewayQueueDepth() const;
+
+    /**
+     * Number of oneway calls rejected because the queue was full.
+     */
+    uint64_t getOnewayDropCount() const;
+
+    // Methods from ::golden::latency::V1_0::IParent follow.
+    ::android::hardware::Return<int32_t> get() override {
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IChild::get::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            std::vector<void *> _hidl_args;
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "golden.latency", "1.0", "IParent", "get", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        const auto _hidl_latency_start = std::chrono::steady_clock::now();
+        auto _hidl_return = mImpl->get();
+
+        int32_t _hidl_out_value = _hidl_return;
+        (void) _hidl_out_value;
+        atrace_end(ATRACE_TAG_HAL);
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            void *_hidl_arg_pointers[] = {(void *)&_hidl_out_value};
+            std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_EXIT, "golden.latency", "1.0", "IParent", "get", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        IChild::_hidl_passthroughLatency[0].record(_hidl_latency_start);
+        if (!_hidl_error.isOk()) return _hidl_error;
+        return _hidl_return;
+    }
+    ::android::hardware::Return<void> fire(int32_t value) override {
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IChild::fire::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            void *_hidl_arg_pointers[] = {(void *)&value};
+            std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "golden.latency", "1.0", "IParent", "fire", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        const auto _hidl_latency_start = std::chrono::steady_clock::now();
+        auto _hidl_return = addOnewayTask([mImpl = this->mImpl
+        #ifdef __ANDROID_DEBUGGABLE__
+        , mEnableInstrumentation = this->mEnableInstrumentation, mInstrumentationCallbacks = this->mInstrumentationCallbacks
+        #endif // __ANDROID_DEBUGGABLE__
+        , value] {
+            mImpl->fire(value);
+
+            atrace_end(ATRACE_TAG_HAL);
+            #ifdef __ANDROID_DEBUGGABLE__
+            if (UNLIKELY(mEnableInstrumentation)) {
+                std::vector<void *> _hidl_args;
+                for (const auto &callback: mInstrumentationCallbacks) {
+                    callback(InstrumentationEvent::PASSTHROUGH_EXIT, "golden.latency", "1.0", "IParent", "fire", &_hidl_args);
+                }
+            }
+            #endif // __ANDROID_DEBUGGABLE__
+
+        });
+        IChild::_hidl_passthroughLatency[1].record(_hidl_latency_start);
+        return _hidl_return;
+    }
+
+    // Methods from ::golden::latency::V1_0::IChild follow.
+    ::android::hardware::Return<void> put(int32_t value) override {
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IChild::put::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            void *_hidl_arg_pointers[] = {(void *)&value};
+            std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "golden.latency", "1.0", "IChild", "put", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        const auto _hidl_latency_start = std::chrono::steady_clock::now();
+        auto _hidl_return = mImpl->put(value);
+
+        atrace_end(ATRACE_TAG_HAL);
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            std::vector<void *> _hidl_args;
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_EXIT, "golden.latency", "1.0", "IChild", "put", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        IChild::_hidl_passthroughLatency[2].record(_hidl_latency_start);
+        if (!_hidl_error.isOk()) return _hidl_error;
+        return _hidl_return;
+    }
+
+    // Methods from ::android::hidl::base::V1_0::IBase follow.
+    ::android::hardware::Return<void> interfaceChain(interfaceChain_cb _hidl_cb) override {
+        if (_hidl_cb == nullptr) {
+            return ::android::hardware::Status::fromExceptionCode(
+                    ::android::hardware::Status::EX_ILLEGAL_ARGUMENT,
+                    "Null synchronous callback passed.");
+        }
+
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IChild::interfaceChain::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            std::vector<void *> _hidl_args;
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "android.hidl.base", "1.0", "IBase", "interfaceChain", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        auto _hidl_return = mImpl->interfaceChain([&](const auto &_hidl_out_descriptors) {
+            atrace_end(ATRACE_TAG_HAL);
+            #ifdef __ANDROID_DEBUGGABLE__
+            if (UNLIKELY(mEnableInstrumentation)) {
+                void *_hidl_arg_pointers[] = {(void *)&_hidl_out_descriptors};
+                std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+                for (const auto &callback: mInstrumentationCallbacks) {
+                    callback(InstrumentationEvent::PASSTHROUGH_EXIT, "android.hidl.base", "1.0", "IBase", "interfaceChain", &_hidl_args);
+                }
+            }
+            #endif // __ANDROID_DEBUGGABLE__
+
+            _hidl_cb(_hidl_out_descriptors);
+        });
+
+        if (!_hidl_error.isOk()) return _hidl_error;
+        return _hidl_return;
+    }
+    ::android::hardware::Return<void> debug(const ::android::hardware::hidl_handle& fd, const ::android::hardware::hidl_vec<::android::hardware::hidl_string>& options) override {
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IChild::debug::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            void *_hidl_arg_pointers[] = {(void *)&fd, (void *)&options};
+            std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 2);
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "android.hidl.base", "1.0", "IBase", "debug", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        auto _hidl_return = mImpl->debug(fd, options);
+
+        atrace_end(ATRACE_TAG_HAL);
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            std::vector<void *> _hidl_args;
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_EXIT, "android.hidl.base", "1.0", "IBase", "debug", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        if (!_hidl_error.isOk()) return _hidl_error;
+        return _hidl_return;
+    }
+    ::android::hardware::Return<void> interfaceDescriptor(interfaceDescriptor_cb _hidl_cb) override {
+        if (_hidl_cb == nullptr) {
+            return ::android::hardware::Status::fromExceptionCode(
+                    ::android::hardware::Status::EX_ILLEGAL_ARGUMENT,
+                    "Null synchronous callback passed.");
+        }
+
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IChild::interfaceDescriptor::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            std::vector<void *> _hidl_args;
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "android.hidl.base", "1.0", "IBase", "interfaceDescriptor", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        auto _hidl_return = mImpl->interfaceDescriptor([&](const auto &_hidl_out_descriptor) {
+            atrace_end(ATRACE_TAG_HAL);
+            #ifdef __ANDROID_DEBUGGABLE__
+            if (UNLIKELY(mEnableInstrumentation)) {
+                void *_hidl_arg_pointers[] = {(void *)&_hidl_out_descriptor};
+                std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+                for (const auto &callback: mInstrumentationCallbacks) {
+                    callback(InstrumentationEvent::PASSTHROUGH_EXIT, "android.hidl.base", "1.0", "IBase", "interfaceDescriptor", &_hidl_args);
+                }
+            }
+            #endif // __ANDROID_DEBUGGABLE__
+
+            _hidl_cb(_hidl_out_descriptor);
+        });
+
+        if (!_hidl_error.isOk()) return _hidl_error;
+        return _hidl_return;
+    }
+    ::android::hardware::Return<void> getHashChain(getHashChain_cb _hidl_cb) override {
+        if (_hidl_cb == nullptr) {
+            return ::android::hardware::Status::fromExceptionCode(
+                    ::android::hardware::Status::EX_ILLEGAL_ARGUMENT,
+                    "Null synchronous callback passed.");
+        }
+
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IChild::getHashChain::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            std::vector<void *> _hidl_args;
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "android.hidl.base", "1.0", "IBase", "getHashChain", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        auto _hidl_return = mImpl->getHashChain([&](const auto &_hidl_out_hashchain) {
+            atrace_end(ATRACE_TAG_HAL);
+            #ifdef __ANDROID_DEBUGGABLE__
+            if (UNLIKELY(mEnableInstrumentation)) {
+                void *_hidl_arg_pointers[] = {(void *)&_hidl_out_hashchain};
+                std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+                for (const auto &callback: mInstrumentationCallbacks) {
+                    callback(InstrumentationEvent::PASSTHROUGH_EXIT, "android.hidl.base", "1.0", "IBase", "getHashChain", &_hidl_args);
+                }
+            }
+            #endif // __ANDROID_DEBUGGABLE__
+
+            _hidl_cb(_hidl_out_hashchain);
+        });
+
+        if (!_hidl_error.isOk()) return _hidl_error;
+        return _hidl_return;
+    }
+    ::android::hardware::Return<void> setHALInstrumentation() override {
+        configureInstrumentation();
+        return ::android::hardware::Void();
+    }
+
+    ::android::hardware::Return<bool> linkToDeath(const ::android::sp<::android::hardware::hidl_death_recipient>& recipient, uint64_t cookie) override {
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IChild::linkToDeath::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            void *_hidl_arg_pointers[] = {(void *)&recipient, (void *)&cookie};
+            std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 2);
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "android.hidl.base", "1.0", "IBase", "linkToDeath", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        auto _hidl_return = mImpl->linkToDeath(recipient, cookie);
+
+        bool _hidl_out_success = _hidl_return;
+        (void) _hidl_out_success;
+        atrace_end(ATRACE_TAG_HAL);
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            void *_hidl_arg_pointers[] = {(void *)&_hidl_out_success};
+            std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_EXIT, "android.hidl.base", "1.0", "IBase", "linkToDeath", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        if (!_hidl_error.isOk()) return _hidl_error;
+        return _hidl_return;
+    }
+    ::android::hardware::Return<void> ping() override {
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IChild::ping::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            std::vector<void *> _hidl_args;
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "android.hidl.base", "1.0", "IBase", "ping", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        auto _hidl_return = mImpl->ping();
+
+        atrace_end(ATRACE_TAG_HAL);
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            std::vector<void *> _hidl_args;
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_EXIT, "android.hidl.base", "1.0", "IBase", "ping", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        if (!_hidl_error.isOk()) return _hidl_error;
+        return _hidl_return;
+    }
+    ::android::hardware::Return<void> getDebugInfo(getDebugInfo_cb _hidl_cb) override {
+        if (_hidl_cb == nullptr) {
+            return ::android::hardware::Status::fromExceptionCode(
+                    ::android::hardware::Status::EX_ILLEGAL_ARGUMENT,
+                    "Null synchronous callback passed.");
+        }
+
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IChild::getDebugInfo::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            std::vector<void *> _hidl_args;
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "android.hidl.base", "1.0", "IBase", "getDebugInfo", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        auto _hidl_return = mImpl->getDebugInfo([&](const auto &_hidl_out_info) {
+            atrace_end(ATRACE_TAG_HAL);
+            #ifdef __ANDROID_DEBUGGABLE__
+            if (UNLIKELY(mEnableInstrumentation)) {
+                void *_hidl_arg_pointers[] = {(void *)&_hidl_out_info};
+                std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+                for (const auto &callback: mInstrumentationCallbacks) {
+                    callback(InstrumentationEvent::PASSTHROUGH_EXIT, "android.hidl.base", "1.0", "IBase", "getDebugInfo", &_hidl_args);
+                }
+            }
+            #endif // __ANDROID_DEBUGGABLE__
+
+            _hidl_cb(_hidl_out_info);
+        });
+
+        if (!_hidl_error.isOk()) return _hidl_error;
+        return _hidl_return;
+    }
+    ::android::hardware::Return<void> notifySyspropsChanged() override {
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IChild::notifySyspropsChanged::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            std::vector<void *> _hidl_args;
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "android.hidl.base", "1.0", "IBase", "notifySyspropsChanged", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        auto _hidl_return = addOnewayTask([mImpl = this->mImpl
+        #ifdef __ANDROID_DEBUGGABLE__
+        , mEnableInstrumentation = this->mEnableInstrumentation, mInstrumentationCallbacks = this->mInstrumentationCallbacks
+        #endif // __ANDROID_DEBUGGABLE__
+        ] {
+            mImpl->notifySyspropsChanged();
+
+            atrace_end(ATRACE_TAG_HAL);
+            #ifdef __ANDROID_DEBUGGABLE__
+            if (UNLIKELY(mEnableInstrumentation)) {
+                std::vector<void *> _hidl_args;
+                for (const auto &callback: mInstrumentationCallbacks) {
+                    callback(InstrumentationEvent::PASSTHROUGH_EXIT, "android.hidl.base", "1.0", "IBase", "notifySyspropsChanged", &_hidl_args);
+                }
+            }
+            #endif // __ANDROID_DEBUGGABLE__
+
+        });
+        return _hidl_return;
+    }
+    ::android::hardware::Return<bool> unlinkToDeath(const ::android::sp<::android::hardware::hidl_death_recipient>& recipient) override {
+        atrace_begin(ATRACE_TAG_HAL, "HIDL::IChild::unlinkToDeath::passthrough");
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            void *_hidl_arg_pointers[] = {(void *)&recipient};
+            std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_ENTRY, "android.hidl.base", "1.0", "IBase", "unlinkToDeath", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        ::android::hardware::Status _hidl_error = ::android::hardware::Status::ok();
+        auto _hidl_return = mImpl->unlinkToDeath(recipient);
+
+        bool _hidl_out_success = _hidl_return;
+        (void) _hidl_out_success;
+        atrace_end(ATRACE_TAG_HAL);
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            void *_hidl_arg_pointers[] = {(void *)&_hidl_out_success};
+            std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::PASSTHROUGH_EXIT, "android.hidl.base", "1.0", "IBase", "unlinkToDeath", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        if (!_hidl_error.isOk()) return _hidl_error;
+        return _hidl_return;
+    }
+
+private:
+    const ::android::sp<IChild> mImpl;
+    struct OnewayQueue;
+    const std::shared_ptr<OnewayQueue> mOnewayQueue;
+
+    ::android::hardware::Return<void> addOnewayTask(std::function<void(void)>&& task);
+
+};
+
+}  // namespace V1_0
+}  // namespace latency
+}  // namespace golden
+
+#endif  // HIDL_GENERATED_GOLDEN_LATENCY_V1_0_BSCHILD_H
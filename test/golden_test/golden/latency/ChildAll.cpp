@@ -0,0 +1,734 @@
+#define LOG_TAG "golden.latency@1.0::Child"
+
+#include <log/log.h>
+#include <cutils/trace.h>
+#include <hidl/HidlTransportSupport.h>
+
+#include <hidl/Static.h>
+#include <hwbinder/ProcessState.h>
+#include <utils/Trace.h>
+#include <android/hidl/manager/1.0/IServiceManager.h>
+#include <golden/latency/1.0/BpHwChild.h>
+#include <golden/latency/1.0/BnHwChild.h>
+#include <golden/latency/1.0/BsChild.h>
+#include <golden/latency/1.0/BpHwParent.h>
+#include <android/hidl/base/1.0/BpHwBase.h>
+#include <hidl/ServiceManagement.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <inttypes.h>
+#include <mutex>
+#include <stdio.h>
+#include <thread>
+#include <unordered_map>
+
+namespace golden {
+namespace latency {
+namespace V1_0 {
+
+const char* IChild::descriptor("golden.latency@1.0::IChild");
+
+__attribute__((constructor)) static void static_constructor() {
+    ::android::hardware::details::getBnConstructorMap().set(IChild::descriptor,
+            [](void *iIntf) -> ::android::sp<::android::hardware::IBinder> {
+                return new BnHwChild(static_cast<IChild *>(iIntf));
+            });
+    ::android::hardware::details::getBsConstructorMap().set(IChild::descriptor,
+            [](void *iIntf) -> ::android::sp<::android::hidl::base::V1_0::IBase> {
+                return new BsChild(static_cast<IChild *>(iIntf));
+            });
+};
+
+__attribute__((destructor))static void static_destructor() {
+    ::android::hardware::details::getBnConstructorMap().erase(IChild::descriptor);
+    ::android::hardware::details::getBsConstructorMap().erase(IChild::descriptor);
+};
+
+// Methods from ::golden::latency::V1_0::IParent follow.
+// no default implementation for: ::android::hardware::Return<int32_t> IChild::get()
+// no default implementation for: ::android::hardware::Return<void> IChild::fire(int32_t value)
+
+// Methods from ::golden::latency::V1_0::IChild follow.
+// no default implementation for: ::android::hardware::Return<void> IChild::put(int32_t value)
+
+// Methods from ::android::hidl::base::V1_0::IBase follow.
+::android::hardware::Return<void> IChild::interfaceChain(interfaceChain_cb _hidl_cb){
+    _hidl_cb({
+        ::golden::latency::V1_0::IChild::descriptor,
+        ::golden::latency::V1_0::IParent::descriptor,
+        ::android::hidl::base::V1_0::IBase::descriptor,
+    });
+    return ::android::hardware::Void();}
+
+::android::hardware::Return<void> IChild::debug(const ::android::hardware::hidl_handle& fd, const ::android::hardware::hidl_vec<::android::hardware::hidl_string>& options){
+    if (fd.getNativeHandle() != nullptr && fd->numFds > 0) {
+        _hidl_dumpLatency(fd->data[0]);
+    }
+    (void)options;
+    return ::android::hardware::Void();
+}
+
+::android::hardware::Return<void> IChild::interfaceDescriptor(interfaceDescriptor_cb _hidl_cb){
+    _hidl_cb(::golden::latency::V1_0::IChild::descriptor);
+    return ::android::hardware::Void();
+}
+
+::android::hardware::Return<void> IChild::getHashChain(getHashChain_cb _hidl_cb){
+    _hidl_cb({
+        (uint8_t[32]){0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0} /* 0000000000000000000000000000000000000000000000000000000000000000 */,
+        (uint8_t[32]){0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0} /* 0000000000000000000000000000000000000000000000000000000000000000 */,
+        (uint8_t[32]){40,121,233,138,49,49,96,191,232,47,213,125,109,11,93,95,72,75,98,132,143,119,21,236,173,252,129,232,185,94,214,188} /* 2879e98a313160bfe82fd57d6d0b5d5f484b62848f7715ecadfc81e8b95ed6bc */});
+    return ::android::hardware::Void();
+}
+
+::android::hardware::Return<void> IChild::setHALInstrumentation(){
+    return ::android::hardware::Void();
+}
+
+::android::hardware::Return<bool> IChild::linkToDeath(const ::android::sp<::android::hardware::hidl_death_recipient>& recipient, uint64_t cookie){
+    (void)cookie;
+    return (recipient != nullptr);
+}
+
+::android::hardware::Return<void> IChild::ping(){
+    return ::android::hardware::Void();
+}
+
+::android::hardware::Return<void> IChild::getDebugInfo(getDebugInfo_cb _hidl_cb){
+    ::android::hidl::base::V1_0::DebugInfo info = {};
+    info.pid = -1;
+    info.ptr = 0;
+    info.arch = 
+    #if defined(__LP64__)
+    ::android::hidl::base::V1_0::DebugInfo::Architecture::IS_64BIT
+    #else
+    ::android::hidl::base::V1_0::DebugInfo::Architecture::IS_32BIT
+    #endif
+    ;
+    _hidl_cb(info);
+    return ::android::hardware::Void();
+}
+
+::android::hardware::Return<void> IChild::notifySyspropsChanged(){
+    ::android::report_sysprop_change();
+    return ::android::hardware::Void();
+}
+
+::android::hardware::Return<bool> IChild::unlinkToDeath(const ::android::sp<::android::hardware::hidl_death_recipient>& recipient){
+    return (recipient != nullptr);
+}
+
+
+// Whether remote binders implement this interface, by binder. Entries are
+// evicted when their binder dies, and ignored once it has been destroyed.
+struct _hidl_IChildCastCache : public ::android::hardware::IBinder::DeathRecipient {
+    static _hidl_IChildCastCache* get() {
+        // never destroyed, since binder threads may still use it at exit
+        static _hidl_IChildCastCache* const sCache = [] {
+            _hidl_IChildCastCache* cache = new _hidl_IChildCastCache();
+            cache->incStrong(nullptr);
+            return cache;
+        }();
+        return sCache;
+    }
+
+    bool lookup(const ::android::sp<::android::hardware::IBinder>& binder, bool* canCast) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto it = mEntries.find(binder.get());
+        if (it == mEntries.end() || it->second.binder.promote() != binder) {
+            return false;
+        }
+        *canCast = it->second.canCast;
+        return true;
+    }
+
+    void insert(const ::android::sp<::android::hardware::IBinder>& binder, bool canCast) {
+        if (binder->linkToDeath(this) != ::android::OK) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mEntries.size() >= mSweepSize) {
+            // drop the entries of destroyed binders
+            for (auto it = mEntries.begin(); it != mEntries.end();) {
+                it = it->second.binder.promote() == nullptr ? mEntries.erase(it) : std::next(it);
+            }
+            mSweepSize = 2 * std::max<size_t>(mEntries.size(), 16);
+        }
+        mEntries[binder.get()] = {binder, canCast};
+    }
+
+    void binderDied(const ::android::wp<::android::hardware::IBinder>& who) override {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mEntries.erase(who.unsafe_get());
+    }
+
+    struct Entry {
+        ::android::wp<::android::hardware::IBinder> binder;
+        bool canCast;
+    };
+
+    std::mutex mMutex;
+    std::unordered_map<const ::android::hardware::IBinder*, Entry> mEntries;
+    size_t mSweepSize = 16;
+};
+
+::android::hardware::Return<::android::sp<::golden::latency::V1_0::IChild>> IChild::castFrom(const ::android::sp<::golden::latency::V1_0::IChild>& parent, bool /* emitError */) {
+    return parent;
+}
+
+::android::hardware::Return<::android::sp<::golden::latency::V1_0::IChild>> IChild::castFrom(const ::android::sp<::golden::latency::V1_0::IParent>& parent, bool emitError) {
+    if (parent == nullptr || !parent->isRemote()) {
+        return ::android::hardware::details::castInterface<IChild, ::golden::latency::V1_0::IParent, BpHwChild>(
+                parent, "golden.latency@1.0::IChild", emitError);
+    }
+
+    // Remote objects don't change interfaces, so interfaceChain() is only
+    // called once per binder.
+    const ::android::sp<::android::hardware::IBinder> _hidl_binder =
+            ::android::hardware::toBinder<::golden::latency::V1_0::IParent>(parent);
+    bool _hidl_canCast;
+    if (_hidl_IChildCastCache::get()->lookup(_hidl_binder, &_hidl_canCast)) {
+        if (!_hidl_canCast) {
+            return ::android::sp<::golden::latency::V1_0::IChild>(nullptr);
+        }
+        return ::android::sp<::golden::latency::V1_0::IChild>(new BpHwChild(_hidl_binder));
+    }
+
+    // Errors are always requested, so that a failed interfaceChain() call isn't
+    // taken for, and cached as, an interface the binder doesn't implement.
+    ::android::hardware::Return<bool> _hidl_canCast_ret =
+            ::android::hardware::details::canCastInterface(parent.get(), "golden.latency@1.0::IChild", true /* emitError */);
+    if (!_hidl_canCast_ret.isOk()) {
+        if (emitError) {
+            return ::android::hardware::details::StatusOf<bool, ::android::sp<::golden::latency::V1_0::IChild>>(_hidl_canCast_ret);
+        }
+        return ::android::sp<::golden::latency::V1_0::IChild>(nullptr);
+    }
+
+    _hidl_canCast = _hidl_canCast_ret;
+    _hidl_IChildCastCache::get()->insert(_hidl_binder, _hidl_canCast);
+    if (!_hidl_canCast) {
+        return ::android::sp<::golden::latency::V1_0::IChild>(nullptr);
+    }
+    return ::android::sp<::golden::latency::V1_0::IChild>(new BpHwChild(_hidl_binder));
+}
+
+::android::hardware::Return<::android::sp<::golden::latency::V1_0::IChild>> IChild::castFrom(const ::android::sp<::android::hidl::base::V1_0::IBase>& parent, bool emitError) {
+    if (parent == nullptr || !parent->isRemote()) {
+        return ::android::hardware::details::castInterface<IChild, ::android::hidl::base::V1_0::IBase, BpHwChild>(
+                parent, "golden.latency@1.0::IChild", emitError);
+    }
+
+    // Remote objects don't change interfaces, so interfaceChain() is only
+    // called once per binder.
+    const ::android::sp<::android::hardware::IBinder> _hidl_binder =
+            ::android::hardware::toBinder<::android::hidl::base::V1_0::IBase>(parent);
+    bool _hidl_canCast;
+    if (_hidl_IChildCastCache::get()->lookup(_hidl_binder, &_hidl_canCast)) {
+        if (!_hidl_canCast) {
+            return ::android::sp<::golden::latency::V1_0::IChild>(nullptr);
+        }
+        return ::android::sp<::golden::latency::V1_0::IChild>(new BpHwChild(_hidl_binder));
+    }
+
+    // Errors are always requested, so that a failed interfaceChain() call isn't
+    // taken for, and cached as, an interface the binder doesn't implement.
+    ::android::hardware::Return<bool> _hidl_canCast_ret =
+            ::android::hardware::details::canCastInterface(parent.get(), "golden.latency@1.0::IChild", true /* emitError */);
+    if (!_hidl_canCast_ret.isOk()) {
+        if (emitError) {
+            return ::android::hardware::details::StatusOf<bool, ::android::sp<::golden::latency::V1_0::IChild>>(_hidl_canCast_ret);
+        }
+        return ::android::sp<::golden::latency::V1_0::IChild>(nullptr);
+    }
+
+    _hidl_canCast = _hidl_canCast_ret;
+    _hidl_IChildCastCache::get()->insert(_hidl_binder, _hidl_canCast);
+    if (!_hidl_canCast) {
+        return ::android::sp<::golden::latency::V1_0::IChild>(nullptr);
+    }
+    return ::android::sp<::golden::latency::V1_0::IChild>(new BpHwChild(_hidl_binder));
+}
+
+IChild::_hidl_MethodLatency IChild::_hidl_clientLatency[3];
+IChild::_hidl_MethodLatency IChild::_hidl_serverLatency[3];
+IChild::_hidl_MethodLatency IChild::_hidl_passthroughLatency[3];
+
+void IChild::_hidl_dumpLatency(int fd) {
+    static constexpr const char* kMethodNames[] = {
+        "IParent::get",
+        "IParent::fire",
+        "IChild::put",
+    };
+    static const struct { const char* name; const _hidl_MethodLatency* latencies; } kSides[] = {
+        {"client", _hidl_clientLatency},
+        {"server", _hidl_serverLatency},
+        {"passthrough", _hidl_passthroughLatency},
+    };
+
+    dprintf(fd, "%-12s %-40s %12s %12s %12s\n", "side", "method", "calls", "p50 (us)", "p99 (us)");
+    for (const auto& side : kSides) {
+        for (size_t i = 0; i < 3; i++) {
+            uint64_t buckets[40];
+            uint64_t calls = 0;
+            for (size_t b = 0; b < 40; b++) {
+                buckets[b] = side.latencies[i].buckets[b].load(std::memory_order_relaxed);
+                calls += buckets[b];
+            }
+            if (calls == 0) continue;
+
+            // upper bound of the bucket holding the given fraction of the calls
+            auto percentile = [&](uint64_t permille) {
+                const uint64_t rank = (calls * permille + 999) / 1000;
+                uint64_t seen = 0;
+                size_t b = 0;
+                while ((seen += buckets[b]) < rank) b++;
+                return static_cast<double>(2ull << b) / 1000;
+            };
+            dprintf(fd, "%-12s %-40s %12" PRIu64 " %12.1f %12.1f\n", side.name, kMethodNames[i], calls,
+                    percentile(500), percentile(990));
+        }
+    }
+}
+
+BpHwChild::BpHwChild(const ::android::sp<::android::hardware::IBinder> &_hidl_impl)
+        : BpInterface<IChild>(_hidl_impl),
+          ::android::hardware::details::HidlInstrumentor("golden.latency@1.0", "IChild") {
+}
+
+// Methods from ::golden::latency::V1_0::IChild follow.
+::android::hardware::Return<void> BpHwChild::_hidl_put(::android::hardware::IInterface *_hidl_this, ::android::hardware::details::HidlInstrumentor *_hidl_this_instrumentor, int32_t value) {
+    #ifdef __ANDROID_DEBUGGABLE__
+    bool mEnableInstrumentation = _hidl_this_instrumentor->isInstrumentationEnabled();
+    const auto &mInstrumentationCallbacks = _hidl_this_instrumentor->getInstrumentationCallbacks();
+    #else
+    (void) _hidl_this_instrumentor;
+    #endif // __ANDROID_DEBUGGABLE__
+    ::android::ScopedTrace PASTE(___tracer, __LINE__) (ATRACE_TAG_HAL, "HIDL::IChild::put::client");
+    #ifdef __ANDROID_DEBUGGABLE__
+    if (UNLIKELY(mEnableInstrumentation)) {
+        void *_hidl_arg_pointers[] = {(void *)&value};
+        std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+        for (const auto &callback: mInstrumentationCallbacks) {
+            callback(InstrumentationEvent::CLIENT_API_ENTRY, "golden.latency", "1.0", "IChild", "put", &_hidl_args);
+        }
+    }
+    #endif // __ANDROID_DEBUGGABLE__
+
+    ::android::hardware::Parcel _hidl_data;
+    ::android::hardware::Parcel _hidl_reply;
+    ::android::status_t _hidl_err;
+    ::android::hardware::Status _hidl_status;
+
+    _hidl_data.setDataCapacity(32);
+
+    _hidl_err = _hidl_data.writeInterfaceToken(BpHwChild::descriptor);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    _hidl_err = _hidl_data.writeInt32(value);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    _hidl_err = ::android::hardware::IInterface::asBinder(_hidl_this)->transact(3 /* put */, _hidl_data, &_hidl_reply);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    _hidl_err = ::android::hardware::readFromParcel(&_hidl_status, _hidl_reply);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    if (!_hidl_status.isOk()) { return _hidl_status; }
+
+    #ifdef __ANDROID_DEBUGGABLE__
+    if (UNLIKELY(mEnableInstrumentation)) {
+        std::vector<void *> _hidl_args;
+        for (const auto &callback: mInstrumentationCallbacks) {
+            callback(InstrumentationEvent::CLIENT_API_EXIT, "golden.latency", "1.0", "IChild", "put", &_hidl_args);
+        }
+    }
+    #endif // __ANDROID_DEBUGGABLE__
+
+    _hidl_status.setFromStatusT(_hidl_err);
+    return ::android::hardware::Return<void>();
+
+_hidl_error:
+    _hidl_status.setFromStatusT(_hidl_err);
+    return ::android::hardware::Return<void>(_hidl_status);
+}
+
+
+// Methods from ::golden::latency::V1_0::IParent follow.
+::android::hardware::Return<int32_t> BpHwChild::get(){
+    const auto _hidl_latency_start = std::chrono::steady_clock::now();
+    ::android::hardware::Return<int32_t>  _hidl_out = ::golden::latency::V1_0::BpHwParent::_hidl_get(this, this);
+
+    IChild::_hidl_clientLatency[0].record(_hidl_latency_start);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<void> BpHwChild::fire(int32_t value){
+    const auto _hidl_latency_start = std::chrono::steady_clock::now();
+    ::android::hardware::Return<void>  _hidl_out = ::golden::latency::V1_0::BpHwParent::_hidl_fire(this, this, value);
+
+    IChild::_hidl_clientLatency[1].record(_hidl_latency_start);
+
+    return _hidl_out;
+}
+
+
+// Methods from ::golden::latency::V1_0::IChild follow.
+::android::hardware::Return<void> BpHwChild::put(int32_t value){
+    const auto _hidl_latency_start = std::chrono::steady_clock::now();
+    ::android::hardware::Return<void>  _hidl_out = ::golden::latency::V1_0::BpHwChild::_hidl_put(this, this, value);
+
+    IChild::_hidl_clientLatency[2].record(_hidl_latency_start);
+
+    return _hidl_out;
+}
+
+
+// Methods from ::android::hidl::base::V1_0::IBase follow.
+::android::hardware::Return<void> BpHwChild::interfaceChain(interfaceChain_cb _hidl_cb){
+    ::android::hardware::Return<void>  _hidl_out = ::android::hidl::base::V1_0::BpHwBase::_hidl_interfaceChain(this, this, _hidl_cb);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<void> BpHwChild::debug(const ::android::hardware::hidl_handle& fd, const ::android::hardware::hidl_vec<::android::hardware::hidl_string>& options){
+    ::android::hardware::Return<void>  _hidl_out = ::android::hidl::base::V1_0::BpHwBase::_hidl_debug(this, this, fd, options);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<void> BpHwChild::interfaceDescriptor(interfaceDescriptor_cb _hidl_cb){
+    ::android::hardware::Return<void>  _hidl_out = ::android::hidl::base::V1_0::BpHwBase::_hidl_interfaceDescriptor(this, this, _hidl_cb);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<void> BpHwChild::getHashChain(getHashChain_cb _hidl_cb){
+    ::android::hardware::Return<void>  _hidl_out = ::android::hidl::base::V1_0::BpHwBase::_hidl_getHashChain(this, this, _hidl_cb);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<void> BpHwChild::setHALInstrumentation(){
+    ::android::hardware::Return<void>  _hidl_out = ::android::hidl::base::V1_0::BpHwBase::_hidl_setHALInstrumentation(this, this);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<bool> BpHwChild::linkToDeath(const ::android::sp<::android::hardware::hidl_death_recipient>& recipient, uint64_t cookie){
+    ::android::hardware::ProcessState::self()->startThreadPool();
+    ::android::hardware::hidl_binder_death_recipient *binder_recipient = new ::android::hardware::hidl_binder_death_recipient(recipient, cookie, this);
+    std::unique_lock<std::mutex> lock(_hidl_mMutex);
+    _hidl_mDeathRecipients.push_back(binder_recipient);
+    return (remote()->linkToDeath(binder_recipient) == ::android::OK);
+}
+
+::android::hardware::Return<void> BpHwChild::ping(){
+    ::android::hardware::Return<void>  _hidl_out = ::android::hidl::base::V1_0::BpHwBase::_hidl_ping(this, this);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<void> BpHwChild::getDebugInfo(getDebugInfo_cb _hidl_cb){
+    ::android::hardware::Return<void>  _hidl_out = ::android::hidl::base::V1_0::BpHwBase::_hidl_getDebugInfo(this, this, _hidl_cb);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<void> BpHwChild::notifySyspropsChanged(){
+    ::android::hardware::Return<void>  _hidl_out = ::android::hidl::base::V1_0::BpHwBase::_hidl_notifySyspropsChanged(this, this);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<bool> BpHwChild::unlinkToDeath(const ::android::sp<::android::hardware::hidl_death_recipient>& recipient){
+    std::unique_lock<std::mutex> lock(_hidl_mMutex);
+    for (auto it = _hidl_mDeathRecipients.rbegin();it != _hidl_mDeathRecipients.rend();++it) {
+        if ((*it)->getRecipient() == recipient) {
+            ::android::status_t status = remote()->unlinkToDeath(*it);
+            _hidl_mDeathRecipients.erase(it.base()-1);
+            return status == ::android::OK;
+        }
+    }
+    return false;
+}
+
+
+BnHwChild::BnHwChild(const ::android::sp<IChild> &_hidl_impl)
+        : ::android::hidl::base::V1_0::BnHwBase(_hidl_impl, "golden.latency@1.0", "IChild") { 
+            _hidl_mImpl = _hidl_impl;
+            auto prio = ::android::hardware::details::gServicePrioMap->get(_hidl_impl, {SCHED_NORMAL, 0});
+            mSchedPolicy = prio.sched_policy;
+            mSchedPriority = prio.prio;
+            setRequestingSid(::android::hardware::details::gServiceSidMap->get(_hidl_impl, false));
+}
+
+BnHwChild::~BnHwChild() {
+    ::android::hardware::details::gBnMap->eraseIfEqual(_hidl_mImpl.get(), this);
+}
+
+// Methods from ::golden::latency::V1_0::IChild follow.
+::android::status_t BnHwChild::_hidl_put(
+        ::android::hidl::base::V1_0::BnHwBase* _hidl_this,
+        const ::android::hardware::Parcel &_hidl_data,
+        ::android::hardware::Parcel *_hidl_reply,
+        TransactCallback _hidl_cb) {
+    #ifdef __ANDROID_DEBUGGABLE__
+    bool mEnableInstrumentation = _hidl_this->isInstrumentationEnabled();
+    const auto &mInstrumentationCallbacks = _hidl_this->getInstrumentationCallbacks();
+    #endif // __ANDROID_DEBUGGABLE__
+
+    ::android::status_t _hidl_err = ::android::OK;
+    if (!_hidl_data.enforceInterface(BnHwChild::Pure::descriptor)) {
+        _hidl_err = ::android::BAD_TYPE;
+        return _hidl_err;
+    }
+
+    int32_t value;
+
+    _hidl_err = _hidl_data.readInt32(&value);
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    atrace_begin(ATRACE_TAG_HAL, "HIDL::IChild::put::server");
+    #ifdef __ANDROID_DEBUGGABLE__
+    if (UNLIKELY(mEnableInstrumentation)) {
+        void *_hidl_arg_pointers[] = {(void *)&value};
+        std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+        for (const auto &callback: mInstrumentationCallbacks) {
+            callback(InstrumentationEvent::SERVER_API_ENTRY, "golden.latency", "1.0", "IChild", "put", &_hidl_args);
+        }
+    }
+    #endif // __ANDROID_DEBUGGABLE__
+
+    ::android::hardware::Return<void> _hidl_ret = static_cast<IChild*>(_hidl_this->getImpl().get())->put(value);
+
+    (void) _hidl_cb;
+
+    atrace_end(ATRACE_TAG_HAL);
+    #ifdef __ANDROID_DEBUGGABLE__
+    if (UNLIKELY(mEnableInstrumentation)) {
+        std::vector<void *> _hidl_args;
+        for (const auto &callback: mInstrumentationCallbacks) {
+            callback(InstrumentationEvent::SERVER_API_EXIT, "golden.latency", "1.0", "IChild", "put", &_hidl_args);
+        }
+    }
+    #endif // __ANDROID_DEBUGGABLE__
+
+    _hidl_ret.assertOk();
+    ::android::hardware::writeToParcel(::android::hardware::Status::ok(), _hidl_reply);
+
+    return _hidl_err;
+}
+
+
+// Methods from ::golden::latency::V1_0::IParent follow.
+
+// Methods from ::golden::latency::V1_0::IChild follow.
+
+// Methods from ::android::hidl::base::V1_0::IBase follow.
+::android::hardware::Return<void> BnHwChild::ping() {
+    return ::android::hardware::Void();
+}
+::android::hardware::Return<void> BnHwChild::getDebugInfo(getDebugInfo_cb _hidl_cb) {
+    ::android::hidl::base::V1_0::DebugInfo info = {};
+    info.pid = ::android::hardware::details::getPidIfSharable();
+    info.ptr = ::android::hardware::details::debuggable()? reinterpret_cast<uint64_t>(this) : 0;
+    info.arch = 
+    #if defined(__LP64__)
+    ::android::hidl::base::V1_0::DebugInfo::Architecture::IS_64BIT
+    #else
+    ::android::hidl::base::V1_0::DebugInfo::Architecture::IS_32BIT
+    #endif
+    ;
+    _hidl_cb(info);
+    return ::android::hardware::Void();
+}
+
+::android::status_t BnHwChild::onTransact(
+        uint32_t _hidl_code,
+        const ::android::hardware::Parcel &_hidl_data,
+        ::android::hardware::Parcel *_hidl_reply,
+        uint32_t _hidl_flags,
+        TransactCallback _hidl_cb) {
+    ::android::status_t _hidl_err = ::android::OK;
+
+    static constexpr struct {
+        ::android::status_t (*method)(
+                ::android::hidl::base::V1_0::BnHwBase* _hidl_this,
+                const ::android::hardware::Parcel &_hidl_data,
+                ::android::hardware::Parcel *_hidl_reply,
+                TransactCallback _hidl_cb);
+        bool oneway;
+    } kMethods[] = {
+        {&::golden::latency::V1_0::BnHwParent::_hidl_get, false},  // 1: get
+        {&::golden::latency::V1_0::BnHwParent::_hidl_fire, true},  // 2: fire
+        {&::golden::latency::V1_0::BnHwChild::_hidl_put, false},  // 3: put
+    };
+
+    const uint32_t _hidl_index = _hidl_code - 1 /* FIRST_CALL_TRANSACTION */;
+    if (_hidl_index < 3) {
+        bool _hidl_is_oneway = _hidl_flags & 1u /* oneway */;
+        if (_hidl_is_oneway != kMethods[_hidl_index].oneway) {
+            return ::android::UNKNOWN_ERROR;
+        }
+
+        const auto _hidl_latency_start = std::chrono::steady_clock::now();
+        _hidl_err = kMethods[_hidl_index].method(this, _hidl_data, _hidl_reply, _hidl_cb);
+        IChild::_hidl_serverLatency[_hidl_index].record(_hidl_latency_start);
+    } else {
+        return ::android::hidl::base::V1_0::BnHwBase::onTransact(
+                _hidl_code, _hidl_data, _hidl_reply, _hidl_flags, _hidl_cb);
+    }
+
+    if (_hidl_err == ::android::UNEXPECTED_NULL) {
+        _hidl_err = ::android::hardware::writeToParcel(
+                ::android::hardware::Status::fromExceptionCode(::android::hardware::Status::EX_NULL_POINTER),
+                _hidl_reply);
+    }return _hidl_err;
+}
+
+struct BsChild::OnewayQueue : public std::enable_shared_from_this<OnewayQueue> {
+    struct Slot {
+        std::atomic<size_t> sequence;
+        std::function<void(void)> task;
+    };
+
+    explicit OnewayQueue(size_t capacity) : mCapacity(capacity), mSlots(new Slot[capacity]) {
+        for (size_t i = 0; i < mCapacity; i++) {
+            mSlots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool push(std::function<void(void)>&& task) {
+        std::call_once(mStarted, [self = shared_from_this()] {
+            std::thread([self] { self->run(); }).detach();
+        });
+
+        size_t tail = mTail.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = mSlots[tail % mCapacity];
+            const intptr_t diff = static_cast<intptr_t>(
+                    slot.sequence.load(std::memory_order_acquire) - tail);
+            if (diff == 0) {
+                if (mTail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) {
+                    slot.task = std::move(task);
+                    slot.sequence.store(tail + 1);
+                    break;
+                }
+            } else if (diff < 0) {
+                // the consumer has not emptied this slot yet
+                mDropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                tail = mTail.load(std::memory_order_relaxed);
+            }
+        }
+
+        if (mWaiting.load()) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mCondition.notify_one();
+        }
+        return true;
+    }
+
+    void stop() {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopped = true;
+        mCondition.notify_one();
+    }
+
+    void run() {
+        for (size_t head = 0;; head++) {
+            Slot& slot = mSlots[head % mCapacity];
+            auto ready = [&] { return slot.sequence.load() == head + 1; };
+            if (!ready()) {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mWaiting.store(true);
+                mCondition.wait(lock, [&] { return ready() || mStopped; });
+                mWaiting.store(false);
+                if (!ready()) return;
+            }
+            std::function<void(void)> task = std::move(slot.task);
+            slot.task = nullptr;
+            slot.sequence.store(head + mCapacity, std::memory_order_release);
+            mHead.store(head + 1, std::memory_order_relaxed);
+            task();
+        }
+    }
+
+    const size_t mCapacity;
+    const std::unique_ptr<Slot[]> mSlots;
+    std::atomic<size_t> mHead{0};
+    std::atomic<size_t> mTail{0};
+    std::atomic<uint64_t> mDropped{0};
+    std::atomic<bool> mWaiting{false};
+    std::once_flag mStarted;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    bool mStopped = false;
+};
+
+BsChild::BsChild(const ::android::sp<::golden::latency::V1_0::IChild> impl) : ::android::hardware::details::HidlInstrumentor("golden.latency@1.0", "IChild"), mImpl(impl),
+        mOnewayQueue(std::make_shared<OnewayQueue>(3000)) {}
+
+BsChild::~BsChild() {
+    // the consumer thread finishes the queued calls, then exits
+    mOnewayQueue->stop();
+}
+
+size_t BsChild::getOnewayQueueDepth() const {
+    return mOnewayQueue->mTail.load(std::memory_order_relaxed) -
+            mOnewayQueue->mHead.load(std::memory_order_relaxed);
+}
+
+uint64_t BsChild::getOnewayDropCount() const {
+    return mOnewayQueue->mDropped.load(std::memory_order_relaxed);
+}
+
+::android::hardware::Return<void> BsChild::addOnewayTask(std::function<void(void)>&& task) {
+    if (!mOnewayQueue->push(std::move(task))) {
+        return ::android::hardware::Status::fromExceptionCode(
+                ::android::hardware::Status::EX_TRANSACTION_FAILED,
+                "Passthrough oneway function queue exceeds maximum size.");
+    }
+    return ::android::hardware::Status();
+}
+
+::android::sp<IChild> IChild::tryGetService(const std::string &serviceName, const bool getStub) {
+    return ::android::hardware::details::getServiceInternal<BpHwChild>(serviceName, false, getStub);
+}
+
+::android::sp<IChild> IChild::getService(const std::string &serviceName, const bool getStub) {
+    return ::android::hardware::details::getServiceInternal<BpHwChild>(serviceName, true, getStub);
+}
+
+::android::status_t IChild::registerAsService(const std::string &serviceName) {
+    return ::android::hardware::details::registerAsServiceInternal(this, serviceName);
+}
+
+bool IChild::registerForNotifications(
+        const std::string &serviceName,
+        const ::android::sp<::android::hidl::manager::V1_0::IServiceNotification> &notification) {
+    const ::android::sp<::android::hidl::manager::V1_0::IServiceManager> sm
+            = ::android::hardware::defaultServiceManager();
+    if (sm == nullptr) {
+        return false;
+    }
+    ::android::hardware::Return<bool> success =
+            sm->registerForNotifications("golden.latency@1.0::IChild",
+                    serviceName, notification);
+    return success.isOk() && success;
+}
+
+static_assert(sizeof(::android::hardware::MQDescriptor<char, ::android::hardware::kSynchronizedReadWrite>) == 32, "wrong size");
+static_assert(sizeof(::android::hardware::hidl_handle) == 16, "wrong size");
+static_assert(sizeof(::android::hardware::hidl_memory) == 40, "wrong size");
+static_assert(sizeof(::android::hardware::hidl_string) == 16, "wrong size");
+static_assert(sizeof(::android::hardware::hidl_vec<char>) == 16, "wrong size");
+
+}  // namespace V1_0
+}  // namespace latency
+}  // namespace golden
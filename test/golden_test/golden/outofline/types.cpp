@@ -0,0 +1,734 @@
+#define LOG_TAG "golden@1.0::types"
+
+#include <log/log.h>
+#include <cutils/trace.h>
+#include <hidl/HidlTransportSupport.h>
+
+#include <hidl/Static.h>
+#include <hwbinder/ProcessState.h>
+#include <utils/Trace.h>
+#include <golden/1.0/types.h>
+#include <golden/1.0/hwtypes.h>
+
+namespace golden {
+namespace V1_0 {
+
+::android::status_t readEmbeddedFromParcel(
+        const Shape &obj,
+        const ::android::hardware::Parcel &parcel,
+        size_t parentHandle,
+        size_t parentOffset) {
+    ::android::status_t _hidl_err = ::android::OK;
+
+    _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+            const_cast<::android::hardware::hidl_string &>(obj.name),
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Shape, name));
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_points_child;
+
+    _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+            const_cast<::android::hardware::hidl_vec<::golden::V1_0::Point> &>(obj.points),
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Shape, points), &_hidl_points_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_data_child;
+
+    _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+            const_cast<::android::hardware::hidl_vec<uint8_t> &>(obj.data),
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Shape, data), &_hidl_data_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_tags_child;
+
+    _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+            const_cast<::android::hardware::hidl_vec<::android::hardware::hidl_string> &>(obj.tags),
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Shape, tags), &_hidl_tags_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < obj.tags.size(); ++_hidl_index_0) {
+        _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+                const_cast<::android::hardware::hidl_string &>(obj.tags[_hidl_index_0]),
+                parcel,
+                _hidl_tags_child,
+                _hidl_index_0 * sizeof(::android::hardware::hidl_string));
+
+        if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    }
+
+    return _hidl_err;
+}
+
+::android::status_t writeEmbeddedToParcel(
+        const Shape &obj,
+        ::android::hardware::Parcel *parcel,
+        size_t parentHandle,
+        size_t parentOffset) {
+    ::android::status_t _hidl_err = ::android::OK;
+
+    _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+            obj.name,
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Shape, name));
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_points_child;
+
+    _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+            obj.points,
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Shape, points), &_hidl_points_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_data_child;
+
+    _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+            obj.data,
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Shape, data), &_hidl_data_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_tags_child;
+
+    _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+            obj.tags,
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Shape, tags), &_hidl_tags_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < obj.tags.size(); ++_hidl_index_0) {
+        _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+                obj.tags[_hidl_index_0],
+                parcel,
+                _hidl_tags_child,
+                _hidl_index_0 * sizeof(::android::hardware::hidl_string));
+
+        if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    }
+
+    return _hidl_err;
+}
+
+::android::status_t readEmbeddedFromParcel(
+        const Scene &obj,
+        const ::android::hardware::Parcel &parcel,
+        size_t parentHandle,
+        size_t parentOffset) {
+    ::android::status_t _hidl_err = ::android::OK;
+
+    size_t _hidl_shapes_child;
+
+    _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+            const_cast<::android::hardware::hidl_vec<::golden::V1_0::Shape> &>(obj.shapes),
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Scene, shapes), &_hidl_shapes_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < obj.shapes.size(); ++_hidl_index_0) {
+        _hidl_err = readEmbeddedFromParcel(
+                const_cast<::golden::V1_0::Shape &>(obj.shapes[_hidl_index_0]),
+                parcel,
+                _hidl_shapes_child,
+                _hidl_index_0 * sizeof(::golden::V1_0::Shape));
+
+        if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    }
+
+    size_t _hidl_ids_child;
+
+    _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+            const_cast<::android::hardware::hidl_vec<int32_t> &>(obj.ids),
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Scene, ids), &_hidl_ids_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    return _hidl_err;
+}
+
+::android::status_t writeEmbeddedToParcel(
+        const Scene &obj,
+        ::android::hardware::Parcel *parcel,
+        size_t parentHandle,
+        size_t parentOffset) {
+    ::android::status_t _hidl_err = ::android::OK;
+
+    size_t _hidl_shapes_child;
+
+    _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+            obj.shapes,
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Scene, shapes), &_hidl_shapes_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < obj.shapes.size(); ++_hidl_index_0) {
+        _hidl_err = writeEmbeddedToParcel(
+                obj.shapes[_hidl_index_0],
+                parcel,
+                _hidl_shapes_child,
+                _hidl_index_0 * sizeof(::golden::V1_0::Shape));
+
+        if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    }
+
+    size_t _hidl_ids_child;
+
+    _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+            obj.ids,
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Scene, ids), &_hidl_ids_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    return _hidl_err;
+}
+
+::android::status_t readEmbeddedFromParcel(
+        const Samples &obj,
+        const ::android::hardware::Parcel &parcel,
+        size_t parentHandle,
+        size_t parentOffset) {
+    ::android::status_t _hidl_err = ::android::OK;
+
+    size_t _hidl_values_child;
+
+    _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+            const_cast<::android::hardware::hidl_vec<int16_t> &>(obj.values),
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Samples, values), &_hidl_values_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_colors_child;
+
+    _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+            const_cast<::android::hardware::hidl_vec<::golden::V1_0::Color> &>(obj.colors),
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Samples, colors), &_hidl_colors_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_labels_child;
+
+    _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+            const_cast<::android::hardware::hidl_vec<::android::hardware::hidl_string> &>(obj.labels),
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Samples, labels), &_hidl_labels_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < obj.labels.size(); ++_hidl_index_0) {
+        _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+                const_cast<::android::hardware::hidl_string &>(obj.labels[_hidl_index_0]),
+                parcel,
+                _hidl_labels_child,
+                _hidl_index_0 * sizeof(::android::hardware::hidl_string));
+
+        if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    }
+
+    return _hidl_err;
+}
+
+::android::status_t writeEmbeddedToParcel(
+        const Samples &obj,
+        ::android::hardware::Parcel *parcel,
+        size_t parentHandle,
+        size_t parentOffset) {
+    ::android::status_t _hidl_err = ::android::OK;
+
+    size_t _hidl_values_child;
+
+    _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+            obj.values,
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Samples, values), &_hidl_values_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_colors_child;
+
+    _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+            obj.colors,
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Samples, colors), &_hidl_colors_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_labels_child;
+
+    _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+            obj.labels,
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Samples, labels), &_hidl_labels_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < obj.labels.size(); ++_hidl_index_0) {
+        _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+                obj.labels[_hidl_index_0],
+                parcel,
+                _hidl_labels_child,
+                _hidl_index_0 * sizeof(::android::hardware::hidl_string));
+
+        if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    }
+
+    return _hidl_err;
+}
+
+template<>
+std::string toString<::golden::V1_0::Color>(int32_t o) {
+    using ::android::hardware::details::toHexString;
+    static constexpr struct {
+        int32_t value;
+        const char* name;
+    } kValues[] = {
+        {static_cast<int32_t>(::golden::V1_0::Color::RED), "RED"},
+        {static_cast<int32_t>(::golden::V1_0::Color::GREEN), "GREEN"},
+        {static_cast<int32_t>(::golden::V1_0::Color::BLUE), "BLUE"},
+        {static_cast<int32_t>(::golden::V1_0::Color::CRIMSON), "CRIMSON"},
+    };
+    std::string os;
+    ::android::hardware::hidl_bitfield<::golden::V1_0::Color> flipped = 0;
+    for (const auto& value : kValues) {
+        if ((o & value.value) == value.value) {
+            os += (os.empty() ? "" : " | ");
+            os += value.name;
+            flipped |= value.value;
+        }
+    }
+    if (o != flipped) {
+        os += (os.empty() ? "" : " | ");
+        os += toHexString(o & (~flipped));
+    }
+    os += " (";
+    os += toHexString(o);
+    os += ")";
+    return os;
+}
+
+std::string toString(::golden::V1_0::Color o) {
+    using ::android::hardware::details::toHexString;
+    switch (o) {
+        case ::golden::V1_0::Color::RED:
+            return "RED";
+        case ::golden::V1_0::Color::GREEN:
+            return "GREEN";
+        case ::golden::V1_0::Color::BLUE:
+            return "BLUE";
+        default:
+            break;
+    }
+    std::string os;
+    os += toHexString(static_cast<int32_t>(o));
+    return os;
+}
+
+template<>
+std::string toString<::golden::V1_0::Flag>(uint8_t o) {
+    using ::android::hardware::details::toHexString;
+    static constexpr struct {
+        uint8_t value;
+        const char* name;
+    } kValues[] = {
+        {static_cast<uint8_t>(::golden::V1_0::Flag::NONE), "NONE"},
+        {static_cast<uint8_t>(::golden::V1_0::Flag::A), "A"},
+        {static_cast<uint8_t>(::golden::V1_0::Flag::B), "B"},
+        {static_cast<uint8_t>(::golden::V1_0::Flag::AB), "AB"},
+    };
+    std::string os;
+    ::android::hardware::hidl_bitfield<::golden::V1_0::Flag> flipped = 0;
+    for (const auto& value : kValues) {
+        if ((o & value.value) == value.value) {
+            os += (os.empty() ? "" : " | ");
+            os += value.name;
+            flipped |= value.value;
+        }
+    }
+    if (o != flipped) {
+        os += (os.empty() ? "" : " | ");
+        os += toHexString(o & (~flipped));
+    }
+    os += " (";
+    os += toHexString(o);
+    os += ")";
+    return os;
+}
+
+std::string toString(::golden::V1_0::Flag o) {
+    using ::android::hardware::details::toHexString;
+    switch (o) {
+        case ::golden::V1_0::Flag::NONE:
+            return "NONE";
+        case ::golden::V1_0::Flag::A:
+            return "A";
+        case ::golden::V1_0::Flag::B:
+            return "B";
+        case ::golden::V1_0::Flag::AB:
+            return "AB";
+        default:
+            break;
+    }
+    std::string os;
+    os += toHexString(static_cast<uint8_t>(o));
+    return os;
+}
+
+template<>
+std::string toString<::golden::V1_0::Access>(int8_t o) {
+    using ::android::hardware::details::toHexString;
+    static constexpr const char* kBitNames[] = {
+        "READ",
+        "WRITE",
+        nullptr,
+        "EXECUTE",
+        nullptr,
+        nullptr,
+        nullptr,
+        "SETUID",
+    };
+    std::string os = "NO_ACCESS";
+    const int8_t flipped = o & static_cast<int8_t>(0x8bull);
+    for (uint64_t bits = static_cast<uint64_t>(o) & 0x8bull; bits != 0; bits &= bits - 1) {
+        os += (os.empty() ? "" : " | ");
+        os += kBitNames[__builtin_ctzll(bits)];
+    }
+    if (o != flipped) {
+        os += (os.empty() ? "" : " | ");
+        os += toHexString(o & (~flipped));
+    }
+    os += " (";
+    os += toHexString(o);
+    os += ")";
+    return os;
+}
+
+std::string toString(::golden::V1_0::Access o) {
+    using ::android::hardware::details::toHexString;
+    switch (o) {
+        case ::golden::V1_0::Access::NO_ACCESS:
+            return "NO_ACCESS";
+        case ::golden::V1_0::Access::READ:
+            return "READ";
+        case ::golden::V1_0::Access::WRITE:
+            return "WRITE";
+        case ::golden::V1_0::Access::EXECUTE:
+            return "EXECUTE";
+        case ::golden::V1_0::Access::SETUID:
+            return "SETUID";
+        default:
+            break;
+    }
+    std::string os;
+    os += toHexString(static_cast<int8_t>(o));
+    return os;
+}
+
+void appendToString(std::string& os, const ::golden::V1_0::Point& o) {
+    using ::android::hardware::toString;
+    os += "{";
+    os += ".x = ";
+    os += ::android::hardware::toString(o.x);
+    os += ", .y = ";
+    os += ::android::hardware::toString(o.y);
+    os += "}";
+}
+
+std::string toString(const ::golden::V1_0::Point& o) {
+    std::string os;
+    appendToString(os, o);
+    return os;
+}
+
+bool operator==(const ::golden::V1_0::Point& lhs, const ::golden::V1_0::Point& rhs) {
+    static_assert(sizeof(::golden::V1_0::Point) == 8, "unexpected padding");
+    return memcmp(&lhs, &rhs, sizeof(lhs)) == 0;
+}
+
+bool operator!=(const ::golden::V1_0::Point& lhs, const ::golden::V1_0::Point& rhs){
+    return !(lhs == rhs);
+}
+
+void appendToString(std::string& os, const ::golden::V1_0::Shape::Nested& o) {
+    using ::android::hardware::toString;
+    os += "{";
+    os += ".a = ";
+    os += ::android::hardware::toString(o.a);
+    os += ", .b = ";
+    os += ::android::hardware::toString(o.b);
+    os += "}";
+}
+
+std::string toString(const ::golden::V1_0::Shape::Nested& o) {
+    std::string os;
+    appendToString(os, o);
+    return os;
+}
+
+bool operator==(const ::golden::V1_0::Shape::Nested& lhs, const ::golden::V1_0::Shape::Nested& rhs) {
+    if (lhs.a != rhs.a) {
+        return false;
+    }
+    if (lhs.b != rhs.b) {
+        return false;
+    }
+    return true;
+}
+
+bool operator!=(const ::golden::V1_0::Shape::Nested& lhs, const ::golden::V1_0::Shape::Nested& rhs){
+    return !(lhs == rhs);
+}
+
+void appendToString(std::string& os, const ::golden::V1_0::Shape& o) {
+    using ::android::hardware::toString;
+    os += "{";
+    os += ".name = ";
+    os += ::android::hardware::toString(o.name);
+    os += ", .color = ";
+    os += ::golden::V1_0::toString(o.color);
+    os += ", .flags = ";
+    os += ::golden::V1_0::toString<::golden::V1_0::Flag>(o.flags);
+    os += ", .corners = ";
+    os += "[2]";
+    os += "{";
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < 2; ++_hidl_index_0) {
+        if (_hidl_index_0 > 0) {
+            os += ", ";
+        }
+        ::golden::V1_0::appendToString(os, o.corners[_hidl_index_0]);
+    }
+    os += "}";
+    os += ", .points = ";
+    os += "[";
+    os += std::to_string(o.points.size());
+    os += "]{";
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < o.points.size(); ++_hidl_index_0) {
+        if (_hidl_index_0 > 0) {
+            os += ", ";
+        }
+        ::golden::V1_0::appendToString(os, o.points[_hidl_index_0]);
+    }
+    os += "}";
+    os += ", .data = ";
+    os += ::android::hardware::toString(o.data);
+    os += ", .tags = ";
+    os += ::android::hardware::toString(o.tags);
+    os += ", .nested = ";
+    ::golden::V1_0::appendToString(os, o.nested);
+    os += "}";
+}
+
+std::string toString(const ::golden::V1_0::Shape& o) {
+    std::string os;
+    appendToString(os, o);
+    return os;
+}
+
+bool operator==(const ::golden::V1_0::Shape& lhs, const ::golden::V1_0::Shape& rhs) {
+    if (lhs.name != rhs.name) {
+        return false;
+    }
+    if (lhs.color != rhs.color) {
+        return false;
+    }
+    if (lhs.flags != rhs.flags) {
+        return false;
+    }
+    if (lhs.corners != rhs.corners) {
+        return false;
+    }
+    if (lhs.points != rhs.points) {
+        return false;
+    }
+    if (lhs.data != rhs.data) {
+        return false;
+    }
+    if (lhs.tags != rhs.tags) {
+        return false;
+    }
+    if (lhs.nested != rhs.nested) {
+        return false;
+    }
+    return true;
+}
+
+bool operator!=(const ::golden::V1_0::Shape& lhs, const ::golden::V1_0::Shape& rhs){
+    return !(lhs == rhs);
+}
+
+void appendToString(std::string& os, const ::golden::V1_0::Scene& o) {
+    using ::android::hardware::toString;
+    os += "{";
+    os += ".shapes = ";
+    os += "[";
+    os += std::to_string(o.shapes.size());
+    os += "]{";
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < o.shapes.size(); ++_hidl_index_0) {
+        if (_hidl_index_0 > 0) {
+            os += ", ";
+        }
+        ::golden::V1_0::appendToString(os, o.shapes[_hidl_index_0]);
+    }
+    os += "}";
+    os += ", .ids = ";
+    os += ::android::hardware::toString(o.ids);
+    os += "}";
+}
+
+std::string toString(const ::golden::V1_0::Scene& o) {
+    std::string os;
+    appendToString(os, o);
+    return os;
+}
+
+bool operator==(const ::golden::V1_0::Scene& lhs, const ::golden::V1_0::Scene& rhs) {
+    if (lhs.shapes != rhs.shapes) {
+        return false;
+    }
+    if (lhs.ids != rhs.ids) {
+        return false;
+    }
+    return true;
+}
+
+bool operator!=(const ::golden::V1_0::Scene& lhs, const ::golden::V1_0::Scene& rhs){
+    return !(lhs == rhs);
+}
+
+void appendToString(std::string& os, const ::golden::V1_0::Samples& o) {
+    using ::android::hardware::toString;
+    os += "{";
+    os += ".rate = ";
+    os += ::android::hardware::toString(o.rate);
+    os += ", .values = ";
+    os += ::android::hardware::toString(o.values);
+    os += ", .colors = ";
+    os += ::android::hardware::toString(o.colors);
+    os += ", .labels = ";
+    os += ::android::hardware::toString(o.labels);
+    os += "}";
+}
+
+std::string toString(const ::golden::V1_0::Samples& o) {
+    std::string os;
+    appendToString(os, o);
+    return os;
+}
+
+bool operator==(const ::golden::V1_0::Samples& lhs, const ::golden::V1_0::Samples& rhs) {
+    if (lhs.rate != rhs.rate) {
+        return false;
+    }
+    if (lhs.values != rhs.values) {
+        return false;
+    }
+    if (lhs.colors != rhs.colors) {
+        return false;
+    }
+    if (lhs.labels != rhs.labels) {
+        return false;
+    }
+    return true;
+}
+
+bool operator!=(const ::golden::V1_0::Samples& lhs, const ::golden::V1_0::Samples& rhs){
+    return !(lhs == rhs);
+}
+
+static_assert(sizeof(::android::hardware::MQDescriptor<char, ::android::hardware::kSynchronizedReadWrite>) == 32, "wrong size");
+static_assert(sizeof(::android::hardware::hidl_handle) == 16, "wrong size");
+static_assert(sizeof(::android::hardware::hidl_memory) == 40, "wrong size");
+static_assert(sizeof(::android::hardware::hidl_string) == 16, "wrong size");
+static_assert(sizeof(::android::hardware::hidl_vec<char>) == 16, "wrong size");
+
+}  // namespace V1_0
+}  // namespace golden
+
+size_t std::hash<::golden::V1_0::Point>::operator()(const ::golden::V1_0::Point& o) const {
+    return ::android::hardware::details::hidl_hash_bytes(&o, sizeof(o));
+}
+
+size_t std::hash<::golden::V1_0::Shape::Nested>::operator()(const ::golden::V1_0::Shape::Nested& o) const {
+    size_t _hidl_hash = 0;
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::std::hash<uint8_t>{}(o.a));
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::std::hash<int64_t>{}(o.b));
+    return _hidl_hash;
+}
+
+size_t std::hash<::golden::V1_0::Shape>::operator()(const ::golden::V1_0::Shape& o) const {
+    size_t _hidl_hash = 0;
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::android::hardware::details::hidl_hash_bytes(o.name.c_str(), o.name.size()));
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::std::hash<::golden::V1_0::Color>{}(o.color));
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::std::hash<::android::hardware::hidl_bitfield<::golden::V1_0::Flag>>{}(o.flags));
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::android::hardware::details::hidl_hash_bytes(&o.corners, sizeof(o.corners)));
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::android::hardware::details::hidl_hash_bytes(o.points.data(), o.points.size() * sizeof(::golden::V1_0::Point)));
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::android::hardware::details::hidl_hash_bytes(o.data.data(), o.data.size() * sizeof(uint8_t)));
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, o.tags.size());
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < o.tags.size(); ++_hidl_index_0) {
+        _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::android::hardware::details::hidl_hash_bytes(o.tags[_hidl_index_0].c_str(), o.tags[_hidl_index_0].size()));
+    }
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::std::hash<::golden::V1_0::Shape::Nested>{}(o.nested));
+    return _hidl_hash;
+}
+
+size_t std::hash<::golden::V1_0::Scene>::operator()(const ::golden::V1_0::Scene& o) const {
+    size_t _hidl_hash = 0;
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, o.shapes.size());
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < o.shapes.size(); ++_hidl_index_0) {
+        _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::std::hash<::golden::V1_0::Shape>{}(o.shapes[_hidl_index_0]));
+    }
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::android::hardware::details::hidl_hash_bytes(o.ids.data(), o.ids.size() * sizeof(int32_t)));
+    return _hidl_hash;
+}
+
+size_t std::hash<::golden::V1_0::Samples>::operator()(const ::golden::V1_0::Samples& o) const {
+    size_t _hidl_hash = 0;
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::std::hash<uint32_t>{}(o.rate));
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::android::hardware::details::hidl_hash_bytes(o.values.data(), o.values.size() * sizeof(int16_t)));
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::android::hardware::details::hidl_hash_bytes(o.colors.data(), o.colors.size() * sizeof(::golden::V1_0::Color)));
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, o.labels.size());
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < o.labels.size(); ++_hidl_index_0) {
+        _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::android::hardware::details::hidl_hash_bytes(o.labels[_hidl_index_0].c_str(), o.labels[_hidl_index_0].size()));
+    }
+    return _hidl_hash;
+}
+
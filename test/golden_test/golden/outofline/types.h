@@ -0,0 +1,382 @@
+#ifndef HIDL_GENERATED_GOLDEN_V1_0_TYPES_H
+#define HIDL_GENERATED_GOLDEN_V1_0_TYPES_H
+
+#include <string.h>
+#include <functional>
+
+#include <hidl/HidlSupport.h>
+#include <hidl/MQDescriptor.h>
+#include <utils/NativeHandle.h>
+#include <utils/misc.h>
+
+namespace golden {
+namespace V1_0 {
+
+// Forward declaration for forward reference support:
+enum class Color : int32_t;
+enum class Flag : uint8_t;
+enum class Access : int8_t;
+struct Point;
+struct Shape;
+struct Scene;
+struct Samples;
+
+enum class Color : int32_t {
+    RED = 0,
+    GREEN = 5,
+    BLUE = 6 /* (::golden::V1_0::Color.GREEN implicitly + 1) */,
+    CRIMSON = 0 /* RED */,
+};
+
+enum class Flag : uint8_t {
+    NONE = 0,
+    A = 1 /* (1 << 0) */,
+    B = 2 /* (1 << 1) */,
+    AB = 3 /* (A | B) */,
+};
+
+enum class Access : int8_t {
+    NO_ACCESS = 0,
+    READ = 1 /* (1 << 0) */,
+    WRITE = 2 /* (1 << 1) */,
+    EXECUTE = 8 /* (1 << 3) */,
+    SETUID = -128 /* (1 << 7) */,
+};
+
+struct Point final {
+    int32_t x __attribute__ ((aligned(4)));
+    int32_t y __attribute__ ((aligned(4)));
+};
+
+static_assert(offsetof(::golden::V1_0::Point, x) == 0, "wrong offset");
+static_assert(offsetof(::golden::V1_0::Point, y) == 4, "wrong offset");
+static_assert(sizeof(::golden::V1_0::Point) == 8, "wrong size");
+static_assert(__alignof(::golden::V1_0::Point) == 4, "wrong alignment");
+
+struct Shape final {
+    // Forward declaration for forward reference support:
+    struct Nested;
+
+    struct Nested final {
+        uint8_t a __attribute__ ((aligned(1)));
+        int64_t b __attribute__ ((aligned(8)));
+    };
+
+    static_assert(offsetof(::golden::V1_0::Shape::Nested, a) == 0, "wrong offset");
+    static_assert(offsetof(::golden::V1_0::Shape::Nested, b) == 8, "wrong offset");
+    static_assert(sizeof(::golden::V1_0::Shape::Nested) == 16, "wrong size");
+    static_assert(__alignof(::golden::V1_0::Shape::Nested) == 8, "wrong alignment");
+
+    ::android::hardware::hidl_string name __attribute__ ((aligned(8)));
+    ::golden::V1_0::Color color __attribute__ ((aligned(4)));
+    ::android::hardware::hidl_bitfield<::golden::V1_0::Flag> flags __attribute__ ((aligned(1)));
+    ::android::hardware::hidl_array<::golden::V1_0::Point, 2> corners __attribute__ ((aligned(4)));
+    ::android::hardware::hidl_vec<::golden::V1_0::Point> points __attribute__ ((aligned(8)));
+    ::android::hardware::hidl_vec<uint8_t> data __attribute__ ((aligned(8)));
+    ::android::hardware::hidl_vec<::android::hardware::hidl_string> tags __attribute__ ((aligned(8)));
+    ::golden::V1_0::Shape::Nested nested __attribute__ ((aligned(8)));
+};
+
+static_assert(offsetof(::golden::V1_0::Shape, name) == 0, "wrong offset");
+static_assert(offsetof(::golden::V1_0::Shape, color) == 16, "wrong offset");
+static_assert(offsetof(::golden::V1_0::Shape, flags) == 20, "wrong offset");
+static_assert(offsetof(::golden::V1_0::Shape, corners) == 24, "wrong offset");
+static_assert(offsetof(::golden::V1_0::Shape, points) == 40, "wrong offset");
+static_assert(offsetof(::golden::V1_0::Shape, data) == 56, "wrong offset");
+static_assert(offsetof(::golden::V1_0::Shape, tags) == 72, "wrong offset");
+static_assert(offsetof(::golden::V1_0::Shape, nested) == 88, "wrong offset");
+static_assert(sizeof(::golden::V1_0::Shape) == 104, "wrong size");
+static_assert(__alignof(::golden::V1_0::Shape) == 8, "wrong alignment");
+
+struct Scene final {
+    ::android::hardware::hidl_vec<::golden::V1_0::Shape> shapes __attribute__ ((aligned(8)));
+    ::android::hardware::hidl_vec<int32_t> ids __attribute__ ((aligned(8)));
+};
+
+static_assert(offsetof(::golden::V1_0::Scene, shapes) == 0, "wrong offset");
+static_assert(offsetof(::golden::V1_0::Scene, ids) == 16, "wrong offset");
+static_assert(sizeof(::golden::V1_0::Scene) == 32, "wrong size");
+static_assert(__alignof(::golden::V1_0::Scene) == 8, "wrong alignment");
+
+struct Samples final {
+    uint32_t rate __attribute__ ((aligned(4)));
+    ::android::hardware::hidl_vec<int16_t> values __attribute__ ((aligned(8)));
+    ::android::hardware::hidl_vec<::golden::V1_0::Color> colors __attribute__ ((aligned(8)));
+    ::android::hardware::hidl_vec<::android::hardware::hidl_string> labels __attribute__ ((aligned(8)));
+};
+
+static_assert(offsetof(::golden::V1_0::Samples, rate) == 0, "wrong offset");
+static_assert(offsetof(::golden::V1_0::Samples, values) == 8, "wrong offset");
+static_assert(offsetof(::golden::V1_0::Samples, colors) == 24, "wrong offset");
+static_assert(offsetof(::golden::V1_0::Samples, labels) == 40, "wrong offset");
+static_assert(sizeof(::golden::V1_0::Samples) == 56, "wrong size");
+static_assert(__alignof(::golden::V1_0::Samples) == 8, "wrong alignment");
+
+typedef ::android::hardware::hidl_vec<::golden::V1_0::Shape> Shapes;
+
+//
+// type declarations for package
+//
+
+template<typename>
+std::string toString(int32_t o);
+template<>
+std::string toString<::golden::V1_0::Color>(int32_t o);
+std::string toString(::golden::V1_0::Color o);
+
+constexpr int32_t operator|(const ::golden::V1_0::Color lhs, const ::golden::V1_0::Color rhs) {
+    return static_cast<int32_t>(static_cast<int32_t>(lhs) | static_cast<int32_t>(rhs));
+}
+constexpr int32_t operator|(const int32_t lhs, const ::golden::V1_0::Color rhs) {
+    return static_cast<int32_t>(lhs | static_cast<int32_t>(rhs));
+}
+constexpr int32_t operator|(const ::golden::V1_0::Color lhs, const int32_t rhs) {
+    return static_cast<int32_t>(static_cast<int32_t>(lhs) | rhs);
+}
+constexpr int32_t operator&(const ::golden::V1_0::Color lhs, const ::golden::V1_0::Color rhs) {
+    return static_cast<int32_t>(static_cast<int32_t>(lhs) & static_cast<int32_t>(rhs));
+}
+constexpr int32_t operator&(const int32_t lhs, const ::golden::V1_0::Color rhs) {
+    return static_cast<int32_t>(lhs & static_cast<int32_t>(rhs));
+}
+constexpr int32_t operator&(const ::golden::V1_0::Color lhs, const int32_t rhs) {
+    return static_cast<int32_t>(static_cast<int32_t>(lhs) & rhs);
+}
+constexpr int32_t &operator|=(int32_t& v, const ::golden::V1_0::Color e) {
+    v |= static_cast<int32_t>(e);
+    return v;
+}
+constexpr int32_t &operator&=(int32_t& v, const ::golden::V1_0::Color e) {
+    v &= static_cast<int32_t>(e);
+    return v;
+}
+
+template<typename>
+std::string toString(uint8_t o);
+template<>
+std::string toString<::golden::V1_0::Flag>(uint8_t o);
+std::string toString(::golden::V1_0::Flag o);
+
+constexpr uint8_t operator|(const ::golden::V1_0::Flag lhs, const ::golden::V1_0::Flag rhs) {
+    return static_cast<uint8_t>(static_cast<uint8_t>(lhs) | static_cast<uint8_t>(rhs));
+}
+constexpr uint8_t operator|(const uint8_t lhs, const ::golden::V1_0::Flag rhs) {
+    return static_cast<uint8_t>(lhs | static_cast<uint8_t>(rhs));
+}
+constexpr uint8_t operator|(const ::golden::V1_0::Flag lhs, const uint8_t rhs) {
+    return static_cast<uint8_t>(static_cast<uint8_t>(lhs) | rhs);
+}
+constexpr uint8_t operator&(const ::golden::V1_0::Flag lhs, const ::golden::V1_0::Flag rhs) {
+    return static_cast<uint8_t>(static_cast<uint8_t>(lhs) & static_cast<uint8_t>(rhs));
+}
+constexpr uint8_t operator&(const uint8_t lhs, const ::golden::V1_0::Flag rhs) {
+    return static_cast<uint8_t>(lhs & static_cast<uint8_t>(rhs));
+}
+constexpr uint8_t operator&(const ::golden::V1_0::Flag lhs, const uint8_t rhs) {
+    return static_cast<uint8_t>(static_cast<uint8_t>(lhs) & rhs);
+}
+constexpr uint8_t &operator|=(uint8_t& v, const ::golden::V1_0::Flag e) {
+    v |= static_cast<uint8_t>(e);
+    return v;
+}
+constexpr uint8_t &operator&=(uint8_t& v, const ::golden::V1_0::Flag e) {
+    v &= static_cast<uint8_t>(e);
+    return v;
+}
+
+template<typename>
+std::string toString(int8_t o);
+template<>
+std::string toString<::golden::V1_0::Access>(int8_t o);
+std::string toString(::golden::V1_0::Access o);
+
+constexpr int8_t operator|(const ::golden::V1_0::Access lhs, const ::golden::V1_0::Access rhs) {
+    return static_cast<int8_t>(static_cast<int8_t>(lhs) | static_cast<int8_t>(rhs));
+}
+constexpr int8_t operator|(const int8_t lhs, const ::golden::V1_0::Access rhs) {
+    return static_cast<int8_t>(lhs | static_cast<int8_t>(rhs));
+}
+constexpr int8_t operator|(const ::golden::V1_0::Access lhs, const int8_t rhs) {
+    return static_cast<int8_t>(static_cast<int8_t>(lhs) | rhs);
+}
+constexpr int8_t operator&(const ::golden::V1_0::Access lhs, const ::golden::V1_0::Access rhs) {
+    return static_cast<int8_t>(static_cast<int8_t>(lhs) & static_cast<int8_t>(rhs));
+}
+constexpr int8_t operator&(const int8_t lhs, const ::golden::V1_0::Access rhs) {
+    return static_cast<int8_t>(lhs & static_cast<int8_t>(rhs));
+}
+constexpr int8_t operator&(const ::golden::V1_0::Access lhs, const int8_t rhs) {
+    return static_cast<int8_t>(static_cast<int8_t>(lhs) & rhs);
+}
+constexpr int8_t &operator|=(int8_t& v, const ::golden::V1_0::Access e) {
+    v |= static_cast<int8_t>(e);
+    return v;
+}
+constexpr int8_t &operator&=(int8_t& v, const ::golden::V1_0::Access e) {
+    v &= static_cast<int8_t>(e);
+    return v;
+}
+
+void appendToString(std::string& os, const ::golden::V1_0::Point& o);
+std::string toString(const ::golden::V1_0::Point& o);
+bool operator==(const ::golden::V1_0::Point& lhs, const ::golden::V1_0::Point& rhs);
+bool operator!=(const ::golden::V1_0::Point& lhs, const ::golden::V1_0::Point& rhs);
+
+void appendToString(std::string& os, const ::golden::V1_0::Shape::Nested& o);
+std::string toString(const ::golden::V1_0::Shape::Nested& o);
+bool operator==(const ::golden::V1_0::Shape::Nested& lhs, const ::golden::V1_0::Shape::Nested& rhs);
+bool operator!=(const ::golden::V1_0::Shape::Nested& lhs, const ::golden::V1_0::Shape::Nested& rhs);
+
+void appendToString(std::string& os, const ::golden::V1_0::Shape& o);
+std::string toString(const ::golden::V1_0::Shape& o);
+bool operator==(const ::golden::V1_0::Shape& lhs, const ::golden::V1_0::Shape& rhs);
+bool operator!=(const ::golden::V1_0::Shape& lhs, const ::golden::V1_0::Shape& rhs);
+
+void appendToString(std::string& os, const ::golden::V1_0::Scene& o);
+std::string toString(const ::golden::V1_0::Scene& o);
+bool operator==(const ::golden::V1_0::Scene& lhs, const ::golden::V1_0::Scene& rhs);
+bool operator!=(const ::golden::V1_0::Scene& lhs, const ::golden::V1_0::Scene& rhs);
+
+void appendToString(std::string& os, const ::golden::V1_0::Samples& o);
+std::string toString(const ::golden::V1_0::Samples& o);
+bool operator==(const ::golden::V1_0::Samples& lhs, const ::golden::V1_0::Samples& rhs);
+bool operator!=(const ::golden::V1_0::Samples& lhs, const ::golden::V1_0::Samples& rhs);
+
+//
+// type header definitions for package
+//
+
+
+}  // namespace V1_0
+}  // namespace golden
+
+//
+// global type declarations for package
+//
+
+#ifndef HIDL_GENERATED_HASH_SUPPORT
+#define HIDL_GENERATED_HASH_SUPPORT
+
+namespace android {
+namespace hardware {
+namespace details {
+
+inline size_t hidl_hash_combine(size_t seed, size_t value) {
+    return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+inline size_t hidl_hash_bytes(const void* data, size_t size) {
+    static constexpr uint64_t kMul = 0x9ddfea08eb382d69ull;
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    uint64_t hash = 0xcbf29ce484222325ull ^ size;
+    uint64_t word;
+    for (; size >= sizeof(word); bytes += sizeof(word), size -= sizeof(word)) {
+        memcpy(&word, bytes, sizeof(word));
+        hash = (hash ^ word) * kMul;
+        hash ^= hash >> 47;
+    }
+    if (size > 0) {
+        word = 0;
+        memcpy(&word, bytes, size);
+        hash = (hash ^ word) * kMul;
+        hash ^= hash >> 47;
+    }
+    return static_cast<size_t>(hash);
+}
+
+}  // namespace details
+}  // namespace hardware
+}  // namespace android
+
+#endif  // HIDL_GENERATED_HASH_SUPPORT
+
+namespace android {
+namespace hardware {
+namespace details {
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wc++17-extensions"
+template<> inline constexpr std::array<::golden::V1_0::Color, 4> hidl_enum_values<::golden::V1_0::Color> = {
+    ::golden::V1_0::Color::RED,
+    ::golden::V1_0::Color::GREEN,
+    ::golden::V1_0::Color::BLUE,
+    ::golden::V1_0::Color::CRIMSON,
+};
+#pragma clang diagnostic pop
+}  // namespace details
+}  // namespace hardware
+}  // namespace android
+
+namespace android {
+namespace hardware {
+namespace details {
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wc++17-extensions"
+template<> inline constexpr std::array<::golden::V1_0::Flag, 4> hidl_enum_values<::golden::V1_0::Flag> = {
+    ::golden::V1_0::Flag::NONE,
+    ::golden::V1_0::Flag::A,
+    ::golden::V1_0::Flag::B,
+    ::golden::V1_0::Flag::AB,
+};
+#pragma clang diagnostic pop
+}  // namespace details
+}  // namespace hardware
+}  // namespace android
+
+namespace android {
+namespace hardware {
+namespace details {
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wc++17-extensions"
+template<> inline constexpr std::array<::golden::V1_0::Access, 5> hidl_enum_values<::golden::V1_0::Access> = {
+    ::golden::V1_0::Access::NO_ACCESS,
+    ::golden::V1_0::Access::READ,
+    ::golden::V1_0::Access::WRITE,
+    ::golden::V1_0::Access::EXECUTE,
+    ::golden::V1_0::Access::SETUID,
+};
+#pragma clang diagnostic pop
+}  // namespace details
+}  // namespace hardware
+}  // namespace android
+
+namespace std {
+template<>
+struct hash<::golden::V1_0::Point> {
+    size_t operator()(const ::golden::V1_0::Point& o) const;
+};
+}  // namespace std
+
+namespace std {
+template<>
+struct hash<::golden::V1_0::Shape::Nested> {
+    size_t operator()(const ::golden::V1_0::Shape::Nested& o) const;
+};
+}  // namespace std
+
+namespace std {
+template<>
+struct hash<::golden::V1_0::Shape> {
+    size_t operator()(const ::golden::V1_0::Shape& o) const;
+};
+}  // namespace std
+
+namespace std {
+template<>
+struct hash<::golden::V1_0::Scene> {
+    size_t operator()(const ::golden::V1_0::Scene& o) const;
+};
+}  // namespace std
+
+namespace std {
+template<>
+struct hash<::golden::V1_0::Samples> {
+    size_t operator()(const ::golden::V1_0::Samples& o) const;
+};
+}  // namespace std
+
+//
+// global type header definitions for package
+//
+
+
+#endif  // HIDL_GENERATED_GOLDEN_V1_0_TYPES_H
@@ -0,0 +1,839 @@
+#define LOG_TAG "golden.packed@1.0::Packed"
+
+#include <log/log.h>
+#include <cutils/trace.h>
+#include <hidl/HidlTransportSupport.h>
+
+#include <hidl/Static.h>
+#include <hwbinder/ProcessState.h>
+#include <utils/Trace.h>
+#include <android/hidl/manager/1.0/IServiceManager.h>
+#include <golden/packed/1.0/BpHwPacked.h>
+#include <golden/packed/1.0/BnHwPacked.h>
+#include <golden/packed/1.0/BsPacked.h>
+#include <android/hidl/base/1.0/BpHwBase.h>
+#include <hidl/ServiceManagement.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace golden {
+namespace packed {
+namespace V1_0 {
+
+const char* IPacked::descriptor("golden.packed@1.0::IPacked");
+
+__attribute__((constructor)) static void static_constructor() {
+    ::android::hardware::details::getBnConstructorMap().set(IPacked::descriptor,
+            [](void *iIntf) -> ::android::sp<::android::hardware::IBinder> {
+                return new BnHwPacked(static_cast<IPacked *>(iIntf));
+            });
+    ::android::hardware::details::getBsConstructorMap().set(IPacked::descriptor,
+            [](void *iIntf) -> ::android::sp<::android::hidl::base::V1_0::IBase> {
+                return new BsPacked(static_cast<IPacked *>(iIntf));
+            });
+};
+
+__attribute__((destructor))static void static_destructor() {
+    ::android::hardware::details::getBnConstructorMap().erase(IPacked::descriptor);
+    ::android::hardware::details::getBsConstructorMap().erase(IPacked::descriptor);
+};
+
+// Methods from ::golden::packed::V1_0::IPacked follow.
+// no default implementation for: ::android::hardware::Return<int32_t> IPacked::configure(bool enabled, uint8_t level, int64_t timestamp, ::golden::V1_0::Color color, ::android::hardware::hidl_bitfield<::golden::V1_0::Flag> flags, const ::android::hardware::hidl_string& label)
+// no default implementation for: ::android::hardware::Return<void> IPacked::report(uint8_t level, int64_t timestamp)
+
+// Methods from ::android::hidl::base::V1_0::IBase follow.
+::android::hardware::Return<void> IPacked::interfaceChain(interfaceChain_cb _hidl_cb){
+    _hidl_cb({
+        ::golden::packed::V1_0::IPacked::descriptor,
+        ::android::hidl::base::V1_0::IBase::descriptor,
+    });
+    return ::android::hardware::Void();}
+
+::android::hardware::Return<void> IPacked::debug(const ::android::hardware::hidl_handle& fd, const ::android::hardware::hidl_vec<::android::hardware::hidl_string>& options){
+    (void)fd;
+    (void)options;
+    return ::android::hardware::Void();
+}
+
+::android::hardware::Return<void> IPacked::interfaceDescriptor(interfaceDescriptor_cb _hidl_cb){
+    _hidl_cb(::golden::packed::V1_0::IPacked::descriptor);
+    return ::android::hardware::Void();
+}
+
+::android::hardware::Return<void> IPacked::getHashChain(getHashChain_cb _hidl_cb){
+    _hidl_cb({
+        (uint8_t[32]){0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0} /* 0000000000000000000000000000000000000000000000000000000000000000 */,
+        (uint8_t[32]){40,121,233,138,49,49,96,191,232,47,213,125,109,11,93,95,72,75,98,132,143,119,21,236,173,252,129,232,185,94,214,188} /* 2879e98a313160bfe82fd57d6d0b5d5f484b62848f7715ecadfc81e8b95ed6bc */});
+    return ::android::hardware::Void();
+}
+
+::android::hardware::Return<void> IPacked::setHALInstrumentation(){
+    return ::android::hardware::Void();
+}
+
+::android::hardware::Return<bool> IPacked::linkToDeath(const ::android::sp<::android::hardware::hidl_death_recipient>& recipient, uint64_t cookie){
+    (void)cookie;
+    return (recipient != nullptr);
+}
+
+::android::hardware::Return<void> IPacked::ping(){
+    return ::android::hardware::Void();
+}
+
+::android::hardware::Return<void> IPacked::getDebugInfo(getDebugInfo_cb _hidl_cb){
+    ::android::hidl::base::V1_0::DebugInfo info = {};
+    info.pid = -1;
+    info.ptr = 0;
+    info.arch = 
+    #if defined(__LP64__)
+    ::android::hidl::base::V1_0::DebugInfo::Architecture::IS_64BIT
+    #else
+    ::android::hidl::base::V1_0::DebugInfo::Architecture::IS_32BIT
+    #endif
+    ;
+    _hidl_cb(info);
+    return ::android::hardware::Void();
+}
+
+::android::hardware::Return<void> IPacked::notifySyspropsChanged(){
+    ::android::report_sysprop_change();
+    return ::android::hardware::Void();
+}
+
+::android::hardware::Return<bool> IPacked::unlinkToDeath(const ::android::sp<::android::hardware::hidl_death_recipient>& recipient){
+    return (recipient != nullptr);
+}
+
+
+// Whether remote binders implement this interface, by binder. Entries are
+// evicted when their binder dies, and ignored once it has been destroyed.
+struct _hidl_IPackedCastCache : public ::android::hardware::IBinder::DeathRecipient {
+    static _hidl_IPackedCastCache* get() {
+        // never destroyed, since binder threads may still use it at exit
+        static _hidl_IPackedCastCache* const sCache = [] {
+            _hidl_IPackedCastCache* cache = new _hidl_IPackedCastCache();
+            cache->incStrong(nullptr);
+            return cache;
+        }();
+        return sCache;
+    }
+
+    bool lookup(const ::android::sp<::android::hardware::IBinder>& binder, bool* canCast) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto it = mEntries.find(binder.get());
+        if (it == mEntries.end() || it->second.binder.promote() != binder) {
+            return false;
+        }
+        *canCast = it->second.canCast;
+        return true;
+    }
+
+    void insert(const ::android::sp<::android::hardware::IBinder>& binder, bool canCast) {
+        if (binder->linkToDeath(this) != ::android::OK) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mEntries.size() >= mSweepSize) {
+            // drop the entries of destroyed binders
+            for (auto it = mEntries.begin(); it != mEntries.end();) {
+                it = it->second.binder.promote() == nullptr ? mEntries.erase(it) : std::next(it);
+            }
+            mSweepSize = 2 * std::max<size_t>(mEntries.size(), 16);
+        }
+        mEntries[binder.get()] = {binder, canCast};
+    }
+
+    void binderDied(const ::android::wp<::android::hardware::IBinder>& who) override {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mEntries.erase(who.unsafe_get());
+    }
+
+    struct Entry {
+        ::android::wp<::android::hardware::IBinder> binder;
+        bool canCast;
+    };
+
+    std::mutex mMutex;
+    std::unordered_map<const ::android::hardware::IBinder*, Entry> mEntries;
+    size_t mSweepSize = 16;
+};
+
+::android::hardware::Return<::android::sp<::golden::packed::V1_0::IPacked>> IPacked::castFrom(const ::android::sp<::golden::packed::V1_0::IPacked>& parent, bool /* emitError */) {
+    return parent;
+}
+
+::android::hardware::Return<::android::sp<::golden::packed::V1_0::IPacked>> IPacked::castFrom(const ::android::sp<::android::hidl::base::V1_0::IBase>& parent, bool emitError) {
+    if (parent == nullptr || !parent->isRemote()) {
+        return ::android::hardware::details::castInterface<IPacked, ::android::hidl::base::V1_0::IBase, BpHwPacked>(
+                parent, "golden.packed@1.0::IPacked", emitError);
+    }
+
+    // Remote objects don't change interfaces, so interfaceChain() is only
+    // called once per binder.
+    const ::android::sp<::android::hardware::IBinder> _hidl_binder =
+            ::android::hardware::toBinder<::android::hidl::base::V1_0::IBase>(parent);
+    bool _hidl_canCast;
+    if (_hidl_IPackedCastCache::get()->lookup(_hidl_binder, &_hidl_canCast)) {
+        if (!_hidl_canCast) {
+            return ::android::sp<::golden::packed::V1_0::IPacked>(nullptr);
+        }
+        return ::android::sp<::golden::packed::V1_0::IPacked>(new BpHwPacked(_hidl_binder));
+    }
+
+    // Errors are always requested, so that a failed interfaceChain() call isn't
+    // taken for, and cached as, an interface the binder doesn't implement.
+    ::android::hardware::Return<bool> _hidl_canCast_ret =
+            ::android::hardware::details::canCastInterface(parent.get(), "golden.packed@1.0::IPacked", true /* emitError */);
+    if (!_hidl_canCast_ret.isOk()) {
+        if (emitError) {
+            return ::android::hardware::details::StatusOf<bool, ::android::sp<::golden::packed::V1_0::IPacked>>(_hidl_canCast_ret);
+        }
+        return ::android::sp<::golden::packed::V1_0::IPacked>(nullptr);
+    }
+
+    _hidl_canCast = _hidl_canCast_ret;
+    _hidl_IPackedCastCache::get()->insert(_hidl_binder, _hidl_canCast);
+    if (!_hidl_canCast) {
+        return ::android::sp<::golden::packed::V1_0::IPacked>(nullptr);
+    }
+    return ::android::sp<::golden::packed::V1_0::IPacked>(new BpHwPacked(_hidl_binder));
+}
+
+BpHwPacked::BpHwPacked(const ::android::sp<::android::hardware::IBinder> &_hidl_impl)
+        : BpInterface<IPacked>(_hidl_impl),
+          ::android::hardware::details::HidlInstrumentor("golden.packed@1.0", "IPacked") {
+}
+
+// Methods from ::golden::packed::V1_0::IPacked follow.
+::android::hardware::Return<int32_t> BpHwPacked::_hidl_configure(::android::hardware::IInterface *_hidl_this, ::android::hardware::details::HidlInstrumentor *_hidl_this_instrumentor, bool enabled, uint8_t level, int64_t timestamp, ::golden::V1_0::Color color, ::android::hardware::hidl_bitfield<::golden::V1_0::Flag> flags, const ::android::hardware::hidl_string& label) {
+    #ifdef __ANDROID_DEBUGGABLE__
+    bool mEnableInstrumentation = _hidl_this_instrumentor->isInstrumentationEnabled();
+    const auto &mInstrumentationCallbacks = _hidl_this_instrumentor->getInstrumentationCallbacks();
+    #else
+    (void) _hidl_this_instrumentor;
+    #endif // __ANDROID_DEBUGGABLE__
+    ::android::ScopedTrace PASTE(___tracer, __LINE__) (ATRACE_TAG_HAL, "HIDL::IPacked::configure::client");
+    #ifdef __ANDROID_DEBUGGABLE__
+    if (UNLIKELY(mEnableInstrumentation)) {
+        void *_hidl_arg_pointers[] = {(void *)&enabled, (void *)&level, (void *)&timestamp, (void *)&color, (void *)&flags, (void *)&label};
+        std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 6);
+        for (const auto &callback: mInstrumentationCallbacks) {
+            callback(InstrumentationEvent::CLIENT_API_ENTRY, "golden.packed", "1.0", "IPacked", "configure", &_hidl_args);
+        }
+    }
+    #endif // __ANDROID_DEBUGGABLE__
+
+    ::android::hardware::Parcel _hidl_data;
+    ::android::hardware::Parcel _hidl_reply;
+    ::android::status_t _hidl_err;
+    ::android::hardware::Status _hidl_status;
+
+    int32_t _hidl_out_status;
+
+    struct _hidl_packed_args_t {
+        bool enabled __attribute__ ((aligned(1)));
+        uint8_t level __attribute__ ((aligned(1)));
+        int64_t timestamp __attribute__ ((aligned(8)));
+        ::golden::V1_0::Color color __attribute__ ((aligned(4)));
+        ::android::hardware::hidl_bitfield<::golden::V1_0::Flag> flags __attribute__ ((aligned(1)));
+    };
+    static_assert(offsetof(_hidl_packed_args_t, enabled) == 0, "wrong offset");
+    static_assert(offsetof(_hidl_packed_args_t, level) == 1, "wrong offset");
+    static_assert(offsetof(_hidl_packed_args_t, timestamp) == 8, "wrong offset");
+    static_assert(offsetof(_hidl_packed_args_t, color) == 16, "wrong offset");
+    static_assert(offsetof(_hidl_packed_args_t, flags) == 20, "wrong offset");
+    static_assert(sizeof(_hidl_packed_args_t) == 24, "wrong size");
+    _hidl_packed_args_t _hidl_packed_args;
+    size_t _hidl_packed_args_parent;
+
+    _hidl_data.setDataCapacity(148);
+
+    _hidl_err = _hidl_data.writeInterfaceToken(BpHwPacked::descriptor);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    ::std::memset(&_hidl_packed_args, 0, sizeof(_hidl_packed_args));
+    _hidl_packed_args.enabled = enabled;
+    _hidl_packed_args.level = level;
+    _hidl_packed_args.timestamp = timestamp;
+    _hidl_packed_args.color = color;
+    _hidl_packed_args.flags = flags;
+    _hidl_err = _hidl_data.writeBuffer(&_hidl_packed_args, sizeof(_hidl_packed_args), &_hidl_packed_args_parent);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    size_t _hidl_label_parent;
+
+    _hidl_err = _hidl_data.writeBuffer(&label, sizeof(label), &_hidl_label_parent);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+            label,
+            &_hidl_data,
+            _hidl_label_parent,
+            0 /* parentOffset */);
+
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    _hidl_err = ::android::hardware::IInterface::asBinder(_hidl_this)->transact(1 /* configure */, _hidl_data, &_hidl_reply);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    _hidl_err = ::android::hardware::readFromParcel(&_hidl_status, _hidl_reply);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    if (!_hidl_status.isOk()) { return _hidl_status; }
+
+    _hidl_err = _hidl_reply.readInt32(&_hidl_out_status);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    #ifdef __ANDROID_DEBUGGABLE__
+    if (UNLIKELY(mEnableInstrumentation)) {
+        void *_hidl_arg_pointers[] = {(void *)&_hidl_out_status};
+        std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+        for (const auto &callback: mInstrumentationCallbacks) {
+            callback(InstrumentationEvent::CLIENT_API_EXIT, "golden.packed", "1.0", "IPacked", "configure", &_hidl_args);
+        }
+    }
+    #endif // __ANDROID_DEBUGGABLE__
+
+    _hidl_status.setFromStatusT(_hidl_err);
+    return ::android::hardware::Return<int32_t>(_hidl_out_status);
+
+_hidl_error:
+    _hidl_status.setFromStatusT(_hidl_err);
+    return ::android::hardware::Return<int32_t>(_hidl_status);
+}
+
+::android::hardware::Return<void> BpHwPacked::_hidl_report(::android::hardware::IInterface *_hidl_this, ::android::hardware::details::HidlInstrumentor *_hidl_this_instrumentor, uint8_t level, int64_t timestamp) {
+    #ifdef __ANDROID_DEBUGGABLE__
+    bool mEnableInstrumentation = _hidl_this_instrumentor->isInstrumentationEnabled();
+    const auto &mInstrumentationCallbacks = _hidl_this_instrumentor->getInstrumentationCallbacks();
+    #else
+    (void) _hidl_this_instrumentor;
+    #endif // __ANDROID_DEBUGGABLE__
+    ::android::ScopedTrace PASTE(___tracer, __LINE__) (ATRACE_TAG_HAL, "HIDL::IPacked::report::client");
+    #ifdef __ANDROID_DEBUGGABLE__
+    if (UNLIKELY(mEnableInstrumentation)) {
+        void *_hidl_arg_pointers[] = {(void *)&level, (void *)&timestamp};
+        std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 2);
+        for (const auto &callback: mInstrumentationCallbacks) {
+            callback(InstrumentationEvent::CLIENT_API_ENTRY, "golden.packed", "1.0", "IPacked", "report", &_hidl_args);
+        }
+    }
+    #endif // __ANDROID_DEBUGGABLE__
+
+    ::android::hardware::Parcel _hidl_data;
+    ::android::hardware::Parcel _hidl_reply;
+    ::android::status_t _hidl_err;
+    ::android::hardware::Status _hidl_status;
+
+    struct _hidl_packed_args_t {
+        uint8_t level __attribute__ ((aligned(1)));
+        int64_t timestamp __attribute__ ((aligned(8)));
+    };
+    static_assert(offsetof(_hidl_packed_args_t, level) == 0, "wrong offset");
+    static_assert(offsetof(_hidl_packed_args_t, timestamp) == 8, "wrong offset");
+    static_assert(sizeof(_hidl_packed_args_t) == 16, "wrong size");
+    _hidl_packed_args_t _hidl_packed_args;
+    size_t _hidl_packed_args_parent;
+
+    _hidl_data.setDataCapacity(68);
+
+    _hidl_err = _hidl_data.writeInterfaceToken(BpHwPacked::descriptor);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    ::std::memset(&_hidl_packed_args, 0, sizeof(_hidl_packed_args));
+    _hidl_packed_args.level = level;
+    _hidl_packed_args.timestamp = timestamp;
+    _hidl_err = _hidl_data.writeBuffer(&_hidl_packed_args, sizeof(_hidl_packed_args), &_hidl_packed_args_parent);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    _hidl_err = ::android::hardware::IInterface::asBinder(_hidl_this)->transact(2 /* report */, _hidl_data, &_hidl_reply, 1u /* oneway */);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    #ifdef __ANDROID_DEBUGGABLE__
+    if (UNLIKELY(mEnableInstrumentation)) {
+        std::vector<void *> _hidl_args;
+        for (const auto &callback: mInstrumentationCallbacks) {
+            callback(InstrumentationEvent::CLIENT_API_EXIT, "golden.packed", "1.0", "IPacked", "report", &_hidl_args);
+        }
+    }
+    #endif // __ANDROID_DEBUGGABLE__
+
+    _hidl_status.setFromStatusT(_hidl_err);
+    return ::android::hardware::Return<void>();
+
+_hidl_error:
+    _hidl_status.setFromStatusT(_hidl_err);
+    return ::android::hardware::Return<void>(_hidl_status);
+}
+
+
+// Methods from ::golden::packed::V1_0::IPacked follow.
+::android::hardware::Return<int32_t> BpHwPacked::configure(bool enabled, uint8_t level, int64_t timestamp, ::golden::V1_0::Color color, ::android::hardware::hidl_bitfield<::golden::V1_0::Flag> flags, const ::android::hardware::hidl_string& label){
+    ::android::hardware::Return<int32_t>  _hidl_out = ::golden::packed::V1_0::BpHwPacked::_hidl_configure(this, this, enabled, level, timestamp, color, flags, label);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<void> BpHwPacked::report(uint8_t level, int64_t timestamp){
+    ::android::hardware::Return<void>  _hidl_out = ::golden::packed::V1_0::BpHwPacked::_hidl_report(this, this, level, timestamp);
+
+    return _hidl_out;
+}
+
+
+// Methods from ::android::hidl::base::V1_0::IBase follow.
+::android::hardware::Return<void> BpHwPacked::interfaceChain(interfaceChain_cb _hidl_cb){
+    ::android::hardware::Return<void>  _hidl_out = ::android::hidl::base::V1_0::BpHwBase::_hidl_interfaceChain(this, this, _hidl_cb);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<void> BpHwPacked::debug(const ::android::hardware::hidl_handle& fd, const ::android::hardware::hidl_vec<::android::hardware::hidl_string>& options){
+    ::android::hardware::Return<void>  _hidl_out = ::android::hidl::base::V1_0::BpHwBase::_hidl_debug(this, this, fd, options);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<void> BpHwPacked::interfaceDescriptor(interfaceDescriptor_cb _hidl_cb){
+    ::android::hardware::Return<void>  _hidl_out = ::android::hidl::base::V1_0::BpHwBase::_hidl_interfaceDescriptor(this, this, _hidl_cb);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<void> BpHwPacked::getHashChain(getHashChain_cb _hidl_cb){
+    ::android::hardware::Return<void>  _hidl_out = ::android::hidl::base::V1_0::BpHwBase::_hidl_getHashChain(this, this, _hidl_cb);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<void> BpHwPacked::setHALInstrumentation(){
+    ::android::hardware::Return<void>  _hidl_out = ::android::hidl::base::V1_0::BpHwBase::_hidl_setHALInstrumentation(this, this);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<bool> BpHwPacked::linkToDeath(const ::android::sp<::android::hardware::hidl_death_recipient>& recipient, uint64_t cookie){
+    ::android::hardware::ProcessState::self()->startThreadPool();
+    ::android::hardware::hidl_binder_death_recipient *binder_recipient = new ::android::hardware::hidl_binder_death_recipient(recipient, cookie, this);
+    std::unique_lock<std::mutex> lock(_hidl_mMutex);
+    _hidl_mDeathRecipients.push_back(binder_recipient);
+    return (remote()->linkToDeath(binder_recipient) == ::android::OK);
+}
+
+::android::hardware::Return<void> BpHwPacked::ping(){
+    ::android::hardware::Return<void>  _hidl_out = ::android::hidl::base::V1_0::BpHwBase::_hidl_ping(this, this);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<void> BpHwPacked::getDebugInfo(getDebugInfo_cb _hidl_cb){
+    ::android::hardware::Return<void>  _hidl_out = ::android::hidl::base::V1_0::BpHwBase::_hidl_getDebugInfo(this, this, _hidl_cb);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<void> BpHwPacked::notifySyspropsChanged(){
+    ::android::hardware::Return<void>  _hidl_out = ::android::hidl::base::V1_0::BpHwBase::_hidl_notifySyspropsChanged(this, this);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<bool> BpHwPacked::unlinkToDeath(const ::android::sp<::android::hardware::hidl_death_recipient>& recipient){
+    std::unique_lock<std::mutex> lock(_hidl_mMutex);
+    for (auto it = _hidl_mDeathRecipients.rbegin();it != _hidl_mDeathRecipients.rend();++it) {
+        if ((*it)->getRecipient() == recipient) {
+            ::android::status_t status = remote()->unlinkToDeath(*it);
+            _hidl_mDeathRecipients.erase(it.base()-1);
+            return status == ::android::OK;
+        }
+    }
+    return false;
+}
+
+
+BnHwPacked::BnHwPacked(const ::android::sp<IPacked> &_hidl_impl)
+        : ::android::hidl::base::V1_0::BnHwBase(_hidl_impl, "golden.packed@1.0", "IPacked") { 
+            _hidl_mImpl = _hidl_impl;
+            auto prio = ::android::hardware::details::gServicePrioMap->get(_hidl_impl, {SCHED_NORMAL, 0});
+            mSchedPolicy = prio.sched_policy;
+            mSchedPriority = prio.prio;
+            setRequestingSid(::android::hardware::details::gServiceSidMap->get(_hidl_impl, false));
+}
+
+BnHwPacked::~BnHwPacked() {
+    ::android::hardware::details::gBnMap->eraseIfEqual(_hidl_mImpl.get(), this);
+}
+
+// Methods from ::golden::packed::V1_0::IPacked follow.
+::android::status_t BnHwPacked::_hidl_configure(
+        ::android::hidl::base::V1_0::BnHwBase* _hidl_this,
+        const ::android::hardware::Parcel &_hidl_data,
+        ::android::hardware::Parcel *_hidl_reply,
+        TransactCallback _hidl_cb) {
+    #ifdef __ANDROID_DEBUGGABLE__
+    bool mEnableInstrumentation = _hidl_this->isInstrumentationEnabled();
+    const auto &mInstrumentationCallbacks = _hidl_this->getInstrumentationCallbacks();
+    #endif // __ANDROID_DEBUGGABLE__
+
+    ::android::status_t _hidl_err = ::android::OK;
+    if (!_hidl_data.enforceInterface(BnHwPacked::Pure::descriptor)) {
+        _hidl_err = ::android::BAD_TYPE;
+        return _hidl_err;
+    }
+
+    bool enabled;
+    uint8_t level;
+    int64_t timestamp;
+    ::golden::V1_0::Color color;
+    ::android::hardware::hidl_bitfield<::golden::V1_0::Flag> flags;
+    const ::android::hardware::hidl_string* label;
+
+    struct _hidl_packed_args_t {
+        bool enabled __attribute__ ((aligned(1)));
+        uint8_t level __attribute__ ((aligned(1)));
+        int64_t timestamp __attribute__ ((aligned(8)));
+        ::golden::V1_0::Color color __attribute__ ((aligned(4)));
+        ::android::hardware::hidl_bitfield<::golden::V1_0::Flag> flags __attribute__ ((aligned(1)));
+    };
+    static_assert(offsetof(_hidl_packed_args_t, enabled) == 0, "wrong offset");
+    static_assert(offsetof(_hidl_packed_args_t, level) == 1, "wrong offset");
+    static_assert(offsetof(_hidl_packed_args_t, timestamp) == 8, "wrong offset");
+    static_assert(offsetof(_hidl_packed_args_t, color) == 16, "wrong offset");
+    static_assert(offsetof(_hidl_packed_args_t, flags) == 20, "wrong offset");
+    static_assert(sizeof(_hidl_packed_args_t) == 24, "wrong size");
+    const _hidl_packed_args_t* _hidl_packed_args;
+    size_t _hidl_packed_args_parent;
+
+    _hidl_err = _hidl_data.readBuffer(sizeof(*_hidl_packed_args), &_hidl_packed_args_parent, reinterpret_cast<const void**>(&_hidl_packed_args));
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    enabled = _hidl_packed_args->enabled;
+    level = _hidl_packed_args->level;
+    timestamp = _hidl_packed_args->timestamp;
+    color = _hidl_packed_args->color;
+    flags = _hidl_packed_args->flags;
+
+    size_t _hidl_label_parent;
+
+    _hidl_err = _hidl_data.readBuffer(sizeof(*label), &_hidl_label_parent,  reinterpret_cast<const void **>(&label));
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+            const_cast<::android::hardware::hidl_string &>(*label),
+            _hidl_data,
+            _hidl_label_parent,
+            0 /* parentOffset */);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    atrace_begin(ATRACE_TAG_HAL, "HIDL::IPacked::configure::server");
+    #ifdef __ANDROID_DEBUGGABLE__
+    if (UNLIKELY(mEnableInstrumentation)) {
+        void *_hidl_arg_pointers[] = {(void *)&enabled, (void *)&level, (void *)&timestamp, (void *)&color, (void *)&flags, (void *)label};
+        std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 6);
+        for (const auto &callback: mInstrumentationCallbacks) {
+            callback(InstrumentationEvent::SERVER_API_ENTRY, "golden.packed", "1.0", "IPacked", "configure", &_hidl_args);
+        }
+    }
+    #endif // __ANDROID_DEBUGGABLE__
+
+    int32_t _hidl_out_status = static_cast<IPacked*>(_hidl_this->getImpl().get())->configure(enabled, level, timestamp, color, flags, *label);
+
+    ::android::hardware::writeToParcel(::android::hardware::Status::ok(), _hidl_reply);
+
+    _hidl_err = _hidl_reply->writeInt32(_hidl_out_status);
+    /* _hidl_err ignored! */
+
+    atrace_end(ATRACE_TAG_HAL);
+    #ifdef __ANDROID_DEBUGGABLE__
+    if (UNLIKELY(mEnableInstrumentation)) {
+        void *_hidl_arg_pointers[] = {(void *)&_hidl_out_status};
+        std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+        for (const auto &callback: mInstrumentationCallbacks) {
+            callback(InstrumentationEvent::SERVER_API_EXIT, "golden.packed", "1.0", "IPacked", "configure", &_hidl_args);
+        }
+    }
+    #endif // __ANDROID_DEBUGGABLE__
+
+    _hidl_cb(*_hidl_reply);
+    return _hidl_err;
+}
+
+::android::status_t BnHwPacked::_hidl_report(
+        ::android::hidl::base::V1_0::BnHwBase* _hidl_this,
+        const ::android::hardware::Parcel &_hidl_data,
+        ::android::hardware::Parcel *_hidl_reply,
+        TransactCallback _hidl_cb) {
+    #ifdef __ANDROID_DEBUGGABLE__
+    bool mEnableInstrumentation = _hidl_this->isInstrumentationEnabled();
+    const auto &mInstrumentationCallbacks = _hidl_this->getInstrumentationCallbacks();
+    #endif // __ANDROID_DEBUGGABLE__
+
+    ::android::status_t _hidl_err = ::android::OK;
+    if (!_hidl_data.enforceInterface(BnHwPacked::Pure::descriptor)) {
+        _hidl_err = ::android::BAD_TYPE;
+        return _hidl_err;
+    }
+
+    uint8_t level;
+    int64_t timestamp;
+
+    struct _hidl_packed_args_t {
+        uint8_t level __attribute__ ((aligned(1)));
+        int64_t timestamp __attribute__ ((aligned(8)));
+    };
+    static_assert(offsetof(_hidl_packed_args_t, level) == 0, "wrong offset");
+    static_assert(offsetof(_hidl_packed_args_t, timestamp) == 8, "wrong offset");
+    static_assert(sizeof(_hidl_packed_args_t) == 16, "wrong size");
+    const _hidl_packed_args_t* _hidl_packed_args;
+    size_t _hidl_packed_args_parent;
+
+    _hidl_err = _hidl_data.readBuffer(sizeof(*_hidl_packed_args), &_hidl_packed_args_parent, reinterpret_cast<const void**>(&_hidl_packed_args));
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    level = _hidl_packed_args->level;
+    timestamp = _hidl_packed_args->timestamp;
+
+    atrace_begin(ATRACE_TAG_HAL, "HIDL::IPacked::report::server");
+    #ifdef __ANDROID_DEBUGGABLE__
+    if (UNLIKELY(mEnableInstrumentation)) {
+        void *_hidl_arg_pointers[] = {(void *)&level, (void *)&timestamp};
+        std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 2);
+        for (const auto &callback: mInstrumentationCallbacks) {
+            callback(InstrumentationEvent::SERVER_API_ENTRY, "golden.packed", "1.0", "IPacked", "report", &_hidl_args);
+        }
+    }
+    #endif // __ANDROID_DEBUGGABLE__
+
+    ::android::hardware::Return<void> _hidl_ret = static_cast<IPacked*>(_hidl_this->getImpl().get())->report(level, timestamp);
+
+    (void) _hidl_cb;
+
+    atrace_end(ATRACE_TAG_HAL);
+    #ifdef __ANDROID_DEBUGGABLE__
+    if (UNLIKELY(mEnableInstrumentation)) {
+        std::vector<void *> _hidl_args;
+        for (const auto &callback: mInstrumentationCallbacks) {
+            callback(InstrumentationEvent::SERVER_API_EXIT, "golden.packed", "1.0", "IPacked", "report", &_hidl_args);
+        }
+    }
+    #endif // __ANDROID_DEBUGGABLE__
+
+    _hidl_ret.assertOk();
+    ::android::hardware::writeToParcel(::android::hardware::Status::ok(), _hidl_reply);
+
+    return _hidl_err;
+}
+
+
+// Methods from ::golden::packed::V1_0::IPacked follow.
+
+// Methods from ::android::hidl::base::V1_0::IBase follow.
+::android::hardware::Return<void> BnHwPacked::ping() {
+    return ::android::hardware::Void();
+}
+::android::hardware::Return<void> BnHwPacked::getDebugInfo(getDebugInfo_cb _hidl_cb) {
+    ::android::hidl::base::V1_0::DebugInfo info = {};
+    info.pid = ::android::hardware::details::getPidIfSharable();
+    info.ptr = ::android::hardware::details::debuggable()? reinterpret_cast<uint64_t>(this) : 0;
+    info.arch = 
+    #if defined(__LP64__)
+    ::android::hidl::base::V1_0::DebugInfo::Architecture::IS_64BIT
+    #else
+    ::android::hidl::base::V1_0::DebugInfo::Architecture::IS_32BIT
+    #endif
+    ;
+    _hidl_cb(info);
+    return ::android::hardware::Void();
+}
+
+::android::status_t BnHwPacked::onTransact(
+        uint32_t _hidl_code,
+        const ::android::hardware::Parcel &_hidl_data,
+        ::android::hardware::Parcel *_hidl_reply,
+        uint32_t _hidl_flags,
+        TransactCallback _hidl_cb) {
+    ::android::status_t _hidl_err = ::android::OK;
+
+    static constexpr struct {
+        ::android::status_t (*method)(
+                ::android::hidl::base::V1_0::BnHwBase* _hidl_this,
+                const ::android::hardware::Parcel &_hidl_data,
+                ::android::hardware::Parcel *_hidl_reply,
+                TransactCallback _hidl_cb);
+        bool oneway;
+    } kMethods[] = {
+        {&::golden::packed::V1_0::BnHwPacked::_hidl_configure, false},  // 1: configure
+        {&::golden::packed::V1_0::BnHwPacked::_hidl_report, true},  // 2: report
+    };
+
+    const uint32_t _hidl_index = _hidl_code - 1 /* FIRST_CALL_TRANSACTION */;
+    if (_hidl_index < 2) {
+        bool _hidl_is_oneway = _hidl_flags & 1u /* oneway */;
+        if (_hidl_is_oneway != kMethods[_hidl_index].oneway) {
+            return ::android::UNKNOWN_ERROR;
+        }
+
+        _hidl_err = kMethods[_hidl_index].method(this, _hidl_data, _hidl_reply, _hidl_cb);
+    } else {
+        return ::android::hidl::base::V1_0::BnHwBase::onTransact(
+                _hidl_code, _hidl_data, _hidl_reply, _hidl_flags, _hidl_cb);
+    }
+
+    if (_hidl_err == ::android::UNEXPECTED_NULL) {
+        _hidl_err = ::android::hardware::writeToParcel(
+                ::android::hardware::Status::fromExceptionCode(::android::hardware::Status::EX_NULL_POINTER),
+                _hidl_reply);
+    }return _hidl_err;
+}
+
+struct BsPacked::OnewayQueue : public std::enable_shared_from_this<OnewayQueue> {
+    struct Slot {
+        std::atomic<size_t> sequence;
+        std::function<void(void)> task;
+    };
+
+    explicit OnewayQueue(size_t capacity) : mCapacity(capacity), mSlots(new Slot[capacity]) {
+        for (size_t i = 0; i < mCapacity; i++) {
+            mSlots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool push(std::function<void(void)>&& task) {
+        std::call_once(mStarted, [self = shared_from_this()] {
+            std::thread([self] { self->run(); }).detach();
+        });
+
+        size_t tail = mTail.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = mSlots[tail % mCapacity];
+            const intptr_t diff = static_cast<intptr_t>(
+                    slot.sequence.load(std::memory_order_acquire) - tail);
+            if (diff == 0) {
+                if (mTail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) {
+                    slot.task = std::move(task);
+                    slot.sequence.store(tail + 1);
+                    break;
+                }
+            } else if (diff < 0) {
+                // the consumer has not emptied this slot yet
+                mDropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                tail = mTail.load(std::memory_order_relaxed);
+            }
+        }
+
+        if (mWaiting.load()) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mCondition.notify_one();
+        }
+        return true;
+    }
+
+    void stop() {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopped = true;
+        mCondition.notify_one();
+    }
+
+    void run() {
+        for (size_t head = 0;; head++) {
+            Slot& slot = mSlots[head % mCapacity];
+            auto ready = [&] { return slot.sequence.load() == head + 1; };
+            if (!ready()) {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mWaiting.store(true);
+                mCondition.wait(lock, [&] { return ready() || mStopped; });
+                mWaiting.store(false);
+                if (!ready()) return;
+            }
+            std::function<void(void)> task = std::move(slot.task);
+            slot.task = nullptr;
+            slot.sequence.store(head + mCapacity, std::memory_order_release);
+            mHead.store(head + 1, std::memory_order_relaxed);
+            task();
+        }
+    }
+
+    const size_t mCapacity;
+    const std::unique_ptr<Slot[]> mSlots;
+    std::atomic<size_t> mHead{0};
+    std::atomic<size_t> mTail{0};
+    std::atomic<uint64_t> mDropped{0};
+    std::atomic<bool> mWaiting{false};
+    std::once_flag mStarted;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    bool mStopped = false;
+};
+
+BsPacked::BsPacked(const ::android::sp<::golden::packed::V1_0::IPacked> impl) : ::android::hardware::details::HidlInstrumentor("golden.packed@1.0", "IPacked"), mImpl(impl),
+        mOnewayQueue(std::make_shared<OnewayQueue>(3000)) {}
+
+BsPacked::~BsPacked() {
+    // the consumer thread finishes the queued calls, then exits
+    mOnewayQueue->stop();
+}
+
+size_t BsPacked::getOnewayQueueDepth() const {
+    return mOnewayQueue->mTail.load(std::memory_order_relaxed) -
+            mOnewayQueue->mHead.load(std::memory_order_relaxed);
+}
+
+uint64_t BsPacked::getOnewayDropCount() const {
+    return mOnewayQueue->mDropped.load(std::memory_order_relaxed);
+}
+
+::android::hardware::Return<void> BsPacked::addOnewayTask(std::function<void(void)>&& task) {
+    if (!mOnewayQueue->push(std::move(task))) {
+        return ::android::hardware::Status::fromExceptionCode(
+                ::android::hardware::Status::EX_TRANSACTION_FAILED,
+                "Passthrough oneway function queue exceeds maximum size.");
+    }
+    return ::android::hardware::Status();
+}
+
+::android::sp<IPacked> IPacked::tryGetService(const std::string &serviceName, const bool getStub) {
+    return ::android::hardware::details::getServiceInternal<BpHwPacked>(serviceName, false, getStub);
+}
+
+::android::sp<IPacked> IPacked::getService(const std::string &serviceName, const bool getStub) {
+    return ::android::hardware::details::getServiceInternal<BpHwPacked>(serviceName, true, getStub);
+}
+
+::android::status_t IPacked::registerAsService(const std::string &serviceName) {
+    return ::android::hardware::details::registerAsServiceInternal(this, serviceName);
+}
+
+bool IPacked::registerForNotifications(
+        const std::string &serviceName,
+        const ::android::sp<::android::hidl::manager::V1_0::IServiceNotification> &notification) {
+    const ::android::sp<::android::hidl::manager::V1_0::IServiceManager> sm
+            = ::android::hardware::defaultServiceManager();
+    if (sm == nullptr) {
+        return false;
+    }
+    ::android::hardware::Return<bool> success =
+            sm->registerForNotifications("golden.packed@1.0::IPacked",
+                    serviceName, notification);
+    return success.isOk() && success;
+}
+
+static_assert(sizeof(::android::hardware::MQDescriptor<char, ::android::hardware::kSynchronizedReadWrite>) == 32, "wrong size");
+static_assert(sizeof(::android::hardware::hidl_handle) == 16, "wrong size");
+static_assert(sizeof(::android::hardware::hidl_memory) == 40, "wrong size");
+static_assert(sizeof(::android::hardware::hidl_string) == 16, "wrong size");
+static_assert(sizeof(::android::hardware::hidl_vec<char>) == 16, "wrong size");
+
+}  // namespace V1_0
+}  // namespace packed
+}  // namespace golden
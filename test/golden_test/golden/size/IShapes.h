@@ -0,0 +1,193 @@
+#ifndef HIDL_GENERATED_GOLDEN_SIZE_V1_0_ISHAPES_H
+#define HIDL_GENERATED_GOLDEN_SIZE_V1_0_ISHAPES_H
+
+#include <android/hidl/base/1.0/IBase.h>
+#include <golden/1.0/types.h>
+
+#include <android/hidl/manager/1.0/IServiceNotification.h>
+
+#include <hidl/HidlSupport.h>
+#include <hidl/MQDescriptor.h>
+#include <hidl/Status.h>
+#include <utils/NativeHandle.h>
+#include <utils/misc.h>
+
+namespace golden {
+namespace size {
+namespace V1_0 {
+
+struct IShapes : public ::android::hidl::base::V1_0::IBase {
+    /**
+     * Type tag for use in template logic that indicates this is a 'pure' class.
+     */
+    typedef android::hardware::details::i_tag _hidl_tag;
+
+    /**
+     * Fully qualified interface name: "golden.size@1.0::IShapes"
+     */
+    static const char* descriptor;
+
+    /**
+     * Returns whether this object's implementation is outside of the current process.
+     */
+    virtual bool isRemote() const override { return false; }
+
+    /**
+     * Return callback for transform
+     */
+    using transform_cb = std::function<void(const ::golden::V1_0::Shape& result)>;
+    /**
+     * Shape, with its embedded strings and vectors, is both an argument and
+     * a result, so -S shares its reader and writer between proxy and stub.
+     */
+    virtual ::android::hardware::Return<void> transform(const ::golden::V1_0::Shape& shape, int32_t dx, int32_t dy, transform_cb _hidl_cb) = 0;
+
+    /**
+     * Return callback for getShape
+     */
+    using getShape_cb = std::function<void(const ::golden::V1_0::Shape& shape)>;
+    virtual ::android::hardware::Return<void> getShape(const ::android::hardware::hidl_string& name, getShape_cb _hidl_cb) = 0;
+
+    /**
+     * Scene is passed only once, so -S keeps marshalling it inline.
+     */
+    virtual ::android::hardware::Return<void> setScene(const ::golden::V1_0::Scene& scene) = 0;
+
+    /**
+     * Return callback for interfaceChain
+     */
+    using interfaceChain_cb = std::function<void(const ::android::hardware::hidl_vec<::android::hardware::hidl_string>& descriptors)>;
+    virtual ::android::hardware::Return<void> interfaceChain(interfaceChain_cb _hidl_cb) override;
+
+    virtual ::android::hardware::Return<void> debug(const ::android::hardware::hidl_handle& fd, const ::android::hardware::hidl_vec<::android::hardware::hidl_string>& options) override;
+
+    /**
+     * Return callback for interfaceDescriptor
+     */
+    using interfaceDescriptor_cb = std::function<void(const ::android::hardware::hidl_string& descriptor)>;
+    virtual ::android::hardware::Return<void> interfaceDescriptor(interfaceDescriptor_cb _hidl_cb) override;
+
+    /**
+     * Return callback for getHashChain
+     */
+    using getHashChain_cb = std::function<void(const ::android::hardware::hidl_vec<::android::hardware::hidl_array<uint8_t, 32>>& hashchain)>;
+    virtual ::android::hardware::Return<void> getHashChain(getHashChain_cb _hidl_cb) override;
+
+    virtual ::android::hardware::Return<void> setHALInstrumentation() override;
+
+    virtual ::android::hardware::Return<bool> linkToDeath(const ::android::sp<::android::hardware::hidl_death_recipient>& recipient, uint64_t cookie) override;
+
+    virtual ::android::hardware::Return<void> ping() override;
+
+    /**
+     * Return callback for getDebugInfo
+     */
+    using getDebugInfo_cb = std::function<void(const ::android::hidl::base::V1_0::DebugInfo& info)>;
+    virtual ::android::hardware::Return<void> getDebugInfo(getDebugInfo_cb _hidl_cb) override;
+
+    virtual ::android::hardware::Return<void> notifySyspropsChanged() override;
+
+    virtual ::android::hardware::Return<bool> unlinkToDeath(const ::android::sp<::android::hardware::hidl_death_recipient>& recipient) override;
+
+    // cast static functions
+    /**
+     * This performs a checked cast based on what the underlying implementation actually is.
+     */
+    static ::android::hardware::Return<::android::sp<::golden::size::V1_0::IShapes>> castFrom(const ::android::sp<::golden::size::V1_0::IShapes>& parent, bool emitError = false);
+    /**
+     * This performs a checked cast based on what the underlying implementation actually is.
+     */
+    static ::android::hardware::Return<::android::sp<::golden::size::V1_0::IShapes>> castFrom(const ::android::sp<::android::hidl::base::V1_0::IBase>& parent, bool emitError = false);
+
+    // helper methods for interactions with the hwservicemanager
+    /**
+     * This gets the service of this type with the specified instance name. If the
+     * service is currently not available or not in the VINTF manifest on a Trebilized
+     * device, this will return nullptr. This is useful when you don't want to block
+     * during device boot. If getStub is true, this will try to return an unwrapped
+     * passthrough implementation in the same process. This is useful when getting an
+     * implementation from the same partition/compilation group.
+     * 
+     * In general, prefer getService(std::string,bool)
+     */
+    static ::android::sp<IShapes> tryGetService(const std::string &serviceName="default", bool getStub=false);
+    /**
+     * Deprecated. See tryGetService(std::string, bool)
+     */
+    static ::android::sp<IShapes> tryGetService(const char serviceName[], bool getStub=false)  { std::string str(serviceName ? serviceName : "");      return tryGetService(str, getStub); }
+    /**
+     * Deprecated. See tryGetService(std::string, bool)
+     */
+    static ::android::sp<IShapes> tryGetService(const ::android::hardware::hidl_string& serviceName, bool getStub=false)  { std::string str(serviceName.c_str());      return tryGetService(str, getStub); }
+    /**
+     * Calls tryGetService("default", bool). This is the recommended instance name for singleton services.
+     */
+    static ::android::sp<IShapes> tryGetService(bool getStub) { return tryGetService("default", getStub); }
+    /**
+     * This gets the service of this type with the specified instance name. If the
+     * service is not in the VINTF manifest on a Trebilized device, this will return
+     * nullptr. If the service is not available, this will wait for the service to
+     * become available. If the service is a lazy service, this will start the service
+     * and return when it becomes available. If getStub is true, this will try to
+     * return an unwrapped passthrough implementation in the same process. This is
+     * useful when getting an implementation from the same partition/compilation group.
+     */
+    static ::android::sp<IShapes> getService(const std::string &serviceName="default", bool getStub=false);
+    /**
+     * Deprecated. See getService(std::string, bool)
+     */
+    static ::android::sp<IShapes> getService(const char serviceName[], bool getStub=false)  { std::string str(serviceName ? serviceName : "");      return getService(str, getStub); }
+    /**
+     * Deprecated. See getService(std::string, bool)
+     */
+    static ::android::sp<IShapes> getService(const ::android::hardware::hidl_string& serviceName, bool getStub=false)  { std::string str(serviceName.c_str());      return getService(str, getStub); }
+    /**
+     * Calls getService("default", bool). This is the recommended instance name for singleton services.
+     */
+    static ::android::sp<IShapes> getService(bool getStub) { return getService("default", getStub); }
+    /**
+     * Registers a service with the service manager. For Trebilized devices, the service
+     * must also be in the VINTF manifest.
+     */
+    __attribute__ ((warn_unused_result))::android::status_t registerAsService(const std::string &serviceName="default");
+    /**
+     * Registers for notifications for when a service is registered.
+     */
+    static bool registerForNotifications(
+            const std::string &serviceName,
+            const ::android::sp<::android::hidl::manager::V1_0::IServiceNotification> &notification);
+};
+
+//
+// type declarations for package
+//
+
+static inline std::string toString(const ::android::sp<::golden::size::V1_0::IShapes>& o);
+
+//
+// type header definitions for package
+//
+
+static inline std::string toString(const ::android::sp<::golden::size::V1_0::IShapes>& o) {
+    std::string os = "[class or subclass of ";
+    os += ::golden::size::V1_0::IShapes::descriptor;
+    os += "]";
+    os += o->isRemote() ? "@remote" : "@local";
+    return os;
+}
+
+
+}  // namespace V1_0
+}  // namespace size
+}  // namespace golden
+
+//
+// global type declarations for package
+//
+
+//
+// global type header definitions for package
+//
+
+
+#endif  // HIDL_GENERATED_GOLDEN_SIZE_V1_0_ISHAPES_H
@@ -0,0 +1,1003 @@
+#define LOG_TAG "golden.size@1.0::Shapes"
+
+#include <log/log.h>
+#include <cutils/trace.h>
+#include <hidl/HidlTransportSupport.h>
+
+#include <hidl/Static.h>
+#include <hwbinder/ProcessState.h>
+#include <utils/Trace.h>
+#include <android/hidl/manager/1.0/IServiceManager.h>
+#include <golden/size/1.0/BpHwShapes.h>
+#include <golden/size/1.0/BnHwShapes.h>
+#include <golden/size/1.0/BsShapes.h>
+#include <android/hidl/base/1.0/BpHwBase.h>
+#include <hidl/ServiceManagement.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace golden {
+namespace size {
+namespace V1_0 {
+
+const char* IShapes::descriptor("golden.size@1.0::IShapes");
+
+__attribute__((constructor)) static void static_constructor() {
+    ::android::hardware::details::getBnConstructorMap().set(IShapes::descriptor,
+            [](void *iIntf) -> ::android::sp<::android::hardware::IBinder> {
+                return new BnHwShapes(static_cast<IShapes *>(iIntf));
+            });
+    ::android::hardware::details::getBsConstructorMap().set(IShapes::descriptor,
+            [](void *iIntf) -> ::android::sp<::android::hidl::base::V1_0::IBase> {
+                return new BsShapes(static_cast<IShapes *>(iIntf));
+            });
+};
+
+__attribute__((destructor))static void static_destructor() {
+    ::android::hardware::details::getBnConstructorMap().erase(IShapes::descriptor);
+    ::android::hardware::details::getBsConstructorMap().erase(IShapes::descriptor);
+};
+
+// Methods from ::golden::size::V1_0::IShapes follow.
+// no default implementation for: ::android::hardware::Return<void> IShapes::transform(const ::golden::V1_0::Shape& shape, int32_t dx, int32_t dy, transform_cb _hidl_cb)
+// no default implementation for: ::android::hardware::Return<void> IShapes::getShape(const ::android::hardware::hidl_string& name, getShape_cb _hidl_cb)
+// no default implementation for: ::android::hardware::Return<void> IShapes::setScene(const ::golden::V1_0::Scene& scene)
+
+// Methods from ::android::hidl::base::V1_0::IBase follow.
+::android::hardware::Return<void> IShapes::interfaceChain(interfaceChain_cb _hidl_cb){
+    _hidl_cb({
+        ::golden::size::V1_0::IShapes::descriptor,
+        ::android::hidl::base::V1_0::IBase::descriptor,
+    });
+    return ::android::hardware::Void();}
+
+::android::hardware::Return<void> IShapes::debug(const ::android::hardware::hidl_handle& fd, const ::android::hardware::hidl_vec<::android::hardware::hidl_string>& options){
+    (void)fd;
+    (void)options;
+    return ::android::hardware::Void();
+}
+
+::android::hardware::Return<void> IShapes::interfaceDescriptor(interfaceDescriptor_cb _hidl_cb){
+    _hidl_cb(::golden::size::V1_0::IShapes::descriptor);
+    return ::android::hardware::Void();
+}
+
+::android::hardware::Return<void> IShapes::getHashChain(getHashChain_cb _hidl_cb){
+    _hidl_cb({
+        (uint8_t[32]){0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0} /* 0000000000000000000000000000000000000000000000000000000000000000 */,
+        (uint8_t[32]){40,121,233,138,49,49,96,191,232,47,213,125,109,11,93,95,72,75,98,132,143,119,21,236,173,252,129,232,185,94,214,188} /* 2879e98a313160bfe82fd57d6d0b5d5f484b62848f7715ecadfc81e8b95ed6bc */});
+    return ::android::hardware::Void();
+}
+
+::android::hardware::Return<void> IShapes::setHALInstrumentation(){
+    return ::android::hardware::Void();
+}
+
+::android::hardware::Return<bool> IShapes::linkToDeath(const ::android::sp<::android::hardware::hidl_death_recipient>& recipient, uint64_t cookie){
+    (void)cookie;
+    return (recipient != nullptr);
+}
+
+::android::hardware::Return<void> IShapes::ping(){
+    return ::android::hardware::Void();
+}
+
+::android::hardware::Return<void> IShapes::getDebugInfo(getDebugInfo_cb _hidl_cb){
+    ::android::hidl::base::V1_0::DebugInfo info = {};
+    info.pid = -1;
+    info.ptr = 0;
+    info.arch = 
+    #if defined(__LP64__)
+    ::android::hidl::base::V1_0::DebugInfo::Architecture::IS_64BIT
+    #else
+    ::android::hidl::base::V1_0::DebugInfo::Architecture::IS_32BIT
+    #endif
+    ;
+    _hidl_cb(info);
+    return ::android::hardware::Void();
+}
+
+::android::hardware::Return<void> IShapes::notifySyspropsChanged(){
+    ::android::report_sysprop_change();
+    return ::android::hardware::Void();
+}
+
+::android::hardware::Return<bool> IShapes::unlinkToDeath(const ::android::sp<::android::hardware::hidl_death_recipient>& recipient){
+    return (recipient != nullptr);
+}
+
+
+// Whether remote binders implement this interface, by binder. Entries are
+// evicted when their binder dies, and ignored once it has been destroyed.
+struct _hidl_IShapesCastCache : public ::android::hardware::IBinder::DeathRecipient {
+    static _hidl_IShapesCastCache* get() {
+        // never destroyed, since binder threads may still use it at exit
+        static _hidl_IShapesCastCache* const sCache = [] {
+            _hidl_IShapesCastCache* cache = new _hidl_IShapesCastCache();
+            cache->incStrong(nullptr);
+            return cache;
+        }();
+        return sCache;
+    }
+
+    bool lookup(const ::android::sp<::android::hardware::IBinder>& binder, bool* canCast) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto it = mEntries.find(binder.get());
+        if (it == mEntries.end() || it->second.binder.promote() != binder) {
+            return false;
+        }
+        *canCast = it->second.canCast;
+        return true;
+    }
+
+    void insert(const ::android::sp<::android::hardware::IBinder>& binder, bool canCast) {
+        if (binder->linkToDeath(this) != ::android::OK) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mEntries.size() >= mSweepSize) {
+            // drop the entries of destroyed binders
+            for (auto it = mEntries.begin(); it != mEntries.end();) {
+                it = it->second.binder.promote() == nullptr ? mEntries.erase(it) : std::next(it);
+            }
+            mSweepSize = 2 * std::max<size_t>(mEntries.size(), 16);
+        }
+        mEntries[binder.get()] = {binder, canCast};
+    }
+
+    void binderDied(const ::android::wp<::android::hardware::IBinder>& who) override {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mEntries.erase(who.unsafe_get());
+    }
+
+    struct Entry {
+        ::android::wp<::android::hardware::IBinder> binder;
+        bool canCast;
+    };
+
+    std::mutex mMutex;
+    std::unordered_map<const ::android::hardware::IBinder*, Entry> mEntries;
+    size_t mSweepSize = 16;
+};
+
+::android::hardware::Return<::android::sp<::golden::size::V1_0::IShapes>> IShapes::castFrom(const ::android::sp<::golden::size::V1_0::IShapes>& parent, bool /* emitError */) {
+    return parent;
+}
+
+::android::hardware::Return<::android::sp<::golden::size::V1_0::IShapes>> IShapes::castFrom(const ::android::sp<::android::hidl::base::V1_0::IBase>& parent, bool emitError) {
+    if (parent == nullptr || !parent->isRemote()) {
+        return ::android::hardware::details::castInterface<IShapes, ::android::hidl::base::V1_0::IBase, BpHwShapes>(
+                parent, "golden.size@1.0::IShapes", emitError);
+    }
+
+    // Remote objects don't change interfaces, so interfaceChain() is only
+    // called once per binder.
+    const ::android::sp<::android::hardware::IBinder> _hidl_binder =
+            ::android::hardware::toBinder<::android::hidl::base::V1_0::IBase>(parent);
+    bool _hidl_canCast;
+    if (_hidl_IShapesCastCache::get()->lookup(_hidl_binder, &_hidl_canCast)) {
+        if (!_hidl_canCast) {
+            return ::android::sp<::golden::size::V1_0::IShapes>(nullptr);
+        }
+        return ::android::sp<::golden::size::V1_0::IShapes>(new BpHwShapes(_hidl_binder));
+    }
+
+    // Errors are always requested, so that a failed interfaceChain() call isn't
+    // taken for, and cached as, an interface the binder doesn't implement.
+    ::android::hardware::Return<bool> _hidl_canCast_ret =
+            ::android::hardware::details::canCastInterface(parent.get(), "golden.size@1.0::IShapes", true /* emitError */);
+    if (!_hidl_canCast_ret.isOk()) {
+        if (emitError) {
+            return ::android::hardware::details::StatusOf<bool, ::android::sp<::golden::size::V1_0::IShapes>>(_hidl_canCast_ret);
+        }
+        return ::android::sp<::golden::size::V1_0::IShapes>(nullptr);
+    }
+
+    _hidl_canCast = _hidl_canCast_ret;
+    _hidl_IShapesCastCache::get()->insert(_hidl_binder, _hidl_canCast);
+    if (!_hidl_canCast) {
+        return ::android::sp<::golden::size::V1_0::IShapes>(nullptr);
+    }
+    return ::android::sp<::golden::size::V1_0::IShapes>(new BpHwShapes(_hidl_binder));
+}
+
+__attribute__((noinline)) static ::android::status_t _hidl_writeToParcel(
+        const ::golden::V1_0::Shape& obj, ::android::hardware::Parcel* parcel) {
+    ::android::status_t _hidl_err;
+
+    size_t _hidl_obj_parent;
+
+    _hidl_err = parcel->writeBuffer(&obj, sizeof(obj), &_hidl_obj_parent);
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    _hidl_err = writeEmbeddedToParcel(
+            obj,
+            parcel,
+            _hidl_obj_parent,
+            0 /* parentOffset */);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    return _hidl_err;
+}
+
+__attribute__((noinline)) static ::android::status_t _hidl_readFromParcel(
+        ::golden::V1_0::Shape** _hidl_obj, const ::android::hardware::Parcel& parcel) {
+    ::android::status_t _hidl_err;
+    ::golden::V1_0::Shape* obj;
+
+    size_t _hidl_obj_parent;
+
+    _hidl_err = parcel.readBuffer(sizeof(*obj), &_hidl_obj_parent,  const_cast<const void**>(reinterpret_cast<void **>(&obj)));
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    _hidl_err = readEmbeddedFromParcel(
+            const_cast<::golden::V1_0::Shape &>(*obj),
+            parcel,
+            _hidl_obj_parent,
+            0 /* parentOffset */);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    *_hidl_obj = obj;
+    return _hidl_err;
+}
+
+BpHwShapes::BpHwShapes(const ::android::sp<::android::hardware::IBinder> &_hidl_impl)
+        : BpInterface<IShapes>(_hidl_impl),
+          ::android::hardware::details::HidlInstrumentor("golden.size@1.0", "IShapes") {
+}
+
+// Methods from ::golden::size::V1_0::IShapes follow.
+::android::hardware::Return<void> BpHwShapes::_hidl_transform(::android::hardware::IInterface *_hidl_this, ::android::hardware::details::HidlInstrumentor *_hidl_this_instrumentor, const ::golden::V1_0::Shape& shape, int32_t dx, int32_t dy, transform_cb _hidl_cb) {
+    #ifdef __ANDROID_DEBUGGABLE__
+    bool mEnableInstrumentation = _hidl_this_instrumentor->isInstrumentationEnabled();
+    const auto &mInstrumentationCallbacks = _hidl_this_instrumentor->getInstrumentationCallbacks();
+    #else
+    (void) _hidl_this_instrumentor;
+    #endif // __ANDROID_DEBUGGABLE__
+    if (_hidl_cb == nullptr) {
+        return ::android::hardware::Status::fromExceptionCode(
+                ::android::hardware::Status::EX_ILLEGAL_ARGUMENT,
+                "Null synchronous callback passed.");
+    }
+
+    ::android::ScopedTrace PASTE(___tracer, __LINE__) (ATRACE_TAG_HAL, "HIDL::IShapes::transform::client");
+    #ifdef __ANDROID_DEBUGGABLE__
+    if (UNLIKELY(mEnableInstrumentation)) {
+        void *_hidl_arg_pointers[] = {(void *)&shape, (void *)&dx, (void *)&dy};
+        std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 3);
+        for (const auto &callback: mInstrumentationCallbacks) {
+            callback(InstrumentationEvent::CLIENT_API_ENTRY, "golden.size", "1.0", "IShapes", "transform", &_hidl_args);
+        }
+    }
+    #endif // __ANDROID_DEBUGGABLE__
+
+    ::android::hardware::Parcel _hidl_data;
+    ::android::hardware::Parcel _hidl_reply;
+    ::android::status_t _hidl_err;
+    ::android::hardware::Status _hidl_status;
+
+    ::golden::V1_0::Shape* _hidl_out_result;
+
+    _hidl_data.setDataCapacity(236 + shape.tags.size() * 1 * 40);
+
+    _hidl_err = _hidl_data.writeInterfaceToken(BpHwShapes::descriptor);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    _hidl_err = _hidl_writeToParcel(shape, &_hidl_data);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    _hidl_err = _hidl_data.writeInt32(dx);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    _hidl_err = _hidl_data.writeInt32(dy);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    _hidl_err = ::android::hardware::IInterface::asBinder(_hidl_this)->transact(1 /* transform */, _hidl_data, &_hidl_reply);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    _hidl_err = ::android::hardware::readFromParcel(&_hidl_status, _hidl_reply);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    if (!_hidl_status.isOk()) { return _hidl_status; }
+
+    _hidl_err = _hidl_readFromParcel(&_hidl_out_result, _hidl_reply);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    _hidl_cb(*_hidl_out_result);
+
+    #ifdef __ANDROID_DEBUGGABLE__
+    if (UNLIKELY(mEnableInstrumentation)) {
+        void *_hidl_arg_pointers[] = {(void *)_hidl_out_result};
+        std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+        for (const auto &callback: mInstrumentationCallbacks) {
+            callback(InstrumentationEvent::CLIENT_API_EXIT, "golden.size", "1.0", "IShapes", "transform", &_hidl_args);
+        }
+    }
+    #endif // __ANDROID_DEBUGGABLE__
+
+    _hidl_status.setFromStatusT(_hidl_err);
+    return ::android::hardware::Return<void>();
+
+_hidl_error:
+    _hidl_status.setFromStatusT(_hidl_err);
+    return ::android::hardware::Return<void>(_hidl_status);
+}
+
+::android::hardware::Return<void> BpHwShapes::_hidl_getShape(::android::hardware::IInterface *_hidl_this, ::android::hardware::details::HidlInstrumentor *_hidl_this_instrumentor, const ::android::hardware::hidl_string& name, getShape_cb _hidl_cb) {
+    #ifdef __ANDROID_DEBUGGABLE__
+    bool mEnableInstrumentation = _hidl_this_instrumentor->isInstrumentationEnabled();
+    const auto &mInstrumentationCallbacks = _hidl_this_instrumentor->getInstrumentationCallbacks();
+    #else
+    (void) _hidl_this_instrumentor;
+    #endif // __ANDROID_DEBUGGABLE__
+    if (_hidl_cb == nullptr) {
+        return ::android::hardware::Status::fromExceptionCode(
+                ::android::hardware::Status::EX_ILLEGAL_ARGUMENT,
+                "Null synchronous callback passed.");
+    }
+
+    ::android::ScopedTrace PASTE(___tracer, __LINE__) (ATRACE_TAG_HAL, "HIDL::IShapes::getShape::client");
+    #ifdef __ANDROID_DEBUGGABLE__
+    if (UNLIKELY(mEnableInstrumentation)) {
+        void *_hidl_arg_pointers[] = {(void *)&name};
+        std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+        for (const auto &callback: mInstrumentationCallbacks) {
+            callback(InstrumentationEvent::CLIENT_API_ENTRY, "golden.size", "1.0", "IShapes", "getShape", &_hidl_args);
+        }
+    }
+    #endif // __ANDROID_DEBUGGABLE__
+
+    ::android::hardware::Parcel _hidl_data;
+    ::android::hardware::Parcel _hidl_reply;
+    ::android::status_t _hidl_err;
+    ::android::hardware::Status _hidl_status;
+
+    ::golden::V1_0::Shape* _hidl_out_shape;
+
+    _hidl_data.setDataCapacity(108);
+
+    _hidl_err = _hidl_data.writeInterfaceToken(BpHwShapes::descriptor);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    size_t _hidl_name_parent;
+
+    _hidl_err = _hidl_data.writeBuffer(&name, sizeof(name), &_hidl_name_parent);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+            name,
+            &_hidl_data,
+            _hidl_name_parent,
+            0 /* parentOffset */);
+
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    _hidl_err = ::android::hardware::IInterface::asBinder(_hidl_this)->transact(2 /* getShape */, _hidl_data, &_hidl_reply);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    _hidl_err = ::android::hardware::readFromParcel(&_hidl_status, _hidl_reply);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    if (!_hidl_status.isOk()) { return _hidl_status; }
+
+    _hidl_err = _hidl_readFromParcel(&_hidl_out_shape, _hidl_reply);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    _hidl_cb(*_hidl_out_shape);
+
+    #ifdef __ANDROID_DEBUGGABLE__
+    if (UNLIKELY(mEnableInstrumentation)) {
+        void *_hidl_arg_pointers[] = {(void *)_hidl_out_shape};
+        std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+        for (const auto &callback: mInstrumentationCallbacks) {
+            callback(InstrumentationEvent::CLIENT_API_EXIT, "golden.size", "1.0", "IShapes", "getShape", &_hidl_args);
+        }
+    }
+    #endif // __ANDROID_DEBUGGABLE__
+
+    _hidl_status.setFromStatusT(_hidl_err);
+    return ::android::hardware::Return<void>();
+
+_hidl_error:
+    _hidl_status.setFromStatusT(_hidl_err);
+    return ::android::hardware::Return<void>(_hidl_status);
+}
+
+::android::hardware::Return<void> BpHwShapes::_hidl_setScene(::android::hardware::IInterface *_hidl_this, ::android::hardware::details::HidlInstrumentor *_hidl_this_instrumentor, const ::golden::V1_0::Scene& scene) {
+    #ifdef __ANDROID_DEBUGGABLE__
+    bool mEnableInstrumentation = _hidl_this_instrumentor->isInstrumentationEnabled();
+    const auto &mInstrumentationCallbacks = _hidl_this_instrumentor->getInstrumentationCallbacks();
+    #else
+    (void) _hidl_this_instrumentor;
+    #endif // __ANDROID_DEBUGGABLE__
+    ::android::ScopedTrace PASTE(___tracer, __LINE__) (ATRACE_TAG_HAL, "HIDL::IShapes::setScene::client");
+    #ifdef __ANDROID_DEBUGGABLE__
+    if (UNLIKELY(mEnableInstrumentation)) {
+        void *_hidl_arg_pointers[] = {(void *)&scene};
+        std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+        for (const auto &callback: mInstrumentationCallbacks) {
+            callback(InstrumentationEvent::CLIENT_API_ENTRY, "golden.size", "1.0", "IShapes", "setScene", &_hidl_args);
+        }
+    }
+    #endif // __ANDROID_DEBUGGABLE__
+
+    ::android::hardware::Parcel _hidl_data;
+    ::android::hardware::Parcel _hidl_reply;
+    ::android::status_t _hidl_err;
+    ::android::hardware::Status _hidl_status;
+
+    _hidl_data.setDataCapacity(148 + scene.shapes.size() * 4 * 40);
+
+    _hidl_err = _hidl_data.writeInterfaceToken(BpHwShapes::descriptor);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    size_t _hidl_scene_parent;
+
+    _hidl_err = _hidl_data.writeBuffer(&scene, sizeof(scene), &_hidl_scene_parent);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    _hidl_err = writeEmbeddedToParcel(
+            scene,
+            &_hidl_data,
+            _hidl_scene_parent,
+            0 /* parentOffset */);
+
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    _hidl_err = ::android::hardware::IInterface::asBinder(_hidl_this)->transact(3 /* setScene */, _hidl_data, &_hidl_reply);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    _hidl_err = ::android::hardware::readFromParcel(&_hidl_status, _hidl_reply);
+    if (_hidl_err != ::android::OK) { goto _hidl_error; }
+
+    if (!_hidl_status.isOk()) { return _hidl_status; }
+
+    #ifdef __ANDROID_DEBUGGABLE__
+    if (UNLIKELY(mEnableInstrumentation)) {
+        std::vector<void *> _hidl_args;
+        for (const auto &callback: mInstrumentationCallbacks) {
+            callback(InstrumentationEvent::CLIENT_API_EXIT, "golden.size", "1.0", "IShapes", "setScene", &_hidl_args);
+        }
+    }
+    #endif // __ANDROID_DEBUGGABLE__
+
+    _hidl_status.setFromStatusT(_hidl_err);
+    return ::android::hardware::Return<void>();
+
+_hidl_error:
+    _hidl_status.setFromStatusT(_hidl_err);
+    return ::android::hardware::Return<void>(_hidl_status);
+}
+
+
+// Methods from ::golden::size::V1_0::IShapes follow.
+::android::hardware::Return<void> BpHwShapes::transform(const ::golden::V1_0::Shape& shape, int32_t dx, int32_t dy, transform_cb _hidl_cb){
+    ::android::hardware::Return<void>  _hidl_out = ::golden::size::V1_0::BpHwShapes::_hidl_transform(this, this, shape, dx, dy, _hidl_cb);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<void> BpHwShapes::getShape(const ::android::hardware::hidl_string& name, getShape_cb _hidl_cb){
+    ::android::hardware::Return<void>  _hidl_out = ::golden::size::V1_0::BpHwShapes::_hidl_getShape(this, this, name, _hidl_cb);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<void> BpHwShapes::setScene(const ::golden::V1_0::Scene& scene){
+    ::android::hardware::Return<void>  _hidl_out = ::golden::size::V1_0::BpHwShapes::_hidl_setScene(this, this, scene);
+
+    return _hidl_out;
+}
+
+
+// Methods from ::android::hidl::base::V1_0::IBase follow.
+::android::hardware::Return<void> BpHwShapes::interfaceChain(interfaceChain_cb _hidl_cb){
+    ::android::hardware::Return<void>  _hidl_out = ::android::hidl::base::V1_0::BpHwBase::_hidl_interfaceChain(this, this, _hidl_cb);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<void> BpHwShapes::debug(const ::android::hardware::hidl_handle& fd, const ::android::hardware::hidl_vec<::android::hardware::hidl_string>& options){
+    ::android::hardware::Return<void>  _hidl_out = ::android::hidl::base::V1_0::BpHwBase::_hidl_debug(this, this, fd, options);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<void> BpHwShapes::interfaceDescriptor(interfaceDescriptor_cb _hidl_cb){
+    ::android::hardware::Return<void>  _hidl_out = ::android::hidl::base::V1_0::BpHwBase::_hidl_interfaceDescriptor(this, this, _hidl_cb);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<void> BpHwShapes::getHashChain(getHashChain_cb _hidl_cb){
+    ::android::hardware::Return<void>  _hidl_out = ::android::hidl::base::V1_0::BpHwBase::_hidl_getHashChain(this, this, _hidl_cb);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<void> BpHwShapes::setHALInstrumentation(){
+    ::android::hardware::Return<void>  _hidl_out = ::android::hidl::base::V1_0::BpHwBase::_hidl_setHALInstrumentation(this, this);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<bool> BpHwShapes::linkToDeath(const ::android::sp<::android::hardware::hidl_death_recipient>& recipient, uint64_t cookie){
+    ::android::hardware::ProcessState::self()->startThreadPool();
+    ::android::hardware::hidl_binder_death_recipient *binder_recipient = new ::android::hardware::hidl_binder_death_recipient(recipient, cookie, this);
+    std::unique_lock<std::mutex> lock(_hidl_mMutex);
+    _hidl_mDeathRecipients.push_back(binder_recipient);
+    return (remote()->linkToDeath(binder_recipient) == ::android::OK);
+}
+
+::android::hardware::Return<void> BpHwShapes::ping(){
+    ::android::hardware::Return<void>  _hidl_out = ::android::hidl::base::V1_0::BpHwBase::_hidl_ping(this, this);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<void> BpHwShapes::getDebugInfo(getDebugInfo_cb _hidl_cb){
+    ::android::hardware::Return<void>  _hidl_out = ::android::hidl::base::V1_0::BpHwBase::_hidl_getDebugInfo(this, this, _hidl_cb);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<void> BpHwShapes::notifySyspropsChanged(){
+    ::android::hardware::Return<void>  _hidl_out = ::android::hidl::base::V1_0::BpHwBase::_hidl_notifySyspropsChanged(this, this);
+
+    return _hidl_out;
+}
+
+::android::hardware::Return<bool> BpHwShapes::unlinkToDeath(const ::android::sp<::android::hardware::hidl_death_recipient>& recipient){
+    std::unique_lock<std::mutex> lock(_hidl_mMutex);
+    for (auto it = _hidl_mDeathRecipients.rbegin();it != _hidl_mDeathRecipients.rend();++it) {
+        if ((*it)->getRecipient() == recipient) {
+            ::android::status_t status = remote()->unlinkToDeath(*it);
+            _hidl_mDeathRecipients.erase(it.base()-1);
+            return status == ::android::OK;
+        }
+    }
+    return false;
+}
+
+
+BnHwShapes::BnHwShapes(const ::android::sp<IShapes> &_hidl_impl)
+        : ::android::hidl::base::V1_0::BnHwBase(_hidl_impl, "golden.size@1.0", "IShapes") { 
+            _hidl_mImpl = _hidl_impl;
+            auto prio = ::android::hardware::details::gServicePrioMap->get(_hidl_impl, {SCHED_NORMAL, 0});
+            mSchedPolicy = prio.sched_policy;
+            mSchedPriority = prio.prio;
+            setRequestingSid(::android::hardware::details::gServiceSidMap->get(_hidl_impl, false));
+}
+
+BnHwShapes::~BnHwShapes() {
+    ::android::hardware::details::gBnMap->eraseIfEqual(_hidl_mImpl.get(), this);
+}
+
+// Methods from ::golden::size::V1_0::IShapes follow.
+::android::status_t BnHwShapes::_hidl_transform(
+        ::android::hidl::base::V1_0::BnHwBase* _hidl_this,
+        const ::android::hardware::Parcel &_hidl_data,
+        ::android::hardware::Parcel *_hidl_reply,
+        TransactCallback _hidl_cb) {
+    #ifdef __ANDROID_DEBUGGABLE__
+    bool mEnableInstrumentation = _hidl_this->isInstrumentationEnabled();
+    const auto &mInstrumentationCallbacks = _hidl_this->getInstrumentationCallbacks();
+    #endif // __ANDROID_DEBUGGABLE__
+
+    ::android::status_t _hidl_err = ::android::OK;
+    if (!_hidl_data.enforceInterface(BnHwShapes::Pure::descriptor)) {
+        _hidl_err = ::android::BAD_TYPE;
+        return _hidl_err;
+    }
+
+    ::golden::V1_0::Shape* shape;
+    int32_t dx;
+    int32_t dy;
+
+    _hidl_err = _hidl_readFromParcel(&shape, _hidl_data);
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    _hidl_err = _hidl_data.readInt32(&dx);
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    _hidl_err = _hidl_data.readInt32(&dy);
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    atrace_begin(ATRACE_TAG_HAL, "HIDL::IShapes::transform::server");
+    #ifdef __ANDROID_DEBUGGABLE__
+    if (UNLIKELY(mEnableInstrumentation)) {
+        void *_hidl_arg_pointers[] = {(void *)shape, (void *)&dx, (void *)&dy};
+        std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 3);
+        for (const auto &callback: mInstrumentationCallbacks) {
+            callback(InstrumentationEvent::SERVER_API_ENTRY, "golden.size", "1.0", "IShapes", "transform", &_hidl_args);
+        }
+    }
+    #endif // __ANDROID_DEBUGGABLE__
+
+    bool _hidl_callbackCalled = false;
+
+    ::android::hardware::Return<void> _hidl_ret = static_cast<IShapes*>(_hidl_this->getImpl().get())->transform(*shape, dx, dy, [&](const auto &_hidl_out_result) {
+        if (_hidl_callbackCalled) {
+            LOG_ALWAYS_FATAL("transform: _hidl_cb called a second time, but must be called once.");
+        }
+        _hidl_callbackCalled = true;
+
+        ::android::hardware::writeToParcel(::android::hardware::Status::ok(), _hidl_reply);
+
+        _hidl_err = _hidl_writeToParcel(_hidl_out_result, _hidl_reply);
+        /* _hidl_err ignored! */
+
+        atrace_end(ATRACE_TAG_HAL);
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            void *_hidl_arg_pointers[] = {(void *)&_hidl_out_result};
+            std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::SERVER_API_EXIT, "golden.size", "1.0", "IShapes", "transform", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        _hidl_cb(*_hidl_reply);
+    });
+
+    _hidl_ret.assertOk();
+    if (!_hidl_callbackCalled) {
+        LOG_ALWAYS_FATAL("transform: _hidl_cb not called, but must be called once.");
+    }
+
+    return _hidl_err;
+}
+
+::android::status_t BnHwShapes::_hidl_getShape(
+        ::android::hidl::base::V1_0::BnHwBase* _hidl_this,
+        const ::android::hardware::Parcel &_hidl_data,
+        ::android::hardware::Parcel *_hidl_reply,
+        TransactCallback _hidl_cb) {
+    #ifdef __ANDROID_DEBUGGABLE__
+    bool mEnableInstrumentation = _hidl_this->isInstrumentationEnabled();
+    const auto &mInstrumentationCallbacks = _hidl_this->getInstrumentationCallbacks();
+    #endif // __ANDROID_DEBUGGABLE__
+
+    ::android::status_t _hidl_err = ::android::OK;
+    if (!_hidl_data.enforceInterface(BnHwShapes::Pure::descriptor)) {
+        _hidl_err = ::android::BAD_TYPE;
+        return _hidl_err;
+    }
+
+    const ::android::hardware::hidl_string* name;
+
+    size_t _hidl_name_parent;
+
+    _hidl_err = _hidl_data.readBuffer(sizeof(*name), &_hidl_name_parent,  reinterpret_cast<const void **>(&name));
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+            const_cast<::android::hardware::hidl_string &>(*name),
+            _hidl_data,
+            _hidl_name_parent,
+            0 /* parentOffset */);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    atrace_begin(ATRACE_TAG_HAL, "HIDL::IShapes::getShape::server");
+    #ifdef __ANDROID_DEBUGGABLE__
+    if (UNLIKELY(mEnableInstrumentation)) {
+        void *_hidl_arg_pointers[] = {(void *)name};
+        std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+        for (const auto &callback: mInstrumentationCallbacks) {
+            callback(InstrumentationEvent::SERVER_API_ENTRY, "golden.size", "1.0", "IShapes", "getShape", &_hidl_args);
+        }
+    }
+    #endif // __ANDROID_DEBUGGABLE__
+
+    bool _hidl_callbackCalled = false;
+
+    ::android::hardware::Return<void> _hidl_ret = static_cast<IShapes*>(_hidl_this->getImpl().get())->getShape(*name, [&](const auto &_hidl_out_shape) {
+        if (_hidl_callbackCalled) {
+            LOG_ALWAYS_FATAL("getShape: _hidl_cb called a second time, but must be called once.");
+        }
+        _hidl_callbackCalled = true;
+
+        ::android::hardware::writeToParcel(::android::hardware::Status::ok(), _hidl_reply);
+
+        _hidl_err = _hidl_writeToParcel(_hidl_out_shape, _hidl_reply);
+        /* _hidl_err ignored! */
+
+        atrace_end(ATRACE_TAG_HAL);
+        #ifdef __ANDROID_DEBUGGABLE__
+        if (UNLIKELY(mEnableInstrumentation)) {
+            void *_hidl_arg_pointers[] = {(void *)&_hidl_out_shape};
+            std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+            for (const auto &callback: mInstrumentationCallbacks) {
+                callback(InstrumentationEvent::SERVER_API_EXIT, "golden.size", "1.0", "IShapes", "getShape", &_hidl_args);
+            }
+        }
+        #endif // __ANDROID_DEBUGGABLE__
+
+        _hidl_cb(*_hidl_reply);
+    });
+
+    _hidl_ret.assertOk();
+    if (!_hidl_callbackCalled) {
+        LOG_ALWAYS_FATAL("getShape: _hidl_cb not called, but must be called once.");
+    }
+
+    return _hidl_err;
+}
+
+::android::status_t BnHwShapes::_hidl_setScene(
+        ::android::hidl::base::V1_0::BnHwBase* _hidl_this,
+        const ::android::hardware::Parcel &_hidl_data,
+        ::android::hardware::Parcel *_hidl_reply,
+        TransactCallback _hidl_cb) {
+    #ifdef __ANDROID_DEBUGGABLE__
+    bool mEnableInstrumentation = _hidl_this->isInstrumentationEnabled();
+    const auto &mInstrumentationCallbacks = _hidl_this->getInstrumentationCallbacks();
+    #endif // __ANDROID_DEBUGGABLE__
+
+    ::android::status_t _hidl_err = ::android::OK;
+    if (!_hidl_data.enforceInterface(BnHwShapes::Pure::descriptor)) {
+        _hidl_err = ::android::BAD_TYPE;
+        return _hidl_err;
+    }
+
+    ::golden::V1_0::Scene* scene;
+
+    size_t _hidl_scene_parent;
+
+    _hidl_err = _hidl_data.readBuffer(sizeof(*scene), &_hidl_scene_parent,  const_cast<const void**>(reinterpret_cast<void **>(&scene)));
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    _hidl_err = readEmbeddedFromParcel(
+            const_cast<::golden::V1_0::Scene &>(*scene),
+            _hidl_data,
+            _hidl_scene_parent,
+            0 /* parentOffset */);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    atrace_begin(ATRACE_TAG_HAL, "HIDL::IShapes::setScene::server");
+    #ifdef __ANDROID_DEBUGGABLE__
+    if (UNLIKELY(mEnableInstrumentation)) {
+        void *_hidl_arg_pointers[] = {(void *)scene};
+        std::vector<void *> _hidl_args(_hidl_arg_pointers, _hidl_arg_pointers + 1);
+        for (const auto &callback: mInstrumentationCallbacks) {
+            callback(InstrumentationEvent::SERVER_API_ENTRY, "golden.size", "1.0", "IShapes", "setScene", &_hidl_args);
+        }
+    }
+    #endif // __ANDROID_DEBUGGABLE__
+
+    ::android::hardware::Return<void> _hidl_ret = static_cast<IShapes*>(_hidl_this->getImpl().get())->setScene(*scene);
+
+    (void) _hidl_cb;
+
+    atrace_end(ATRACE_TAG_HAL);
+    #ifdef __ANDROID_DEBUGGABLE__
+    if (UNLIKELY(mEnableInstrumentation)) {
+        std::vector<void *> _hidl_args;
+        for (const auto &callback: mInstrumentationCallbacks) {
+            callback(InstrumentationEvent::SERVER_API_EXIT, "golden.size", "1.0", "IShapes", "setScene", &_hidl_args);
+        }
+    }
+    #endif // __ANDROID_DEBUGGABLE__
+
+    _hidl_ret.assertOk();
+    ::android::hardware::writeToParcel(::android::hardware::Status::ok(), _hidl_reply);
+
+    return _hidl_err;
+}
+
+
+// Methods from ::golden::size::V1_0::IShapes follow.
+
+// Methods from ::android::hidl::base::V1_0::IBase follow.
+::android::hardware::Return<void> BnHwShapes::ping() {
+    return ::android::hardware::Void();
+}
+::android::hardware::Return<void> BnHwShapes::getDebugInfo(getDebugInfo_cb _hidl_cb) {
+    ::android::hidl::base::V1_0::DebugInfo info = {};
+    info.pid = ::android::hardware::details::getPidIfSharable();
+    info.ptr = ::android::hardware::details::debuggable()? reinterpret_cast<uint64_t>(this) : 0;
+    info.arch = 
+    #if defined(__LP64__)
+    ::android::hidl::base::V1_0::DebugInfo::Architecture::IS_64BIT
+    #else
+    ::android::hidl::base::V1_0::DebugInfo::Architecture::IS_32BIT
+    #endif
+    ;
+    _hidl_cb(info);
+    return ::android::hardware::Void();
+}
+
+::android::status_t BnHwShapes::onTransact(
+        uint32_t _hidl_code,
+        const ::android::hardware::Parcel &_hidl_data,
+        ::android::hardware::Parcel *_hidl_reply,
+        uint32_t _hidl_flags,
+        TransactCallback _hidl_cb) {
+    ::android::status_t _hidl_err = ::android::OK;
+
+    static constexpr struct {
+        ::android::status_t (*method)(
+                ::android::hidl::base::V1_0::BnHwBase* _hidl_this,
+                const ::android::hardware::Parcel &_hidl_data,
+                ::android::hardware::Parcel *_hidl_reply,
+                TransactCallback _hidl_cb);
+        bool oneway;
+    } kMethods[] = {
+        {&::golden::size::V1_0::BnHwShapes::_hidl_transform, false},  // 1: transform
+        {&::golden::size::V1_0::BnHwShapes::_hidl_getShape, false},  // 2: getShape
+        {&::golden::size::V1_0::BnHwShapes::_hidl_setScene, false},  // 3: setScene
+    };
+
+    const uint32_t _hidl_index = _hidl_code - 1 /* FIRST_CALL_TRANSACTION */;
+    if (_hidl_index < 3) {
+        bool _hidl_is_oneway = _hidl_flags & 1u /* oneway */;
+        if (_hidl_is_oneway != kMethods[_hidl_index].oneway) {
+            return ::android::UNKNOWN_ERROR;
+        }
+
+        _hidl_err = kMethods[_hidl_index].method(this, _hidl_data, _hidl_reply, _hidl_cb);
+    } else {
+        return ::android::hidl::base::V1_0::BnHwBase::onTransact(
+                _hidl_code, _hidl_data, _hidl_reply, _hidl_flags, _hidl_cb);
+    }
+
+    if (_hidl_err == ::android::UNEXPECTED_NULL) {
+        _hidl_err = ::android::hardware::writeToParcel(
+                ::android::hardware::Status::fromExceptionCode(::android::hardware::Status::EX_NULL_POINTER),
+                _hidl_reply);
+    }return _hidl_err;
+}
+
+struct BsShapes::OnewayQueue : public std::enable_shared_from_this<OnewayQueue> {
+    struct Slot {
+        std::atomic<size_t> sequence;
+        std::function<void(void)> task;
+    };
+
+    explicit OnewayQueue(size_t capacity) : mCapacity(capacity), mSlots(new Slot[capacity]) {
+        for (size_t i = 0; i < mCapacity; i++) {
+            mSlots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool push(std::function<void(void)>&& task) {
+        std::call_once(mStarted, [self = shared_from_this()] {
+            std::thread([self] { self->run(); }).detach();
+        });
+
+        size_t tail = mTail.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = mSlots[tail % mCapacity];
+            const intptr_t diff = static_cast<intptr_t>(
+                    slot.sequence.load(std::memory_order_acquire) - tail);
+            if (diff == 0) {
+                if (mTail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) {
+                    slot.task = std::move(task);
+                    slot.sequence.store(tail + 1);
+                    break;
+                }
+            } else if (diff < 0) {
+                // the consumer has not emptied this slot yet
+                mDropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                tail = mTail.load(std::memory_order_relaxed);
+            }
+        }
+
+        if (mWaiting.load()) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mCondition.notify_one();
+        }
+        return true;
+    }
+
+    void stop() {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopped = true;
+        mCondition.notify_one();
+    }
+
+    void run() {
+        for (size_t head = 0;; head++) {
+            Slot& slot = mSlots[head % mCapacity];
+            auto ready = [&] { return slot.sequence.load() == head + 1; };
+            if (!ready()) {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mWaiting.store(true);
+                mCondition.wait(lock, [&] { return ready() || mStopped; });
+                mWaiting.store(false);
+                if (!ready()) return;
+            }
+            std::function<void(void)> task = std::move(slot.task);
+            slot.task = nullptr;
+            slot.sequence.store(head + mCapacity, std::memory_order_release);
+            mHead.store(head + 1, std::memory_order_relaxed);
+            task();
+        }
+    }
+
+    const size_t mCapacity;
+    const std::unique_ptr<Slot[]> mSlots;
+    std::atomic<size_t> mHead{0};
+    std::atomic<size_t> mTail{0};
+    std::atomic<uint64_t> mDropped{0};
+    std::atomic<bool> mWaiting{false};
+    std::once_flag mStarted;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    bool mStopped = false;
+};
+
+BsShapes::BsShapes(const ::android::sp<::golden::size::V1_0::IShapes> impl) : ::android::hardware::details::HidlInstrumentor("golden.size@1.0", "IShapes"), mImpl(impl),
+        mOnewayQueue(std::make_shared<OnewayQueue>(3000)) {}
+
+BsShapes::~BsShapes() {
+    // the consumer thread finishes the queued calls, then exits
+    mOnewayQueue->stop();
+}
+
+size_t BsShapes::getOnewayQueueDepth() const {
+    return mOnewayQueue->mTail.load(std::memory_order_relaxed) -
+            mOnewayQueue->mHead.load(std::memory_order_relaxed);
+}
+
+uint64_t BsShapes::getOnewayDropCount() const {
+    return mOnewayQueue->mDropped.load(std::memory_order_relaxed);
+}
+
+::android::hardware::Return<void> BsShapes::addOnewayTask(std::function<void(void)>&& task) {
+    if (!mOnewayQueue->push(std::move(task))) {
+        return ::android::hardware::Status::fromExceptionCode(
+                ::android::hardware::Status::EX_TRANSACTION_FAILED,
+                "Passthrough oneway function queue exceeds maximum size.");
+    }
+    return ::android::hardware::Status();
+}
+
+::android::sp<IShapes> IShapes::tryGetService(const std::string &serviceName, const bool getStub) {
+    return ::android::hardware::details::getServiceInternal<BpHwShapes>(serviceName, false, getStub);
+}
+
+::android::sp<IShapes> IShapes::getService(const std::string &serviceName, const bool getStub) {
+    return ::android::hardware::details::getServiceInternal<BpHwShapes>(serviceName, true, getStub);
+}
+
+::android::status_t IShapes::registerAsService(const std::string &serviceName) {
+    return ::android::hardware::details::registerAsServiceInternal(this, serviceName);
+}
+
+bool IShapes::registerForNotifications(
+        const std::string &serviceName,
+        const ::android::sp<::android::hidl::manager::V1_0::IServiceNotification> &notification) {
+    const ::android::sp<::android::hidl::manager::V1_0::IServiceManager> sm
+            = ::android::hardware::defaultServiceManager();
+    if (sm == nullptr) {
+        return false;
+    }
+    ::android::hardware::Return<bool> success =
+            sm->registerForNotifications("golden.size@1.0::IShapes",
+                    serviceName, notification);
+    return success.isOk() && success;
+}
+
+static_assert(sizeof(::android::hardware::MQDescriptor<char, ::android::hardware::kSynchronizedReadWrite>) == 32, "wrong size");
+static_assert(sizeof(::android::hardware::hidl_handle) == 16, "wrong size");
+static_assert(sizeof(::android::hardware::hidl_memory) == 40, "wrong size");
+static_assert(sizeof(::android::hardware::hidl_string) == 16, "wrong size");
+static_assert(sizeof(::android::hardware::hidl_vec<char>) == 16, "wrong size");
+
+}  // namespace V1_0
+}  // namespace size
+}  // namespace golden
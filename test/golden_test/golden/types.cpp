@@ -0,0 +1,325 @@
+#define LOG_TAG "golden@1.0::types"
+
+#include <log/log.h>
+#include <cutils/trace.h>
+#include <hidl/HidlTransportSupport.h>
+
+#include <hidl/Static.h>
+#include <hwbinder/ProcessState.h>
+#include <utils/Trace.h>
+#include <golden/1.0/types.h>
+#include <golden/1.0/hwtypes.h>
+
+namespace golden {
+namespace V1_0 {
+
+::android::status_t readEmbeddedFromParcel(
+        const Shape &obj,
+        const ::android::hardware::Parcel &parcel,
+        size_t parentHandle,
+        size_t parentOffset) {
+    ::android::status_t _hidl_err = ::android::OK;
+
+    _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+            const_cast<::android::hardware::hidl_string &>(obj.name),
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Shape, name));
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_points_child;
+
+    _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+            const_cast<::android::hardware::hidl_vec<::golden::V1_0::Point> &>(obj.points),
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Shape, points), &_hidl_points_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_data_child;
+
+    _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+            const_cast<::android::hardware::hidl_vec<uint8_t> &>(obj.data),
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Shape, data), &_hidl_data_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_tags_child;
+
+    _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+            const_cast<::android::hardware::hidl_vec<::android::hardware::hidl_string> &>(obj.tags),
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Shape, tags), &_hidl_tags_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < obj.tags.size(); ++_hidl_index_0) {
+        _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+                const_cast<::android::hardware::hidl_string &>(obj.tags[_hidl_index_0]),
+                parcel,
+                _hidl_tags_child,
+                _hidl_index_0 * sizeof(::android::hardware::hidl_string));
+
+        if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    }
+
+    return _hidl_err;
+}
+
+::android::status_t writeEmbeddedToParcel(
+        const Shape &obj,
+        ::android::hardware::Parcel *parcel,
+        size_t parentHandle,
+        size_t parentOffset) {
+    ::android::status_t _hidl_err = ::android::OK;
+
+    _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+            obj.name,
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Shape, name));
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_points_child;
+
+    _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+            obj.points,
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Shape, points), &_hidl_points_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_data_child;
+
+    _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+            obj.data,
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Shape, data), &_hidl_data_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_tags_child;
+
+    _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+            obj.tags,
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Shape, tags), &_hidl_tags_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < obj.tags.size(); ++_hidl_index_0) {
+        _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+                obj.tags[_hidl_index_0],
+                parcel,
+                _hidl_tags_child,
+                _hidl_index_0 * sizeof(::android::hardware::hidl_string));
+
+        if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    }
+
+    return _hidl_err;
+}
+
+::android::status_t readEmbeddedFromParcel(
+        const Scene &obj,
+        const ::android::hardware::Parcel &parcel,
+        size_t parentHandle,
+        size_t parentOffset) {
+    ::android::status_t _hidl_err = ::android::OK;
+
+    size_t _hidl_shapes_child;
+
+    _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+            const_cast<::android::hardware::hidl_vec<::golden::V1_0::Shape> &>(obj.shapes),
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Scene, shapes), &_hidl_shapes_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < obj.shapes.size(); ++_hidl_index_0) {
+        _hidl_err = readEmbeddedFromParcel(
+                const_cast<::golden::V1_0::Shape &>(obj.shapes[_hidl_index_0]),
+                parcel,
+                _hidl_shapes_child,
+                _hidl_index_0 * sizeof(::golden::V1_0::Shape));
+
+        if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    }
+
+    size_t _hidl_ids_child;
+
+    _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+            const_cast<::android::hardware::hidl_vec<int32_t> &>(obj.ids),
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Scene, ids), &_hidl_ids_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    return _hidl_err;
+}
+
+::android::status_t writeEmbeddedToParcel(
+        const Scene &obj,
+        ::android::hardware::Parcel *parcel,
+        size_t parentHandle,
+        size_t parentOffset) {
+    ::android::status_t _hidl_err = ::android::OK;
+
+    size_t _hidl_shapes_child;
+
+    _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+            obj.shapes,
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Scene, shapes), &_hidl_shapes_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < obj.shapes.size(); ++_hidl_index_0) {
+        _hidl_err = writeEmbeddedToParcel(
+                obj.shapes[_hidl_index_0],
+                parcel,
+                _hidl_shapes_child,
+                _hidl_index_0 * sizeof(::golden::V1_0::Shape));
+
+        if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    }
+
+    size_t _hidl_ids_child;
+
+    _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+            obj.ids,
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Scene, ids), &_hidl_ids_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    return _hidl_err;
+}
+
+::android::status_t readEmbeddedFromParcel(
+        const Samples &obj,
+        const ::android::hardware::Parcel &parcel,
+        size_t parentHandle,
+        size_t parentOffset) {
+    ::android::status_t _hidl_err = ::android::OK;
+
+    size_t _hidl_values_child;
+
+    _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+            const_cast<::android::hardware::hidl_vec<int16_t> &>(obj.values),
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Samples, values), &_hidl_values_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_colors_child;
+
+    _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+            const_cast<::android::hardware::hidl_vec<::golden::V1_0::Color> &>(obj.colors),
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Samples, colors), &_hidl_colors_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_labels_child;
+
+    _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+            const_cast<::android::hardware::hidl_vec<::android::hardware::hidl_string> &>(obj.labels),
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Samples, labels), &_hidl_labels_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < obj.labels.size(); ++_hidl_index_0) {
+        _hidl_err = ::android::hardware::readEmbeddedFromParcel(
+                const_cast<::android::hardware::hidl_string &>(obj.labels[_hidl_index_0]),
+                parcel,
+                _hidl_labels_child,
+                _hidl_index_0 * sizeof(::android::hardware::hidl_string));
+
+        if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    }
+
+    return _hidl_err;
+}
+
+::android::status_t writeEmbeddedToParcel(
+        const Samples &obj,
+        ::android::hardware::Parcel *parcel,
+        size_t parentHandle,
+        size_t parentOffset) {
+    ::android::status_t _hidl_err = ::android::OK;
+
+    size_t _hidl_values_child;
+
+    _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+            obj.values,
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Samples, values), &_hidl_values_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_colors_child;
+
+    _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+            obj.colors,
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Samples, colors), &_hidl_colors_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    size_t _hidl_labels_child;
+
+    _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+            obj.labels,
+            parcel,
+            parentHandle,
+            parentOffset + offsetof(::golden::V1_0::Samples, labels), &_hidl_labels_child);
+
+    if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < obj.labels.size(); ++_hidl_index_0) {
+        _hidl_err = ::android::hardware::writeEmbeddedToParcel(
+                obj.labels[_hidl_index_0],
+                parcel,
+                _hidl_labels_child,
+                _hidl_index_0 * sizeof(::android::hardware::hidl_string));
+
+        if (_hidl_err != ::android::OK) { return _hidl_err; }
+
+    }
+
+    return _hidl_err;
+}
+
+static_assert(sizeof(::android::hardware::MQDescriptor<char, ::android::hardware::kSynchronizedReadWrite>) == 32, "wrong size");
+static_assert(sizeof(::android::hardware::hidl_handle) == 16, "wrong size");
+static_assert(sizeof(::android::hardware::hidl_memory) == 40, "wrong size");
+static_assert(sizeof(::android::hardware::hidl_string) == 16, "wrong size");
+static_assert(sizeof(::android::hardware::hidl_vec<char>) == 16, "wrong size");
+
+}  // namespace V1_0
+}  // namespace golden
@@ -0,0 +1,784 @@
+#ifndef HIDL_GENERATED_GOLDEN_V1_0_TYPES_H
+#define HIDL_GENERATED_GOLDEN_V1_0_TYPES_H
+
+#include <string.h>
+#include <functional>
+
+#include <hidl/HidlSupport.h>
+#include <hidl/MQDescriptor.h>
+#include <utils/NativeHandle.h>
+#include <utils/misc.h>
+
+namespace golden {
+namespace V1_0 {
+
+// Forward declaration for forward reference support:
+enum class Color : int32_t;
+enum class Flag : uint8_t;
+enum class Access : int8_t;
+struct Point;
+struct Shape;
+struct Scene;
+struct Samples;
+
+enum class Color : int32_t {
+    RED = 0,
+    GREEN = 5,
+    BLUE = 6 /* (::golden::V1_0::Color.GREEN implicitly + 1) */,
+    CRIMSON = 0 /* RED */,
+};
+
+enum class Flag : uint8_t {
+    NONE = 0,
+    A = 1 /* (1 << 0) */,
+    B = 2 /* (1 << 1) */,
+    AB = 3 /* (A | B) */,
+};
+
+enum class Access : int8_t {
+    NO_ACCESS = 0,
+    READ = 1 /* (1 << 0) */,
+    WRITE = 2 /* (1 << 1) */,
+    EXECUTE = 8 /* (1 << 3) */,
+    SETUID = -128 /* (1 << 7) */,
+};
+
+struct Point final {
+    int32_t x __attribute__ ((aligned(4)));
+    int32_t y __attribute__ ((aligned(4)));
+};
+
+static_assert(offsetof(::golden::V1_0::Point, x) == 0, "wrong offset");
+static_assert(offsetof(::golden::V1_0::Point, y) == 4, "wrong offset");
+static_assert(sizeof(::golden::V1_0::Point) == 8, "wrong size");
+static_assert(__alignof(::golden::V1_0::Point) == 4, "wrong alignment");
+
+struct Shape final {
+    // Forward declaration for forward reference support:
+    struct Nested;
+
+    struct Nested final {
+        uint8_t a __attribute__ ((aligned(1)));
+        int64_t b __attribute__ ((aligned(8)));
+    };
+
+    static_assert(offsetof(::golden::V1_0::Shape::Nested, a) == 0, "wrong offset");
+    static_assert(offsetof(::golden::V1_0::Shape::Nested, b) == 8, "wrong offset");
+    static_assert(sizeof(::golden::V1_0::Shape::Nested) == 16, "wrong size");
+    static_assert(__alignof(::golden::V1_0::Shape::Nested) == 8, "wrong alignment");
+
+    ::android::hardware::hidl_string name __attribute__ ((aligned(8)));
+    ::golden::V1_0::Color color __attribute__ ((aligned(4)));
+    ::android::hardware::hidl_bitfield<::golden::V1_0::Flag> flags __attribute__ ((aligned(1)));
+    ::android::hardware::hidl_array<::golden::V1_0::Point, 2> corners __attribute__ ((aligned(4)));
+    ::android::hardware::hidl_vec<::golden::V1_0::Point> points __attribute__ ((aligned(8)));
+    ::android::hardware::hidl_vec<uint8_t> data __attribute__ ((aligned(8)));
+    ::android::hardware::hidl_vec<::android::hardware::hidl_string> tags __attribute__ ((aligned(8)));
+    ::golden::V1_0::Shape::Nested nested __attribute__ ((aligned(8)));
+};
+
+static_assert(offsetof(::golden::V1_0::Shape, name) == 0, "wrong offset");
+static_assert(offsetof(::golden::V1_0::Shape, color) == 16, "wrong offset");
+static_assert(offsetof(::golden::V1_0::Shape, flags) == 20, "wrong offset");
+static_assert(offsetof(::golden::V1_0::Shape, corners) == 24, "wrong offset");
+static_assert(offsetof(::golden::V1_0::Shape, points) == 40, "wrong offset");
+static_assert(offsetof(::golden::V1_0::Shape, data) == 56, "wrong offset");
+static_assert(offsetof(::golden::V1_0::Shape, tags) == 72, "wrong offset");
+static_assert(offsetof(::golden::V1_0::Shape, nested) == 88, "wrong offset");
+static_assert(sizeof(::golden::V1_0::Shape) == 104, "wrong size");
+static_assert(__alignof(::golden::V1_0::Shape) == 8, "wrong alignment");
+
+struct Scene final {
+    ::android::hardware::hidl_vec<::golden::V1_0::Shape> shapes __attribute__ ((aligned(8)));
+    ::android::hardware::hidl_vec<int32_t> ids __attribute__ ((aligned(8)));
+};
+
+static_assert(offsetof(::golden::V1_0::Scene, shapes) == 0, "wrong offset");
+static_assert(offsetof(::golden::V1_0::Scene, ids) == 16, "wrong offset");
+static_assert(sizeof(::golden::V1_0::Scene) == 32, "wrong size");
+static_assert(__alignof(::golden::V1_0::Scene) == 8, "wrong alignment");
+
+struct Samples final {
+    uint32_t rate __attribute__ ((aligned(4)));
+    ::android::hardware::hidl_vec<int16_t> values __attribute__ ((aligned(8)));
+    ::android::hardware::hidl_vec<::golden::V1_0::Color> colors __attribute__ ((aligned(8)));
+    ::android::hardware::hidl_vec<::android::hardware::hidl_string> labels __attribute__ ((aligned(8)));
+};
+
+static_assert(offsetof(::golden::V1_0::Samples, rate) == 0, "wrong offset");
+static_assert(offsetof(::golden::V1_0::Samples, values) == 8, "wrong offset");
+static_assert(offsetof(::golden::V1_0::Samples, colors) == 24, "wrong offset");
+static_assert(offsetof(::golden::V1_0::Samples, labels) == 40, "wrong offset");
+static_assert(sizeof(::golden::V1_0::Samples) == 56, "wrong size");
+static_assert(__alignof(::golden::V1_0::Samples) == 8, "wrong alignment");
+
+typedef ::android::hardware::hidl_vec<::golden::V1_0::Shape> Shapes;
+
+//
+// type declarations for package
+//
+
+template<typename>
+static inline std::string toString(int32_t o);
+static inline std::string toString(::golden::V1_0::Color o);
+
+constexpr int32_t operator|(const ::golden::V1_0::Color lhs, const ::golden::V1_0::Color rhs) {
+    return static_cast<int32_t>(static_cast<int32_t>(lhs) | static_cast<int32_t>(rhs));
+}
+constexpr int32_t operator|(const int32_t lhs, const ::golden::V1_0::Color rhs) {
+    return static_cast<int32_t>(lhs | static_cast<int32_t>(rhs));
+}
+constexpr int32_t operator|(const ::golden::V1_0::Color lhs, const int32_t rhs) {
+    return static_cast<int32_t>(static_cast<int32_t>(lhs) | rhs);
+}
+constexpr int32_t operator&(const ::golden::V1_0::Color lhs, const ::golden::V1_0::Color rhs) {
+    return static_cast<int32_t>(static_cast<int32_t>(lhs) & static_cast<int32_t>(rhs));
+}
+constexpr int32_t operator&(const int32_t lhs, const ::golden::V1_0::Color rhs) {
+    return static_cast<int32_t>(lhs & static_cast<int32_t>(rhs));
+}
+constexpr int32_t operator&(const ::golden::V1_0::Color lhs, const int32_t rhs) {
+    return static_cast<int32_t>(static_cast<int32_t>(lhs) & rhs);
+}
+constexpr int32_t &operator|=(int32_t& v, const ::golden::V1_0::Color e) {
+    v |= static_cast<int32_t>(e);
+    return v;
+}
+constexpr int32_t &operator&=(int32_t& v, const ::golden::V1_0::Color e) {
+    v &= static_cast<int32_t>(e);
+    return v;
+}
+
+template<typename>
+static inline std::string toString(uint8_t o);
+static inline std::string toString(::golden::V1_0::Flag o);
+
+constexpr uint8_t operator|(const ::golden::V1_0::Flag lhs, const ::golden::V1_0::Flag rhs) {
+    return static_cast<uint8_t>(static_cast<uint8_t>(lhs) | static_cast<uint8_t>(rhs));
+}
+constexpr uint8_t operator|(const uint8_t lhs, const ::golden::V1_0::Flag rhs) {
+    return static_cast<uint8_t>(lhs | static_cast<uint8_t>(rhs));
+}
+constexpr uint8_t operator|(const ::golden::V1_0::Flag lhs, const uint8_t rhs) {
+    return static_cast<uint8_t>(static_cast<uint8_t>(lhs) | rhs);
+}
+constexpr uint8_t operator&(const ::golden::V1_0::Flag lhs, const ::golden::V1_0::Flag rhs) {
+    return static_cast<uint8_t>(static_cast<uint8_t>(lhs) & static_cast<uint8_t>(rhs));
+}
+constexpr uint8_t operator&(const uint8_t lhs, const ::golden::V1_0::Flag rhs) {
+    return static_cast<uint8_t>(lhs & static_cast<uint8_t>(rhs));
+}
+constexpr uint8_t operator&(const ::golden::V1_0::Flag lhs, const uint8_t rhs) {
+    return static_cast<uint8_t>(static_cast<uint8_t>(lhs) & rhs);
+}
+constexpr uint8_t &operator|=(uint8_t& v, const ::golden::V1_0::Flag e) {
+    v |= static_cast<uint8_t>(e);
+    return v;
+}
+constexpr uint8_t &operator&=(uint8_t& v, const ::golden::V1_0::Flag e) {
+    v &= static_cast<uint8_t>(e);
+    return v;
+}
+
+template<typename>
+static inline std::string toString(int8_t o);
+static inline std::string toString(::golden::V1_0::Access o);
+
+constexpr int8_t operator|(const ::golden::V1_0::Access lhs, const ::golden::V1_0::Access rhs) {
+    return static_cast<int8_t>(static_cast<int8_t>(lhs) | static_cast<int8_t>(rhs));
+}
+constexpr int8_t operator|(const int8_t lhs, const ::golden::V1_0::Access rhs) {
+    return static_cast<int8_t>(lhs | static_cast<int8_t>(rhs));
+}
+constexpr int8_t operator|(const ::golden::V1_0::Access lhs, const int8_t rhs) {
+    return static_cast<int8_t>(static_cast<int8_t>(lhs) | rhs);
+}
+constexpr int8_t operator&(const ::golden::V1_0::Access lhs, const ::golden::V1_0::Access rhs) {
+    return static_cast<int8_t>(static_cast<int8_t>(lhs) & static_cast<int8_t>(rhs));
+}
+constexpr int8_t operator&(const int8_t lhs, const ::golden::V1_0::Access rhs) {
+    return static_cast<int8_t>(lhs & static_cast<int8_t>(rhs));
+}
+constexpr int8_t operator&(const ::golden::V1_0::Access lhs, const int8_t rhs) {
+    return static_cast<int8_t>(static_cast<int8_t>(lhs) & rhs);
+}
+constexpr int8_t &operator|=(int8_t& v, const ::golden::V1_0::Access e) {
+    v |= static_cast<int8_t>(e);
+    return v;
+}
+constexpr int8_t &operator&=(int8_t& v, const ::golden::V1_0::Access e) {
+    v &= static_cast<int8_t>(e);
+    return v;
+}
+
+static inline void appendToString(std::string& os, const ::golden::V1_0::Point& o);
+static inline std::string toString(const ::golden::V1_0::Point& o);
+static inline bool operator==(const ::golden::V1_0::Point& lhs, const ::golden::V1_0::Point& rhs);
+static inline bool operator!=(const ::golden::V1_0::Point& lhs, const ::golden::V1_0::Point& rhs);
+
+static inline void appendToString(std::string& os, const ::golden::V1_0::Shape::Nested& o);
+static inline std::string toString(const ::golden::V1_0::Shape::Nested& o);
+static inline bool operator==(const ::golden::V1_0::Shape::Nested& lhs, const ::golden::V1_0::Shape::Nested& rhs);
+static inline bool operator!=(const ::golden::V1_0::Shape::Nested& lhs, const ::golden::V1_0::Shape::Nested& rhs);
+
+static inline void appendToString(std::string& os, const ::golden::V1_0::Shape& o);
+static inline std::string toString(const ::golden::V1_0::Shape& o);
+static inline bool operator==(const ::golden::V1_0::Shape& lhs, const ::golden::V1_0::Shape& rhs);
+static inline bool operator!=(const ::golden::V1_0::Shape& lhs, const ::golden::V1_0::Shape& rhs);
+
+static inline void appendToString(std::string& os, const ::golden::V1_0::Scene& o);
+static inline std::string toString(const ::golden::V1_0::Scene& o);
+static inline bool operator==(const ::golden::V1_0::Scene& lhs, const ::golden::V1_0::Scene& rhs);
+static inline bool operator!=(const ::golden::V1_0::Scene& lhs, const ::golden::V1_0::Scene& rhs);
+
+static inline void appendToString(std::string& os, const ::golden::V1_0::Samples& o);
+static inline std::string toString(const ::golden::V1_0::Samples& o);
+static inline bool operator==(const ::golden::V1_0::Samples& lhs, const ::golden::V1_0::Samples& rhs);
+static inline bool operator!=(const ::golden::V1_0::Samples& lhs, const ::golden::V1_0::Samples& rhs);
+
+//
+// type header definitions for package
+//
+
+template<>
+inline std::string toString<::golden::V1_0::Color>(int32_t o) {
+    using ::android::hardware::details::toHexString;
+    static constexpr struct {
+        int32_t value;
+        const char* name;
+    } kValues[] = {
+        {static_cast<int32_t>(::golden::V1_0::Color::RED), "RED"},
+        {static_cast<int32_t>(::golden::V1_0::Color::GREEN), "GREEN"},
+        {static_cast<int32_t>(::golden::V1_0::Color::BLUE), "BLUE"},
+        {static_cast<int32_t>(::golden::V1_0::Color::CRIMSON), "CRIMSON"},
+    };
+    std::string os;
+    ::android::hardware::hidl_bitfield<::golden::V1_0::Color> flipped = 0;
+    for (const auto& value : kValues) {
+        if ((o & value.value) == value.value) {
+            os += (os.empty() ? "" : " | ");
+            os += value.name;
+            flipped |= value.value;
+        }
+    }
+    if (o != flipped) {
+        os += (os.empty() ? "" : " | ");
+        os += toHexString(o & (~flipped));
+    }
+    os += " (";
+    os += toHexString(o);
+    os += ")";
+    return os;
+}
+
+static inline std::string toString(::golden::V1_0::Color o) {
+    using ::android::hardware::details::toHexString;
+    switch (o) {
+        case ::golden::V1_0::Color::RED:
+            return "RED";
+        case ::golden::V1_0::Color::GREEN:
+            return "GREEN";
+        case ::golden::V1_0::Color::BLUE:
+            return "BLUE";
+        default:
+            break;
+    }
+    std::string os;
+    os += toHexString(static_cast<int32_t>(o));
+    return os;
+}
+
+template<>
+inline std::string toString<::golden::V1_0::Flag>(uint8_t o) {
+    using ::android::hardware::details::toHexString;
+    static constexpr struct {
+        uint8_t value;
+        const char* name;
+    } kValues[] = {
+        {static_cast<uint8_t>(::golden::V1_0::Flag::NONE), "NONE"},
+        {static_cast<uint8_t>(::golden::V1_0::Flag::A), "A"},
+        {static_cast<uint8_t>(::golden::V1_0::Flag::B), "B"},
+        {static_cast<uint8_t>(::golden::V1_0::Flag::AB), "AB"},
+    };
+    std::string os;
+    ::android::hardware::hidl_bitfield<::golden::V1_0::Flag> flipped = 0;
+    for (const auto& value : kValues) {
+        if ((o & value.value) == value.value) {
+            os += (os.empty() ? "" : " | ");
+            os += value.name;
+            flipped |= value.value;
+        }
+    }
+    if (o != flipped) {
+        os += (os.empty() ? "" : " | ");
+        os += toHexString(o & (~flipped));
+    }
+    os += " (";
+    os += toHexString(o);
+    os += ")";
+    return os;
+}
+
+static inline std::string toString(::golden::V1_0::Flag o) {
+    using ::android::hardware::details::toHexString;
+    switch (o) {
+        case ::golden::V1_0::Flag::NONE:
+            return "NONE";
+        case ::golden::V1_0::Flag::A:
+            return "A";
+        case ::golden::V1_0::Flag::B:
+            return "B";
+        case ::golden::V1_0::Flag::AB:
+            return "AB";
+        default:
+            break;
+    }
+    std::string os;
+    os += toHexString(static_cast<uint8_t>(o));
+    return os;
+}
+
+template<>
+inline std::string toString<::golden::V1_0::Access>(int8_t o) {
+    using ::android::hardware::details::toHexString;
+    static constexpr const char* kBitNames[] = {
+        "READ",
+        "WRITE",
+        nullptr,
+        "EXECUTE",
+        nullptr,
+        nullptr,
+        nullptr,
+        "SETUID",
+    };
+    std::string os = "NO_ACCESS";
+    const int8_t flipped = o & static_cast<int8_t>(0x8bull);
+    for (uint64_t bits = static_cast<uint64_t>(o) & 0x8bull; bits != 0; bits &= bits - 1) {
+        os += (os.empty() ? "" : " | ");
+        os += kBitNames[__builtin_ctzll(bits)];
+    }
+    if (o != flipped) {
+        os += (os.empty() ? "" : " | ");
+        os += toHexString(o & (~flipped));
+    }
+    os += " (";
+    os += toHexString(o);
+    os += ")";
+    return os;
+}
+
+static inline std::string toString(::golden::V1_0::Access o) {
+    using ::android::hardware::details::toHexString;
+    switch (o) {
+        case ::golden::V1_0::Access::NO_ACCESS:
+            return "NO_ACCESS";
+        case ::golden::V1_0::Access::READ:
+            return "READ";
+        case ::golden::V1_0::Access::WRITE:
+            return "WRITE";
+        case ::golden::V1_0::Access::EXECUTE:
+            return "EXECUTE";
+        case ::golden::V1_0::Access::SETUID:
+            return "SETUID";
+        default:
+            break;
+    }
+    std::string os;
+    os += toHexString(static_cast<int8_t>(o));
+    return os;
+}
+
+static inline void appendToString(std::string& os, const ::golden::V1_0::Point& o) {
+    using ::android::hardware::toString;
+    os += "{";
+    os += ".x = ";
+    os += ::android::hardware::toString(o.x);
+    os += ", .y = ";
+    os += ::android::hardware::toString(o.y);
+    os += "}";
+}
+
+static inline std::string toString(const ::golden::V1_0::Point& o) {
+    std::string os;
+    appendToString(os, o);
+    return os;
+}
+
+static inline bool operator==(const ::golden::V1_0::Point& lhs, const ::golden::V1_0::Point& rhs) {
+    static_assert(sizeof(::golden::V1_0::Point) == 8, "unexpected padding");
+    return memcmp(&lhs, &rhs, sizeof(lhs)) == 0;
+}
+
+static inline bool operator!=(const ::golden::V1_0::Point& lhs, const ::golden::V1_0::Point& rhs){
+    return !(lhs == rhs);
+}
+
+static inline void appendToString(std::string& os, const ::golden::V1_0::Shape::Nested& o) {
+    using ::android::hardware::toString;
+    os += "{";
+    os += ".a = ";
+    os += ::android::hardware::toString(o.a);
+    os += ", .b = ";
+    os += ::android::hardware::toString(o.b);
+    os += "}";
+}
+
+static inline std::string toString(const ::golden::V1_0::Shape::Nested& o) {
+    std::string os;
+    appendToString(os, o);
+    return os;
+}
+
+static inline bool operator==(const ::golden::V1_0::Shape::Nested& lhs, const ::golden::V1_0::Shape::Nested& rhs) {
+    if (lhs.a != rhs.a) {
+        return false;
+    }
+    if (lhs.b != rhs.b) {
+        return false;
+    }
+    return true;
+}
+
+static inline bool operator!=(const ::golden::V1_0::Shape::Nested& lhs, const ::golden::V1_0::Shape::Nested& rhs){
+    return !(lhs == rhs);
+}
+
+static inline void appendToString(std::string& os, const ::golden::V1_0::Shape& o) {
+    using ::android::hardware::toString;
+    os += "{";
+    os += ".name = ";
+    os += ::android::hardware::toString(o.name);
+    os += ", .color = ";
+    os += ::golden::V1_0::toString(o.color);
+    os += ", .flags = ";
+    os += ::golden::V1_0::toString<::golden::V1_0::Flag>(o.flags);
+    os += ", .corners = ";
+    os += "[2]";
+    os += "{";
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < 2; ++_hidl_index_0) {
+        if (_hidl_index_0 > 0) {
+            os += ", ";
+        }
+        ::golden::V1_0::appendToString(os, o.corners[_hidl_index_0]);
+    }
+    os += "}";
+    os += ", .points = ";
+    os += "[";
+    os += std::to_string(o.points.size());
+    os += "]{";
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < o.points.size(); ++_hidl_index_0) {
+        if (_hidl_index_0 > 0) {
+            os += ", ";
+        }
+        ::golden::V1_0::appendToString(os, o.points[_hidl_index_0]);
+    }
+    os += "}";
+    os += ", .data = ";
+    os += ::android::hardware::toString(o.data);
+    os += ", .tags = ";
+    os += ::android::hardware::toString(o.tags);
+    os += ", .nested = ";
+    ::golden::V1_0::appendToString(os, o.nested);
+    os += "}";
+}
+
+static inline std::string toString(const ::golden::V1_0::Shape& o) {
+    std::string os;
+    appendToString(os, o);
+    return os;
+}
+
+static inline bool operator==(const ::golden::V1_0::Shape& lhs, const ::golden::V1_0::Shape& rhs) {
+    if (lhs.name != rhs.name) {
+        return false;
+    }
+    if (lhs.color != rhs.color) {
+        return false;
+    }
+    if (lhs.flags != rhs.flags) {
+        return false;
+    }
+    if (lhs.corners != rhs.corners) {
+        return false;
+    }
+    if (lhs.points != rhs.points) {
+        return false;
+    }
+    if (lhs.data != rhs.data) {
+        return false;
+    }
+    if (lhs.tags != rhs.tags) {
+        return false;
+    }
+    if (lhs.nested != rhs.nested) {
+        return false;
+    }
+    return true;
+}
+
+static inline bool operator!=(const ::golden::V1_0::Shape& lhs, const ::golden::V1_0::Shape& rhs){
+    return !(lhs == rhs);
+}
+
+static inline void appendToString(std::string& os, const ::golden::V1_0::Scene& o) {
+    using ::android::hardware::toString;
+    os += "{";
+    os += ".shapes = ";
+    os += "[";
+    os += std::to_string(o.shapes.size());
+    os += "]{";
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < o.shapes.size(); ++_hidl_index_0) {
+        if (_hidl_index_0 > 0) {
+            os += ", ";
+        }
+        ::golden::V1_0::appendToString(os, o.shapes[_hidl_index_0]);
+    }
+    os += "}";
+    os += ", .ids = ";
+    os += ::android::hardware::toString(o.ids);
+    os += "}";
+}
+
+static inline std::string toString(const ::golden::V1_0::Scene& o) {
+    std::string os;
+    appendToString(os, o);
+    return os;
+}
+
+static inline bool operator==(const ::golden::V1_0::Scene& lhs, const ::golden::V1_0::Scene& rhs) {
+    if (lhs.shapes != rhs.shapes) {
+        return false;
+    }
+    if (lhs.ids != rhs.ids) {
+        return false;
+    }
+    return true;
+}
+
+static inline bool operator!=(const ::golden::V1_0::Scene& lhs, const ::golden::V1_0::Scene& rhs){
+    return !(lhs == rhs);
+}
+
+static inline void appendToString(std::string& os, const ::golden::V1_0::Samples& o) {
+    using ::android::hardware::toString;
+    os += "{";
+    os += ".rate = ";
+    os += ::android::hardware::toString(o.rate);
+    os += ", .values = ";
+    os += ::android::hardware::toString(o.values);
+    os += ", .colors = ";
+    os += ::android::hardware::toString(o.colors);
+    os += ", .labels = ";
+    os += ::android::hardware::toString(o.labels);
+    os += "}";
+}
+
+static inline std::string toString(const ::golden::V1_0::Samples& o) {
+    std::string os;
+    appendToString(os, o);
+    return os;
+}
+
+static inline bool operator==(const ::golden::V1_0::Samples& lhs, const ::golden::V1_0::Samples& rhs) {
+    if (lhs.rate != rhs.rate) {
+        return false;
+    }
+    if (lhs.values != rhs.values) {
+        return false;
+    }
+    if (lhs.colors != rhs.colors) {
+        return false;
+    }
+    if (lhs.labels != rhs.labels) {
+        return false;
+    }
+    return true;
+}
+
+static inline bool operator!=(const ::golden::V1_0::Samples& lhs, const ::golden::V1_0::Samples& rhs){
+    return !(lhs == rhs);
+}
+
+
+}  // namespace V1_0
+}  // namespace golden
+
+//
+// global type declarations for package
+//
+
+#ifndef HIDL_GENERATED_HASH_SUPPORT
+#define HIDL_GENERATED_HASH_SUPPORT
+
+namespace android {
+namespace hardware {
+namespace details {
+
+inline size_t hidl_hash_combine(size_t seed, size_t value) {
+    return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+inline size_t hidl_hash_bytes(const void* data, size_t size) {
+    static constexpr uint64_t kMul = 0x9ddfea08eb382d69ull;
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    uint64_t hash = 0xcbf29ce484222325ull ^ size;
+    uint64_t word;
+    for (; size >= sizeof(word); bytes += sizeof(word), size -= sizeof(word)) {
+        memcpy(&word, bytes, sizeof(word));
+        hash = (hash ^ word) * kMul;
+        hash ^= hash >> 47;
+    }
+    if (size > 0) {
+        word = 0;
+        memcpy(&word, bytes, size);
+        hash = (hash ^ word) * kMul;
+        hash ^= hash >> 47;
+    }
+    return static_cast<size_t>(hash);
+}
+
+}  // namespace details
+}  // namespace hardware
+}  // namespace android
+
+#endif  // HIDL_GENERATED_HASH_SUPPORT
+
+namespace android {
+namespace hardware {
+namespace details {
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wc++17-extensions"
+template<> inline constexpr std::array<::golden::V1_0::Color, 4> hidl_enum_values<::golden::V1_0::Color> = {
+    ::golden::V1_0::Color::RED,
+    ::golden::V1_0::Color::GREEN,
+    ::golden::V1_0::Color::BLUE,
+    ::golden::V1_0::Color::CRIMSON,
+};
+#pragma clang diagnostic pop
+}  // namespace details
+}  // namespace hardware
+}  // namespace android
+
+namespace android {
+namespace hardware {
+namespace details {
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wc++17-extensions"
+template<> inline constexpr std::array<::golden::V1_0::Flag, 4> hidl_enum_values<::golden::V1_0::Flag> = {
+    ::golden::V1_0::Flag::NONE,
+    ::golden::V1_0::Flag::A,
+    ::golden::V1_0::Flag::B,
+    ::golden::V1_0::Flag::AB,
+};
+#pragma clang diagnostic pop
+}  // namespace details
+}  // namespace hardware
+}  // namespace android
+
+namespace android {
+namespace hardware {
+namespace details {
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wc++17-extensions"
+template<> inline constexpr std::array<::golden::V1_0::Access, 5> hidl_enum_values<::golden::V1_0::Access> = {
+    ::golden::V1_0::Access::NO_ACCESS,
+    ::golden::V1_0::Access::READ,
+    ::golden::V1_0::Access::WRITE,
+    ::golden::V1_0::Access::EXECUTE,
+    ::golden::V1_0::Access::SETUID,
+};
+#pragma clang diagnostic pop
+}  // namespace details
+}  // namespace hardware
+}  // namespace android
+
+namespace std {
+template<>
+struct hash<::golden::V1_0::Point> {
+    size_t operator()(const ::golden::V1_0::Point& o) const;
+};
+}  // namespace std
+
+namespace std {
+template<>
+struct hash<::golden::V1_0::Shape::Nested> {
+    size_t operator()(const ::golden::V1_0::Shape::Nested& o) const;
+};
+}  // namespace std
+
+namespace std {
+template<>
+struct hash<::golden::V1_0::Shape> {
+    size_t operator()(const ::golden::V1_0::Shape& o) const;
+};
+}  // namespace std
+
+namespace std {
+template<>
+struct hash<::golden::V1_0::Scene> {
+    size_t operator()(const ::golden::V1_0::Scene& o) const;
+};
+}  // namespace std
+
+namespace std {
+template<>
+struct hash<::golden::V1_0::Samples> {
+    size_t operator()(const ::golden::V1_0::Samples& o) const;
+};
+}  // namespace std
+
+//
+// global type header definitions for package
+//
+
+inline size_t std::hash<::golden::V1_0::Point>::operator()(const ::golden::V1_0::Point& o) const {
+    return ::android::hardware::details::hidl_hash_bytes(&o, sizeof(o));
+}
+
+inline size_t std::hash<::golden::V1_0::Shape::Nested>::operator()(const ::golden::V1_0::Shape::Nested& o) const {
+    size_t _hidl_hash = 0;
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::std::hash<uint8_t>{}(o.a));
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::std::hash<int64_t>{}(o.b));
+    return _hidl_hash;
+}
+
+inline size_t std::hash<::golden::V1_0::Shape>::operator()(const ::golden::V1_0::Shape& o) const {
+    size_t _hidl_hash = 0;
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::android::hardware::details::hidl_hash_bytes(o.name.c_str(), o.name.size()));
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::std::hash<::golden::V1_0::Color>{}(o.color));
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::std::hash<::android::hardware::hidl_bitfield<::golden::V1_0::Flag>>{}(o.flags));
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::android::hardware::details::hidl_hash_bytes(&o.corners, sizeof(o.corners)));
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::android::hardware::details::hidl_hash_bytes(o.points.data(), o.points.size() * sizeof(::golden::V1_0::Point)));
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::android::hardware::details::hidl_hash_bytes(o.data.data(), o.data.size() * sizeof(uint8_t)));
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, o.tags.size());
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < o.tags.size(); ++_hidl_index_0) {
+        _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::android::hardware::details::hidl_hash_bytes(o.tags[_hidl_index_0].c_str(), o.tags[_hidl_index_0].size()));
+    }
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::std::hash<::golden::V1_0::Shape::Nested>{}(o.nested));
+    return _hidl_hash;
+}
+
+inline size_t std::hash<::golden::V1_0::Scene>::operator()(const ::golden::V1_0::Scene& o) const {
+    size_t _hidl_hash = 0;
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, o.shapes.size());
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < o.shapes.size(); ++_hidl_index_0) {
+        _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::std::hash<::golden::V1_0::Shape>{}(o.shapes[_hidl_index_0]));
+    }
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::android::hardware::details::hidl_hash_bytes(o.ids.data(), o.ids.size() * sizeof(int32_t)));
+    return _hidl_hash;
+}
+
+inline size_t std::hash<::golden::V1_0::Samples>::operator()(const ::golden::V1_0::Samples& o) const {
+    size_t _hidl_hash = 0;
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::std::hash<uint32_t>{}(o.rate));
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::android::hardware::details::hidl_hash_bytes(o.values.data(), o.values.size() * sizeof(int16_t)));
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::android::hardware::details::hidl_hash_bytes(o.colors.data(), o.colors.size() * sizeof(::golden::V1_0::Color)));
+    _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, o.labels.size());
+    for (size_t _hidl_index_0 = 0; _hidl_index_0 < o.labels.size(); ++_hidl_index_0) {
+        _hidl_hash = ::android::hardware::details::hidl_hash_combine(_hidl_hash, ::android::hardware::details::hidl_hash_bytes(o.labels[_hidl_index_0].c_str(), o.labels[_hidl_index_0].size()));
+    }
+    return _hidl_hash;
+}
+
+
+#endif  // HIDL_GENERATED_GOLDEN_V1_0_TYPES_H
@@ -0,0 +1,417 @@
+/*
+ * Copyright (C) 2019 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Runs the error_test cases and checks generated sources against goldens
+// in-process, with an isolated Coordinator per case and all cases running in
+// parallel.
+//
+// Like hidl_error_test.sh, this expects to run from $ANDROID_BUILD_TOP (or
+// with it set). To update the goldens after an intended generator change:
+//     HIDL_GEN_UPDATE_GOLDENS=1 hidl-gen-golden_test
+
+#include <gtest/gtest.h>
+
+#include <AST.h>
+#include <Coordinator.h>
+#include <NamedType.h>
+#include <Scope.h>
+#include <android-base/logging.h>
+#include <dirent.h>
+#include <hidl-util/FQName.h>
+#include <hidl-util/Formatter.h>
+#include <hidl-util/StringHelper.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace android {
+
+static const std::string kTestPath = "system/tools/hidl/test/";
+static const std::string kErrorTestPath = kTestPath + "error_test";
+static const std::string kGoldenTestPath = kTestPath + "golden_test";
+
+// the buffer std::cerr output of the current thread goes to, if any
+static thread_local std::string* tCapturedErrors = nullptr;
+
+// std::cerr is shared by all threads, so cases running in parallel can't
+// simply swap its buffer. Instead, it is pointed at this buffer once, which
+// hands each thread's output to that thread's capture.
+struct ErrorRouter : public std::streambuf {
+    explicit ErrorRouter(std::streambuf* original) : mOriginal(original) {}
+
+   protected:
+    int overflow(int c) override {
+        if (traits_type::eq_int_type(c, traits_type::eof())) return traits_type::not_eof(c);
+        const char ch = traits_type::to_char_type(c);
+        return xsputn(&ch, 1) == 1 ? c : traits_type::eof();
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+        if (tCapturedErrors != nullptr) {
+            tCapturedErrors->append(s, n);
+            return n;
+        }
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mOriginal->sputn(s, n);
+    }
+
+    int sync() override {
+        if (tCapturedErrors != nullptr) return 0;
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mOriginal->pubsync();
+    }
+
+   private:
+    std::streambuf* const mOriginal;
+    std::mutex mMutex;
+};
+
+struct ScopedErrorCapture {
+    explicit ScopedErrorCapture(std::string* errors) { tCapturedErrors = errors; }
+    ~ScopedErrorCapture() { tCapturedErrors = nullptr; }
+};
+
+static std::string getRootPath() {
+    const char* ANDROID_BUILD_TOP = getenv("ANDROID_BUILD_TOP");
+    return ANDROID_BUILD_TOP != nullptr ? ANDROID_BUILD_TOP : ".";
+}
+
+static std::vector<std::string> listDirectories(const std::string& path) {
+    std::vector<std::string> ret;
+
+    DIR* dir = opendir(path.c_str());
+    if (dir == nullptr) return ret;
+
+    struct dirent* ent;
+    while ((ent = readdir(dir)) != nullptr) {
+        if (ent->d_type == DT_DIR && ent->d_name[0] != '.') {
+            ret.push_back(ent->d_name);
+        }
+    }
+    closedir(dir);
+
+    std::sort(ret.begin(), ret.end());
+    return ret;
+}
+
+static bool readFile(const std::string& path, std::string* contents) {
+    std::ifstream stream(path);
+    if (!stream) return false;
+
+    std::stringstream buffer;
+    buffer << stream.rdbuf();
+    *contents = buffer.str();
+    return true;
+}
+
+static void runOnThreadPool(size_t numTasks, const std::function<void(size_t)>& task) {
+    std::atomic<size_t> next{0};
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < std::max(4u, std::thread::hardware_concurrency()); i++) {
+        threads.emplace_back([&] {
+            for (size_t j = next++; j < numTasks; j = next++) task(j);
+        });
+    }
+    for (std::thread& thread : threads) thread.join();
+}
+
+static std::string generateToString(const std::function<void(Formatter&)>& generate) {
+    char* buffer = nullptr;
+    size_t size = 0;
+    {
+        FILE* file = open_memstream(&buffer, &size);
+        CHECK(file != nullptr);
+        Formatter out(file);
+        generate(out);
+    }  // closes file
+
+    std::string ret(buffer, size);
+    free(buffer);
+    return ret;
+}
+
+class HidlGenGoldenTest : public ::testing::Test {};
+
+struct ErrorTestResult {
+    std::string requiredError;
+    std::string output;
+    bool failed = false;
+};
+
+// Same as "hidl-gen -L check -r test:<error_test> test.<name>@1.0".
+static ErrorTestResult runErrorTest(const std::string& rootPath, const std::string& name) {
+    ErrorTestResult result;
+
+    readFile(rootPath + "/" + kErrorTestPath + "/" + name + "/1.0/required_error",
+             &result.requiredError);
+    result.requiredError = StringHelper::RTrimAll(result.requiredError, "\n");
+
+    Coordinator coordinator;
+    coordinator.setRootPath(rootPath);
+
+    std::string error;
+    CHECK(coordinator.addPackagePath("test", kErrorTestPath, &error) == OK) << error;
+    coordinator.addDefaultPackagePath("android.hidl", "system/libhidl/transport");
+
+    ScopedErrorCapture capture(&result.output);
+
+    std::vector<FQName> targets;
+    if (coordinator.appendPackageInterfacesToVector(FQName("test." + name, "1.0"), &targets) !=
+        OK) {
+        result.failed = true;
+        return result;
+    }
+
+    for (const FQName& fqName : targets) {
+        if (coordinator.parse(fqName) == nullptr) {
+            std::cerr << "ERROR: Could not parse " << fqName.string() << ". Aborting."
+                      << std::endl;
+            result.failed = true;
+            break;
+        }
+    }
+
+    return result;
+}
+
+TEST_F(HidlGenGoldenTest, ErrorTest) {
+    const std::string rootPath = getRootPath();
+    const std::vector<std::string> names = listDirectories(rootPath + "/" + kErrorTestPath);
+    ASSERT_FALSE(names.empty()) << "cannot find test directory: " << kErrorTestPath;
+
+    std::vector<ErrorTestResult> results(names.size());
+    runOnThreadPool(names.size(), [&](size_t i) { results[i] = runErrorTest(rootPath, names[i]); });
+
+    for (size_t i = 0; i < names.size(); i++) {
+        const ErrorTestResult& result = results[i];
+        SCOPED_TRACE(names[i]);
+
+        ASSERT_FALSE(result.requiredError.empty()) << "No required error message specified.";
+        EXPECT_TRUE(result.failed) << "Test did not fail.";
+        EXPECT_NE(std::string::npos, result.output.find(result.requiredError))
+            << "Error output does not contain '" << result.requiredError << "':\n"
+            << result.output;
+    }
+}
+
+struct GoldenFile {
+    std::string name;  // relative to golden/
+    FQName fqName;     // the .hal file the output is generated from
+    std::function<void(const AST*, Formatter&)> generate;
+    // hidl-gen options, e.x. -S, the output is generated with
+    std::function<void(Coordinator*)> setOptions = [](Coordinator*) {};
+};
+
+// Points the package roots at test/golden_test. android.hidl.base comes from
+// a trimmed copy there, so that interface goldens don't change with IBase's
+// doc comments.
+static void addGoldenPackagePaths(Coordinator* coordinator) {
+    std::string error;
+    CHECK(coordinator->addPackagePath("golden", kGoldenTestPath, &error) == OK) << error;
+    CHECK(coordinator->addPackagePath("android.hidl", kGoldenTestPath + "/hidl", &error) == OK)
+        << error;
+}
+
+// The C++ output for an interface, named as with -Lc++-headers and
+// -Lc++-sources, in golden/<dir>/.
+static std::vector<GoldenFile> getInterfaceCppFiles(
+    const std::string& dir, const FQName& fqName,
+    const std::function<void(Coordinator*)>& setOptions) {
+    const std::string prefix = dir + "/";
+    return {
+        {prefix + fqName.name() + ".h", fqName, &AST::generateInterfaceHeader, setOptions},
+        {prefix + fqName.getInterfaceBaseName() + "All.cpp", fqName, &AST::generateCppSource,
+         setOptions},
+    };
+}
+
+static std::vector<GoldenFile> getGoldenFiles(const std::string& rootPath) {
+    const FQName types("golden", "1.0", "types");
+    std::vector<GoldenFile> files = {
+        {"types.h", types, &AST::generateInterfaceHeader},
+        {"hwtypes.h", types, &AST::generateHwBinderHeader},
+        {"types.cpp", types, &AST::generateCppSource},
+        {"types.vts", types, &AST::generateVts},
+    };
+
+    // One Java file per top-level type, as with -Ljava.
+    Coordinator coordinator;
+    coordinator.setRootPath(rootPath);
+    addGoldenPackagePaths(&coordinator);
+
+    AST* ast = coordinator.parse(types);
+    CHECK(ast != nullptr);
+    for (const NamedType* type : ast->getRootScope()->getSubTypes()) {
+        if (type->isTypeDef()) continue;
+
+        const std::string name = type->localName();
+        files.push_back({name + ".java", types, [name](const AST* ast, Formatter& out) {
+                             ast->generateJava(out, name);
+                         }});
+    }
+
+    // -T, which moves the type definitions from types.h into types.cpp.
+    const auto setOutOfLine = [](Coordinator* coordinator) {
+        coordinator->setOutOfLineTypeDefinitions(true);
+    };
+    files.push_back({"outofline/types.h", types, &AST::generateInterfaceHeader, setOutOfLine});
+    files.push_back({"outofline/types.cpp", types, &AST::generateCppSource, setOutOfLine});
+
+    // @packed arguments, with their C++ layout and Java offsets.
+    const FQName packed("golden.packed", "1.0", "IPacked");
+    for (GoldenFile& file : getInterfaceCppFiles("packed", packed, [](Coordinator*) {})) {
+        files.push_back(std::move(file));
+    }
+    files.push_back({"packed/IPacked.java", packed, [](const AST* ast, Formatter& out) {
+                         ast->generateJava(out, "" /* limitToType */);
+                     }});
+
+    // -S, for structs with embedded strings and vectors.
+    const FQName shapes("golden.size", "1.0", "IShapes");
+    for (GoldenFile& file : getInterfaceCppFiles("size", shapes, [](Coordinator* coordinator) {
+             coordinator->setOptimizeSize(true);
+         })) {
+        files.push_back(std::move(file));
+    }
+
+    // -H, for an interface with inherited methods.
+    const FQName child("golden.latency", "1.0", "IChild");
+    const auto setLatency = [](Coordinator* coordinator) {
+        coordinator->setEmitLatencyHistograms(true);
+    };
+    for (GoldenFile& file : getInterfaceCppFiles("latency", child, setLatency)) {
+        files.push_back(std::move(file));
+    }
+    files.push_back({"latency/BsChild.h", child, &AST::generatePassthroughHeader, setLatency});
+
+    // -Lbenchmark, for vectors, strings, a safe_union and a oneway method.
+    // Its -Landroidbp-benchmark stanza is checked by Android.bp.
+    const FQName bench("golden.bench", "1.0", "IBench");
+    files.push_back({"bench/IBenchBenchmark.cpp", bench, &AST::generateCppBenchmarkSource});
+
+    // -F, with an import of each kind, see ForwardDeclaredImportsTest.
+    const FQName foo("golden.fwd", "1.0", "IFoo");
+    const auto setForward = [](Coordinator* coordinator) {
+        coordinator->setForwardDeclareInterfaces(true);
+    };
+    files.push_back({"fwd/IFoo.h", foo, &AST::generateInterfaceHeader, setForward});
+    files.push_back({"fwd/IFooFwd.h", foo, &AST::generateInterfaceForwardHeader, setForward});
+    files.push_back({"fwd/BsFoo.h", foo, &AST::generatePassthroughHeader, setForward});
+    files.push_back({"fwd/Foo.h", foo, &AST::generateCppImplHeader, setForward});
+
+    return files;
+}
+
+TEST_F(HidlGenGoldenTest, GoldenTest) {
+    const std::string rootPath = getRootPath();
+    const std::string goldenPath = rootPath + "/" + kGoldenTestPath + "/golden/";
+    const bool update = getenv("HIDL_GEN_UPDATE_GOLDENS") != nullptr;
+
+    const std::vector<GoldenFile> files = getGoldenFiles(rootPath);
+
+    std::vector<std::string> outputs(files.size());
+    std::vector<std::string> errors(files.size());
+    runOnThreadPool(files.size(), [&](size_t i) {
+        ScopedErrorCapture capture(&errors[i]);
+
+        Coordinator coordinator;
+        coordinator.setRootPath(rootPath);
+        addGoldenPackagePaths(&coordinator);
+        files[i].setOptions(&coordinator);
+
+        const AST* ast = coordinator.parse(files[i].fqName);
+        if (ast == nullptr) return;
+
+        outputs[i] = generateToString([&](Formatter& out) { files[i].generate(ast, out); });
+    });
+
+    for (size_t i = 0; i < files.size(); i++) {
+        const std::string path = goldenPath + files[i].name;
+        SCOPED_TRACE(path);
+
+        EXPECT_EQ("", errors[i]);
+
+        if (update) {
+            std::ofstream stream(path);
+            EXPECT_TRUE(stream << outputs[i]) << "Cannot write golden file.";
+            continue;
+        }
+
+        std::string golden;
+        ASSERT_TRUE(readFile(path, &golden)) << "Missing golden file.";
+        if (golden == outputs[i]) continue;
+
+        std::vector<std::string> goldenLines, outputLines;
+        StringHelper::SplitString(golden, '\n', &goldenLines);
+        StringHelper::SplitString(outputs[i], '\n', &outputLines);
+        size_t line = 0;
+        while (line < goldenLines.size() && line < outputLines.size() &&
+               goldenLines[line] == outputLines[line]) {
+            line++;
+        }
+        ADD_FAILURE() << "Generated output differs from golden at line " << line + 1 << ":\n"
+                      << "golden:    "
+                      << (line < goldenLines.size() ? goldenLines[line] : "<end of file>") << "\n"
+                      << "generated: "
+                      << (line < outputLines.size() ? outputLines[line] : "<end of file>");
+    }
+}
+
+TEST_F(HidlGenGoldenTest, ForwardDeclaredImportsTest) {
+    Coordinator coordinator;
+    coordinator.setRootPath(getRootPath());
+    addGoldenPackagePaths(&coordinator);
+    coordinator.setForwardDeclareInterfaces(true);
+
+    const AST* ast = coordinator.parse(FQName("golden.fwd", "1.0", "IFoo"));
+    ASSERT_NE(nullptr, ast);
+
+    std::set<FQName> forwardDeclaredNames;
+    ast->getForwardDeclaredNames(&forwardDeclaredNames);
+
+    // IParent is the super type, IEntry is used in a vec, IConfig through its
+    // nested type and INode by IFoo's nested type, so they stay complete.
+    EXPECT_EQ((std::set<FQName>{FQName("golden.fwd", "1.0", "IListener"),
+                                FQName("golden.fwd", "1.0", "ISource")}),
+              forwardDeclaredNames);
+}
+
+}  // namespace android
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+
+    std::streambuf* original = std::cerr.rdbuf();
+    android::ErrorRouter router(original);
+    std::cerr.rdbuf(&router);
+
+    int ret = RUN_ALL_TESTS();
+
+    std::cerr.rdbuf(original);
+    return ret;
+}
@@ -18,10 +18,17 @@
 
 #include <gtest/gtest.h>
 
+#include <AST.h>
 #include <ConstantExpression.h>
 #include <Coordinator.h>
+#include <EnumType.h>
+#include <Interface.h>
 #include <hidl-util/FQName.h>
 
+#include <atomic>
+#include <set>
+#include <thread>
+
 #define EXPECT_EQ_OK(expectResult, call, ...)        \
     do {                                             \
         std::string result;                          \
@@ -94,6 +101,69 @@ TEST_F(HidlGenHostTest, CoordinatorFilepathTest) {
     EXPECT_EQ_OK("foo/a/b/c/V1_2/", coordinator.getFilepath, kName, Location::GEN_SANITIZED, "");
 }
 
+TEST_F(HidlGenHostTest, CoordinatorFQNameForPathTest) {
+    Coordinator coordinator;
+    coordinator.setRootPath("/root/");
+
+    std::string error;
+    EXPECT_EQ(OK, coordinator.addPackagePath("a.b", "a1/b1", &error));
+    EXPECT_TRUE(error.empty());
+
+    FQName fqName;
+    EXPECT_EQ(OK, coordinator.getFQNameForPath("/root/a1/b1/c/d/1.2/IFoo.hal", &fqName));
+    EXPECT_EQ("a.b.c.d@1.2::IFoo", fqName.string());
+    EXPECT_EQ(OK, coordinator.getFQNameForPath("/root/a1/b1/c/1.2/types.hal", &fqName));
+    EXPECT_EQ("a.b.c@1.2::types", fqName.string());
+
+    EXPECT_NE(OK, coordinator.getFQNameForPath("/root/a1/b1/c/1.2/IFoo.h", &fqName));
+    EXPECT_NE(OK, coordinator.getFQNameForPath("/root/a2/b1/c/1.2/IFoo.hal", &fqName));
+    EXPECT_NE(OK, coordinator.getFQNameForPath("/root/a1/b1/c/foo/IFoo.hal", &fqName));
+}
+
+TEST_F(HidlGenHostTest, CoordinatorInvalidateTest) {
+    Coordinator coordinator;
+    coordinator.setRootPath("/root/");
+
+    std::string error;
+    EXPECT_EQ(OK, coordinator.addPackagePath("a.b", "a1/b1", &error));
+
+    coordinator.setFileContents("/root/a1/b1/x/1.0/types.hal",
+                                "package a.b.x@1.0;\nstruct X { int32_t v; };\n");
+    coordinator.setFileContents("/root/a1/b1/y/1.0/types.hal",
+                                "package a.b.y@1.0;\nimport a.b.x@1.0::X;\n"
+                                "struct Y { X x; };\n");
+    coordinator.setFileContents("/root/a1/b1/z/1.0/types.hal",
+                                "package a.b.z@1.0;\nstruct Z { int32_t v; };\n");
+
+    const FQName x("a.b.x", "1.0", "types");
+    const FQName y("a.b.y", "1.0", "types");
+    const FQName z("a.b.z", "1.0", "types");
+    for (const FQName& fqName : {x, y, z}) {
+        ASSERT_NE(nullptr, coordinator.parse(fqName, nullptr, Coordinator::Enforce::NO_HASH));
+    }
+
+    // Y no longer resolves, but is only parsed again once invalidated.
+    coordinator.setFileContents("/root/a1/b1/x/1.0/types.hal",
+                                "package a.b.x@1.0;\nstruct W { int32_t v; };\n");
+    EXPECT_NE(nullptr, coordinator.parse(y, nullptr, Coordinator::Enforce::NO_HASH));
+
+    std::set<FQName> invalidated;
+    coordinator.invalidate(x, &invalidated);
+    EXPECT_EQ((std::set<FQName>{x, y}), invalidated);
+
+    EXPECT_NE(nullptr, coordinator.parse(x, nullptr, Coordinator::Enforce::NO_HASH));
+    EXPECT_EQ(nullptr, coordinator.parse(y, nullptr, Coordinator::Enforce::NO_HASH));
+    EXPECT_NE(nullptr, coordinator.parse(z, nullptr, Coordinator::Enforce::NO_HASH));
+
+    // The failed parse of Y is retried on any invalidation.
+    coordinator.setFileContents("/root/a1/b1/x/1.0/types.hal",
+                                "package a.b.x@1.0;\nstruct X { int32_t v; };\n");
+    invalidated.clear();
+    coordinator.invalidate(x, &invalidated);
+    EXPECT_EQ((std::set<FQName>{x, y}), invalidated);
+    EXPECT_NE(nullptr, coordinator.parse(y, nullptr, Coordinator::Enforce::NO_HASH));
+}
+
 TEST_F(HidlGenHostTest, LocationTest) {
     Location a{{"file", 3, 4}, {"file", 3, 5}};
     Location b{{"file", 3, 6}, {"file", 3, 7}};
@@ -107,6 +177,118 @@ TEST_F(HidlGenHostTest, LocationTest) {
     EXPECT_FALSE(Location::inSameFile(a, other));
 }
 
+TEST_F(HidlGenHostTest, LongConstantExpressionChainTest) {
+    // Same shape as the chain EnumValue::autofill builds for a huge enum.
+    constexpr size_t kNumValues = 100000;
+    const Location location = Location::startOf("test");
+
+    std::vector<EnumValue*> values;
+    values.push_back(
+        new EnumValue("V0", ConstantExpression::Zero(ScalarType::KIND_INT64).release(), location));
+    for (size_t i = 1; i < kNumValues; i++) {
+        auto* prevReference = new ReferenceConstantExpression(
+            Reference<LocalIdentifier>(values.back(), location), values.back()->name());
+        std::string name = "V" + std::to_string(i);
+        values.push_back(new EnumValue(name.c_str(),
+                                       prevReference->addOne(ScalarType::KIND_INT64).release(),
+                                       location));
+    }
+
+    ConstantExpression* last = values.back()->constExpr();
+
+    std::unordered_set<const ConstantExpression*> visited;
+    std::unordered_set<const ConstantExpression*> stack;
+    EXPECT_EQ(OK, last->checkAcyclic(&visited, &stack).status);
+    EXPECT_TRUE(stack.empty());
+
+    visited.clear();
+    EXPECT_EQ(OK, last->recursivePass(
+                      [](ConstantExpression* ce) {
+                          ce->evaluate();
+                          return OK;
+                      },
+                      &visited, false /* processBeforeDependencies */));
+    EXPECT_EQ(std::to_string(kNumValues - 1), last->rawValue());
+    EXPECT_EQ("1", values[1]->rawValue(ScalarType::KIND_INT64));
+}
+
+// Serves a minimal IBase and kNumStressPackages packages, each importing
+// the previous one, from memory.
+static constexpr size_t kNumStressPackages = 64;
+static void configureStressTest(Coordinator* coordinator) {
+    const std::string root = "/hidl-gen-host-test/";
+    coordinator->setRootPath(root);
+
+    std::string error;
+    EXPECT_EQ(OK, coordinator->addPackagePath("android.hidl", "transport", &error));
+    EXPECT_EQ(OK, coordinator->addPackagePath("test.stress", "stress", &error));
+
+    coordinator->setFileContents(root + "transport/base/1.0/IBase.hal",
+                                 "package android.hidl.base@1.0;\n"
+                                 "interface IBase {\n"
+                                 "    ping();\n"
+                                 "};\n");
+
+    for (size_t i = 0; i < kNumStressPackages; i++) {
+        const std::string package = "test.stress.p" + std::to_string(i) + "@1.0";
+        const std::string path = root + "stress/p" + std::to_string(i) + "/1.0/";
+        const std::string previous = "test.stress.p" + std::to_string(i - 1) + "@1.0::S";
+
+        coordinator->setFileContents(
+            path + "types.hal",
+            "package " + package + ";\n" + (i > 0 ? "import " + previous + ";\n" : "") +
+                "/** Doc comments are lexed too. */\n"
+                "enum E : int32_t { A = " + std::to_string(i) + ", B = A + 1 };\n"
+                "struct S {\n"
+                "    E e;\n"
+                "    vec<string> names;\n" + (i > 0 ? "    " + previous + " previous;\n" : "") +
+                "};\n");
+        coordinator->setFileContents(path + "IFoo.hal", "package " + package +
+                                                            ";\n"
+                                                            "interface IFoo {\n"
+                                                            "    get(S s) generates (E e);\n"
+                                                            "};\n");
+    }
+}
+
+static void runOnThreadPool(size_t numTasks, const std::function<void(size_t)>& task) {
+    std::atomic<size_t> next{0};
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < std::max(4u, std::thread::hardware_concurrency()); i++) {
+        threads.emplace_back([&] {
+            for (size_t j = next++; j < numTasks; j = next++) task(j);
+        });
+    }
+    for (std::thread& thread : threads) thread.join();
+}
+
+static void expectStressInterface(AST* ast) {
+    ASSERT_NE(nullptr, ast);
+    const Interface* iface = ast->getInterface();
+    ASSERT_NE(nullptr, iface);
+    EXPECT_EQ(1u, iface->userDefinedMethods().size());
+    EXPECT_EQ(1u, iface->hidlReservedMethods().size());
+}
+
+TEST_F(HidlGenHostTest, CoordinatorConcurrentParseTest) {
+    // Many threads sharing one Coordinator.
+    Coordinator shared;
+    configureStressTest(&shared);
+    runOnThreadPool(kNumStressPackages, [&](size_t i) {
+        FQName fqName("test.stress.p" + std::to_string(kNumStressPackages - 1 - i), "1.0",
+                      "IFoo");
+        expectStressInterface(shared.parse(fqName, nullptr, Coordinator::Enforce::NONE));
+    });
+
+    // One Coordinator per task; they must not share any state.
+    runOnThreadPool(kNumStressPackages, [&](size_t i) {
+        Coordinator coordinator;
+        configureStressTest(&coordinator);
+        FQName fqName("test.stress.p" + std::to_string(i), "1.0", "IFoo");
+        expectStressInterface(coordinator.parse(fqName, nullptr, Coordinator::Enforce::NONE));
+    });
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();